@@ -263,7 +263,8 @@ set_if_at_least_one_set(RETDEC_ENABLE_BIN2LLVMIR
 
 set_if_at_least_one_set(RETDEC_ENABLE_LLVMIR2HLL
 		RETDEC_ENABLE_ALL
-		RETDEC_ENABLE_LLVMIR2HLLTOOL)
+		RETDEC_ENABLE_LLVMIR2HLLTOOL
+		RETDEC_ENABLE_RETDEC)
 
 set_if_at_least_one_set(RETDEC_ENABLE_UNPACKER
 		RETDEC_ENABLE_ALL
@@ -287,6 +288,7 @@ set_if_at_least_one_set(RETDEC_ENABLE_STACOFIN
 set_if_at_least_one_set(RETDEC_ENABLE_CPDETECT
 		RETDEC_ENABLE_ALL
 		RETDEC_ENABLE_FILEINFO
+		RETDEC_ENABLE_RETDEC
 		RETDEC_ENABLE_UNPACKERTOOL)
 
 set_if_at_least_one_set(RETDEC_ENABLE_RTTI_FINDER
@@ -403,6 +405,7 @@ set_if_at_least_one_set(RETDEC_ENABLE_UTILS
 		RETDEC_ENABLE_MACHO_EXTRACTORTOOL
 		RETDEC_ENABLE_PRETDEC_ENABLE_CPDETECTAT2YARA
 		RETDEC_ENABLE_PATTERNGEN
+		RETDEC_ENABLE_PDBPARSER
 		RETDEC_ENABLE_RTTI_FINDER
 		RETDEC_ENABLE_STACOFIN
 		RETDEC_ENABLE_UNPACKERTOOL)
@@ -423,6 +426,12 @@ set_if_all_set(RETDEC_ENABLE_CAPSTONE2LLVMIR_TESTS
 set_if_all_set(RETDEC_ENABLE_CONFIG_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_CONFIG)
+set_if_all_set(RETDEC_ENABLE_CPDETECT_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_CPDETECT)
+set_if_all_set(RETDEC_ENABLE_CRYPTO_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_CRYPTO)
 set_if_all_set(RETDEC_ENABLE_CTYPES_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_CTYPES)
@@ -444,6 +453,12 @@ set_if_all_set(RETDEC_ENABLE_LLVMIR2HLL_TESTS
 set_if_all_set(RETDEC_ENABLE_LOADER_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_LOADER)
+set_if_all_set(RETDEC_ENABLE_PDBPARSER_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_PDBPARSER)
+set_if_all_set(RETDEC_ENABLE_RETDEC_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_RETDEC)
 set_if_all_set(RETDEC_ENABLE_SERDES_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_SERDES)
@@ -474,6 +489,8 @@ set_if_at_least_one_set(RETDEC_ENABLE_GOOGLETEST
 		RETDEC_ENABLE_CAPSTONE2LLVMIR_TESTS
 		RETDEC_ENABLE_COMMON_TESTS
 		RETDEC_ENABLE_CONFIG_TESTS
+		RETDEC_ENABLE_CPDETECT_TESTS
+		RETDEC_ENABLE_CRYPTO_TESTS
 		RETDEC_ENABLE_CTYPES_TESTS
 		RETDEC_ENABLE_CTYPESPARSER_TESTS
 		RETDEC_ENABLE_DEMANGLER_TESTS
@@ -481,6 +498,8 @@ set_if_at_least_one_set(RETDEC_ENABLE_GOOGLETEST
 		RETDEC_ENABLE_LLVMIR_EMUL_TESTS
 		RETDEC_ENABLE_LLVMIR2HLL_TESTS
 		RETDEC_ENABLE_LOADER_TESTS
+		RETDEC_ENABLE_PDBPARSER_TESTS
+		RETDEC_ENABLE_RETDEC_TESTS
 		RETDEC_ENABLE_SERDES_TESTS
 		RETDEC_ENABLE_UNPACKER_TESTS
 		RETDEC_ENABLE_UTILS_TESTS)
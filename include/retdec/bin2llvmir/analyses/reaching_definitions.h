@@ -3,9 +3,10 @@
 * @brief Reaching definitions analysis (RDA) builds UD and DU chains.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 *
-* Right now, this works on an entire module. But we could insert an another layer
-* that represents functions. Then it would be possible to associate BBs with
-* functions that own them and recompute RDA only for the selected function.
+* Data-flow equations are solved separately for every function, using bit
+* vectors indexed by per-function numbers of definitions. Independent functions
+* are solved in parallel, and results of a single function can be invalidated
+* and recomputed without recomputing the whole module.
 */
 
 #ifndef RETDEC_BIN2LLVMIR_ANALYSES_REACHING_DEFINITIONS_H
@@ -31,8 +32,6 @@ class Use;
 class BasicBlockEntry;
 class ReachingDefinitionsAnalysis;
 
-using Changed = bool;
-
 using BBEntrySet = std::unordered_set<BasicBlockEntry*>;
 
 using DefSet = std::unordered_set<Definition*>;
@@ -83,9 +82,6 @@ class BasicBlockEntry
 				std::ostream& out,
 				const BasicBlockEntry& bbe);
 
-		void initializeKillDefSets();
-		Changed initDefsOut();
-
 		const DefSet& defsFromUse(const llvm::Instruction* I) const;
 		const UseSet& usesFromDef(const llvm::Instruction* I) const;
 		const Definition* getDef(const llvm::Instruction* I) const;
@@ -99,13 +95,6 @@ class BasicBlockEntry
 
 		BBEntrySet prevBBs;
 
-		// defsIn is union of prevBBs' defsOuts
-		DefSet defsOut;
-		DefSet genDefs;
-		std::unordered_set<llvm::Value*> killDefs;
-
-		bool changed = false;
-
 	private:
 		unsigned id;
 	    static int newUID;
@@ -125,6 +114,12 @@ class ReachingDefinitionsAnalysis
 		void clear();
 		bool wasRun() const;
 
+	// Incremental interface.
+	//
+	public:
+		void invalidate(const llvm::Function* F);
+		bool updateOnModule(llvm::Module& M);
+
 	// Full instance interface.
 	//
 	public:
@@ -146,18 +141,17 @@ class ReachingDefinitionsAnalysis
 				llvm::Instruction* I);
 
 	private:
-		void run();
+		using BasicBlockMap = std::map<const llvm::BasicBlock*, BasicBlockEntry>;
+
+	private:
+		void run(const std::vector<const llvm::Function*>& fncs);
 		const BasicBlockEntry& getBasicBlockEntry(const llvm::Instruction* I) const;
 		void initializeBasicBlocks(llvm::Module& M);
 		void initializeBasicBlocks(llvm::Function& F);
-		void initializeBasicBlocksPrev();
-		void initializeKillGenSets();
-		void propagate();
-		void initializeDefsAndUses();
-		void clearInternal();
+		static void solveFunction(const llvm::Function* F, BasicBlockMap& bbs);
 
 	private:
-		std::map<const llvm::Function*, std::map<const llvm::BasicBlock*, BasicBlockEntry>> bbMap;
+		std::map<const llvm::Function*, BasicBlockMap> bbMap;
 		bool _trackFlagRegs = false;
 		const llvm::GlobalVariable* _specialGlobal = nullptr;
 		bool _run = false;
@@ -30,6 +30,7 @@
 #include "retdec/bin2llvmir/providers/names.h"
 #include "retdec/bin2llvmir/optimizations/decoder/decoder_debug.h"
 #include "retdec/bin2llvmir/optimizations/decoder/decoder_ranges.h"
+#include "retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h"
 #include "retdec/bin2llvmir/optimizations/decoder/jump_targets.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #include "retdec/bin2llvmir/utils/symbolic_tree_match.h"
@@ -65,6 +66,7 @@ class Decoder : public llvm::ModulePass
 	//
 	private:
 		void initTranslator();
+		void initDisassemblyCache();
 		void initDryRunCsInstruction();
 		void initEnvironment();
 		void initEnvironmentAsm2LlvmMapping();
@@ -302,6 +304,9 @@ class Decoder : public llvm::ModulePass
 
 		std::unique_ptr<capstone2llvmir::Capstone2LlvmIrTranslator> _c2l;
 		cs_insn* _dryCsInsn = nullptr;
+		/// Instructions disassembled in parallel ahead of decoding.
+		/// Null if only one thread is used.
+		std::unique_ptr<DisassemblyCache> _disasmCache;
 
 		llvm::IRBuilder<>* _irb;
 
@@ -0,0 +1,112 @@
+/**
+* @file include/retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h
+* @brief Cache of instructions disassembled ahead of decoding.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_DISASSEMBLY_CACHE_H
+#define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_DISASSEMBLY_CACHE_H
+
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <capstone/capstone.h>
+
+#include "retdec/common/address.h"
+#include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/utils/thread_pool.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Disassembles chunks of the input binary on worker threads before the
+ * decoder asks for them.
+ *
+ * Each chunk is a linear sweep of Capstone instructions (with details) that
+ * starts at a requested address. Every worker uses its own Capstone handle,
+ * the decoder then takes the already disassembled instructions and only
+ * translates them to LLVM IR, which stays sequential. The decoder never
+ * waits for a chunk -- instructions that are not ready yet are disassembled
+ * by the decoder itself.
+ *
+ * All the methods must be called from a single (decoder) thread.
+ */
+class DisassemblyCache
+{
+	public:
+		DisassemblyCache(
+				FileImage* image,
+				cs_arch arch,
+				cs_mode extraMode,
+				std::size_t numOfThreads);
+
+		void prefetch(common::Address addr, cs_mode basicMode);
+		cs_insn* take(
+				common::Address addr,
+				cs_mode basicMode,
+				std::size_t maxSize);
+
+	private:
+		/// Linear sweep of instructions starting at @c start.
+		/// Instructions already taken by the decoder are set to @c nullptr.
+		struct Chunk
+		{
+			~Chunk();
+
+			common::Address start;
+			/// Address right after the last disassembled instruction.
+			common::Address end;
+			/// Sorted addresses of instructions in @c insns.
+			std::vector<std::uint64_t> addresses;
+			std::vector<cs_insn*> insns;
+			std::size_t taken = 0;
+			bool continuationPrefetched = false;
+		};
+		using ChunkKey = std::pair<cs_mode, common::Address>;
+		using ChunkFuture = std::shared_future<std::shared_ptr<Chunk>>;
+
+	private:
+		std::shared_ptr<Chunk> disassemble(
+				common::Address start,
+				cs_mode basicMode,
+				const std::uint8_t* bytes,
+				std::size_t size) const;
+		static bool isReady(const ChunkFuture& chunk);
+		cs_insn* takeFromChunk(
+				Chunk& chunk,
+				common::Address addr,
+				cs_mode basicMode,
+				std::size_t maxSize);
+		std::size_t getMinInsnSize(cs_mode basicMode) const;
+
+	private:
+		/// Number of bytes disassembled in one chunk.
+		static constexpr std::size_t CHUNK_SIZE = 0x1000;
+		/// Maximal number of chunks kept at once.
+		static constexpr std::size_t MAX_CHUNKS = 64;
+		/// Maximal size of an instruction on any supported architecture.
+		static constexpr std::size_t MAX_INSN_SIZE = 16;
+
+		FileImage* _image = nullptr;
+		cs_arch _arch = CS_ARCH_ALL;
+		cs_mode _extraMode = CS_MODE_LITTLE_ENDIAN;
+
+		std::map<ChunkKey, ChunkFuture> _chunks;
+		/// Chunk keys in the order of their creation, used for eviction.
+		std::queue<ChunkKey> _chunksOrder;
+
+		/// Declared last so that workers are joined before the chunks
+		/// they might still be creating are destroyed.
+		utils::ThreadPool _pool;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
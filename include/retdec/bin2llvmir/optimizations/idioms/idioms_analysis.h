@@ -7,7 +7,9 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_IDIOMS_IDIOMS_ANALYSIS_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_IDIOMS_IDIOMS_ANALYSIS_H
 
+#include <bitset>
 #include <cstdio>
+#include <initializer_list>
 
 #include <llvm/ADT/Statistic.h>
 #include <llvm/IR/BasicBlock.h>
@@ -47,8 +49,17 @@ public:
 	virtual bool doAnalysis(llvm::Function & f, llvm::Pass * p) override;
 
 private:
+	/// Set of instruction opcodes.
+	using OpcodeSet = std::bitset<llvm::Instruction::OtherOpsEnd>;
+
+	static OpcodeSet getOpcodes(const llvm::BasicBlock & bb);
+
 	bool analyse(llvm::Function & f, llvm::Pass * p, int (IdiomsAnalysis::*exchanger)(llvm::Function &, llvm::Pass *) const, const char * fname);
-	bool analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname);
+	bool analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname,
+		std::initializer_list<unsigned> rootOpcodes);
+
+	/// Opcodes of instructions in the currently analysed basic block.
+	OpcodeSet m_bbOpcodes;
 };
 
 } // namespace bin2llvmir
@@ -7,22 +7,134 @@
 #ifndef RETDEC_BIN2LLVMIR_PROVIDERS_ASM_INSTRUCTION_H
 #define RETDEC_BIN2LLVMIR_PROVIDERS_ASM_INSTRUCTION_H
 
+#include <cstdint>
+
 #include <capstone/capstone.h>
 #include "retdec/capstone2llvmir/arm/arm_defs.h"
 #include "retdec/capstone2llvmir/mips/mips_defs.h"
 #include "retdec/capstone2llvmir/powerpc/powerpc_defs.h"
 #include "retdec/capstone2llvmir/x86/x86_defs.h"
 
+#include <llvm/ADT/DenseMap.h>
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/Module.h>
+#include <llvm/IR/ValueHandle.h>
 
 #include "retdec/bin2llvmir/utils/llvm.h"
 #include "retdec/common/address.h"
 
 namespace retdec {
+
+namespace loader {
+class Image;
+} // namespace loader
+
 namespace bin2llvmir {
 
-using Llvm2CapstoneInsnMap = typename std::map<llvm::StoreInst*, cs_insn*>;
+/**
+ * Side table of Capstone instructions underlying LLVM-to-ASM mapping
+ * instructions in one module.
+ *
+ * Only a compact record (address, size, ID, and mode) is kept for each
+ * instruction. Full instructions with operand details are disassembled again
+ * from the input image through a Capstone handle owned by the table when they
+ * are asked for, and kept until they are released or the table is cleared.
+ *
+ * Instructions are indexed both by their mapping instructions and by their
+ * addresses, so that both lookups take constant time. The address index uses
+ * weak value handles, so it never returns mapping instructions that were
+ * erased from the module.
+ *
+ * The table also caches the owning mapping instruction of other LLVM
+ * instructions (see getOwner()).
+ */
+class Llvm2CapstoneInsnMap
+{
+	public:
+		/// Compact record of one Capstone instruction.
+		struct Insn
+		{
+			/// Address of the instruction.
+			std::uint64_t address = 0;
+			/// Capstone ID of the instruction.
+			unsigned id = 0;
+			/// Size of the instruction in bytes.
+			std::uint16_t size = 0;
+			/// Basic mode the instruction was disassembled in.
+			cs_mode mode = CS_MODE_LITTLE_ENDIAN;
+		};
+
+		using Map = llvm::DenseMap<llvm::StoreInst*, Insn>;
+		using iterator = Map::iterator;
+		using const_iterator = Map::const_iterator;
+
+	public:
+		Llvm2CapstoneInsnMap() = default;
+		Llvm2CapstoneInsnMap(Llvm2CapstoneInsnMap&& o) noexcept;
+		Llvm2CapstoneInsnMap& operator=(Llvm2CapstoneInsnMap&& o) noexcept;
+		~Llvm2CapstoneInsnMap();
+
+		bool setDisassembler(
+				cs_arch arch,
+				cs_mode extraMode,
+				const retdec::loader::Image* image);
+
+		bool emplace(llvm::StoreInst* s, const cs_insn* i, cs_mode basicMode);
+		const Insn* getInsn(llvm::StoreInst* s) const;
+		cs_insn* getCapstoneInsn(llvm::StoreInst* s);
+		void releaseCapstoneInsn(llvm::StoreInst* s);
+		llvm::StoreInst* getLlvmToAsmInstruction(
+				retdec::common::Address addr) const;
+
+		llvm::StoreInst* getOwner(llvm::Instruction* i) const;
+		void setOwner(llvm::Instruction* i, llvm::StoreInst* s);
+
+		iterator begin();
+		iterator end();
+		const_iterator begin() const;
+		const_iterator end() const;
+		std::size_t size() const;
+		bool empty() const;
+		void clear();
+
+	private:
+		/// Cached owner of an LLVM instruction.
+		struct Owner
+		{
+			/// The instruction itself, so that a new instruction allocated
+			/// at the address of an erased one is not mistaken for it.
+			llvm::WeakVH insn;
+			/// Its LLVM-to-ASM mapping instruction.
+			llvm::WeakVH owner;
+			/// Value of @c _ownersEpoch when the owner was found.
+			unsigned epoch = 0;
+		};
+
+	private:
+		cs_insn* disassemble(const Insn& insn) const;
+		void releaseCapstoneInsns();
+		void closeDisassembler();
+
+	private:
+		/// Compact record for each LLVM-to-ASM mapping instruction.
+		Map _insns;
+		/// The last LLVM-to-ASM mapping instruction for each address.
+		llvm::DenseMap<std::uint64_t, llvm::WeakVH> _addr2llvm;
+		/// Full instructions disassembled on demand, owned by this table.
+		llvm::DenseMap<llvm::StoreInst*, cs_insn*> _details;
+		/// Cached owners of LLVM instructions.
+		llvm::DenseMap<const llvm::Instruction*, Owner> _owners;
+		/// Incremented whenever a mapping instruction is added, which may
+		/// change owners of instructions already in the module.
+		unsigned _ownersEpoch = 0;
+
+		/// Capstone handle used to disassemble instructions again.
+		csh _handle = 0;
+		cs_arch _arch = CS_ARCH_ALL;
+		cs_mode _extraMode = CS_MODE_LITTLE_ENDIAN;
+		/// Image the instructions were disassembled from.
+		const retdec::loader::Image* _image = nullptr;
+};
 
 /**
  * Assembly instruction representation.
@@ -180,6 +292,8 @@ class AsmInstruction
 		const llvm::GlobalVariable* getLlvmToAsmGlobalVariablePrivate(
 				llvm::Module* m) const;
 		bool isLlvmToAsmInstructionPrivate(llvm::Value* inst) const;
+		static Llvm2CapstoneInsnMap* findLlvmToCapstoneInsnMap(
+				const llvm::Module* m);
 
 	private:
 		using ModuleGlobalPair = std::pair<
@@ -187,7 +301,7 @@ class AsmInstruction
 				llvm::GlobalVariable*>;
 		using ModuleInstructionMap = std::pair<
 				const llvm::Module*,
-				std::map<llvm::StoreInst*, cs_insn*>>;
+				Llvm2CapstoneInsnMap>;
 
 	private:
 		llvm::StoreInst* _llvmToAsmInstr = nullptr;
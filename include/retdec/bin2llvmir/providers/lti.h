@@ -7,12 +7,20 @@
 #ifndef RETDEC_BIN2LLVMIR_PROVIDERS_LTI_H
 #define RETDEC_BIN2LLVMIR_PROVIDERS_LTI_H
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <tuple>
+#include <vector>
+
 #include <llvm/IR/Module.h>
 
 #include "retdec/ctypesparser/json_ctypes_parser.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/ctypesparser/type_config.h"
+#include "retdec/utils/memory_mapped_file.h"
 
 namespace retdec {
 namespace bin2llvmir {
@@ -40,17 +48,71 @@ class Lti
 		FunctionPair getPairFunction(const std::string& name);
 		llvm::Function* getLlvmFunction(const std::string& name);
 
+	public:
+		static void preloadLtiFiles(
+				const std::set<std::string>& filePaths,
+				unsigned bitSize,
+				const ctypesparser::TypeConfig::TypeWidths& typeWidths);
+		static void clearCache();
+
+	private:
+		/**
+		 * LTI file mapped into memory and indexed by function names.
+		 * Functions (and the types they use) are parsed only when they
+		 * are requested for the first time.
+		 */
+		class LtiFile
+		{
+			public:
+				LtiFile(
+						const std::string& filePath,
+						unsigned bitSize,
+						const ctypesparser::TypeConfig::TypeWidths& typeWidths);
+
+				bool isLoaded() const;
+				std::shared_ptr<retdec::ctypes::Function> getFunction(
+						const std::string& name);
+
+			private:
+				/// Content of the file if it can be mapped into memory.
+				utils::MemoryMappedFile _mappedFile;
+				/// Content of the file if it can not be mapped into memory.
+				std::string _content;
+				bool _loaded = false;
+				ctypesparser::JSONCTypesParser _parser;
+				/// Functions are parsed on demand and the file may be shared
+				/// by several Lti instances.
+				std::mutex _mutex;
+		};
+
 	private:
 		void loadLtiFile(const std::string& filePath);
 		llvm::Type* getLlvmType(std::shared_ptr<retdec::ctypes::Type> type);
 
+		static std::shared_ptr<LtiFile> getParsedLtiFile(
+				const std::string& filePath,
+				unsigned bitSize,
+				const ctypesparser::TypeConfig::TypeWidths& typeWidths);
+
 	private:
 		llvm::Module* _module = nullptr;
 		Config* _config = nullptr;
 		std::shared_ptr<ctypesparser::TypeConfig> _typeConfig;
 		retdec::loader::Image* _image = nullptr;
-		std::unique_ptr<retdec::ctypes::Module> _ltiModule;
-		ctypesparser::JSONCTypesParser _ltiParser;
+		/// Loaded LTI files, in the order in which they were loaded.
+		std::vector<std::shared_ptr<LtiFile>> _ltiFiles;
+
+	private:
+		/// File path, bit size, and type widths the file was parsed with.
+		using LtiCacheKey = std::tuple<
+				std::string,
+				unsigned,
+				ctypesparser::TypeConfig::TypeWidths>;
+		/// LTI files indexed so far in this process. Their content does not
+		/// depend on the input binary, so each file is indexed only once and
+		/// then shared by all the Lti instances (and decompilations).
+		static std::map<LtiCacheKey, std::shared_ptr<LtiFile>> _ltiCache;
+		static std::mutex _ltiCacheMutex;
 };
 
 class LtiProvider
@@ -433,6 +433,24 @@ class Capstone2LlvmIrTranslator
 				std::size_t& size,
 				retdec::common::Address& a,
 				llvm::IRBuilder<>& irb) = 0;
+		/**
+		 * Translate one already disassembled assembly instruction.
+		 * The instruction must have been disassembled by a Capstone engine
+		 * with the same architecture and mode as this translator is currently
+		 * in, and with the instruction details turned on.
+		 * This makes it possible to disassemble instructions elsewhere (e.g.
+		 * in other threads), and only translate them here.
+		 * @param insn  Capstone instruction to translate. The ownership is
+		 *              passed to the translator, the instruction is returned
+		 *              in @c TranslationResultOne::capstoneInsn.
+		 * @param irb   LLVM IR builder used to create LLVM IR translation.
+		 *              Translated LLVM IR instructions are created at its
+		 *              current position.
+		 * @return See @c TranslationResult structure.
+		 */
+		virtual TranslationResultOne translateOne(
+				cs_insn* insn,
+				llvm::IRBuilder<>& irb) = 0;
 //
 //==============================================================================
 // Capstone related getters and query methods.
@@ -40,12 +40,16 @@ class Parameters
 		void setIsSelectedDecodeOnly(bool b);
 		void setOutputFile(const std::string& n);
 		void setOrdinalNumbersDirectory(const std::string& n);
+		void setStaticSignaturesCacheDirectory(const std::string& n);
+		void setNumberOfThreads(unsigned n);
 		/// @}
 
 		/// @name Parameters get methods.
 		/// @{
 		std::string getOutputFile() const;
 		std::string getOrdinalNumbersDirectory() const;
+		std::string getStaticSignaturesCacheDirectory() const;
+		unsigned getNumberOfThreads() const;
 		/// @}
 
 template <typename Writer>
@@ -88,6 +92,13 @@ void deserialize(const rapidjson::Value& val);
 
 		std::string _outputFile;
 		std::string _ordinalNumbersDirectory;
+		/// Existing directory where compiled static code signatures are
+		/// cached. Empty if they should not be cached.
+		std::string _staticSignaturesCacheDirectory;
+
+		/// Maximal number of threads the decompilation may use.
+		/// Zero means the number of threads supported by the hardware.
+		unsigned _numberOfThreads = 1;
 };
 
 } // namespace config
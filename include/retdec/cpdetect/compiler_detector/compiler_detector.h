@@ -67,6 +67,11 @@ class CompilerDetector : private retdec::utils::NonCopyable
 		/// @{
 		ReturnCode getAllInformation();
 		/// @}
+
+		/// @name Static data
+		/// @{
+		static void preloadSignatures();
+		/// @}
 };
 
 } // namespace cpdetect
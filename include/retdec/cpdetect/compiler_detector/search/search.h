@@ -38,8 +38,24 @@ class Search
 				/// @}
 		};
 	private:
+		/**
+		 * Signature pattern compiled into byte values and masks for one
+		 * alignment of its first nibble
+		 */
+		struct MaskedPattern
+		{
+			std::size_t patternIndex;          ///< index of pattern in searched set
+			std::size_t alignment;             ///< nibble offset of pattern in its first byte (0 or 1)
+			std::size_t nibbleLength;          ///< length of pattern in nibbles
+			std::vector<unsigned char> values; ///< expected values of bytes
+			std::vector<unsigned char> masks;  ///< significant bits of bytes
+			std::size_t anchor;                ///< index of byte without wildcards or @c npos
+		};
+
 		retdec::fileformat::FileFormat &parser; ///< parser of input file
-		std::string nibbles;             ///< content of file in hexadecimal string representation
+		std::vector<unsigned char> swappedBytes; ///< content of big endian file converted to little endian
+		const unsigned char *content;    ///< content of file used for search (no copy for little endian files)
+		std::size_t contentSize;         ///< size of @c content in bytes
 		std::string plain;               ///< content of file as plain string
 		std::vector<RelativeJump> jumps; ///< representation of supported relative jumps
 		std::size_t averageSlashLen;     ///< average length of one slash representation
@@ -51,6 +67,11 @@ class Search
 		bool haveSlashes() const;
 		std::size_t nibblesFromBytes(std::size_t nBytes) const;
 		std::size_t bytesFromNibbles(std::size_t nNibbles) const;
+		std::size_t getNumberOfNibbles() const;
+		char getNibble(std::size_t nibbleIndex) const;
+		bool hasNibblesOnPosition(const std::string &hexString, std::size_t nibbleIndex) const;
+		bool compileUnslashedSignature(const std::string &signPattern, std::size_t patternIndex, std::vector<MaskedPattern> &compiled) const;
+		bool matchesOnPosition(const MaskedPattern &pattern, std::size_t byteOffset) const;
 		/// @}
 	public:
 		Search(retdec::fileformat::FileFormat &fileParser);
@@ -63,7 +84,6 @@ class Search
 
 		/// @name Getters
 		/// @{
-		const std::string& getNibbles() const;
 		const std::string& getPlainString() const;
 		/// @}
 
@@ -76,6 +96,7 @@ class Search
 		/// @{
 		unsigned long long countImpNibbles(const std::string &signPattern) const;
 		unsigned long long findUnslashedSignature(const std::string &signPattern, std::size_t startOffset, std::size_t stopOffset) const;
+		std::vector<unsigned long long> findUnslashedSignatures(const std::vector<std::string> &signPatterns, std::size_t startOffset, std::size_t stopOffset) const;
 		unsigned long long findSlashedSignature(const std::string &signPattern, std::size_t startOffset, std::size_t stopOffset) const;
 		unsigned long long exactComparison(const std::string &signPattern, std::size_t fileOffset, std::size_t shift = 0) const;
 		bool countSimilarity(const std::string &signPattern, Similarity &sim, std::size_t fileOffset, std::size_t shift = 0) const;
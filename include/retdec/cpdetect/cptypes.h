@@ -8,6 +8,7 @@
 #define RETDEC_CPDETECT_CPTYPES_H
 
 #include <limits>
+#include <string>
 #include <vector>
 
 #include "retdec/cpdetect/settings.h"
@@ -114,6 +115,8 @@ struct DetectParams
 
 	std::size_t epBytesCount;
 
+	std::string cacheDirectory;  ///< directory with cached compiled signatures
+
 	DetectParams(SearchType searchType_, bool internal_, bool external_, std::size_t epBytesCount_ = EP_BYTES_SIZE);
 };
 
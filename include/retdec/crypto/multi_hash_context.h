@@ -0,0 +1,48 @@
+/**
+* @file include/retdec/crypto/multi_hash_context.h
+* @brief Declaration of class MultiHashContext.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_CRYPTO_MULTI_HASH_CONTEXT_H
+#define RETDEC_CRYPTO_MULTI_HASH_CONTEXT_H
+
+#include <cstdint>
+#include <string>
+
+#include <openssl/md5.h>
+#include <openssl/sha.h>
+
+#include "retdec/crypto/crc32.h"
+
+namespace retdec {
+namespace crypto {
+
+/**
+ * This class represents continuous computation of CRC32, MD5 and SHA256 of
+ * the same data.
+ *
+ * Every added block of data is processed by all three algorithms before the
+ * next block is read, so the data are read from memory only once. The hashes
+ * are the same as the ones returned by getCrc32(), getMd5() and getSha256().
+ */
+class MultiHashContext
+{
+public:
+	MultiHashContext();
+
+	void addData(const std::uint8_t* data, std::size_t size);
+	std::string getCrc32();
+	std::string getMd5();
+	std::string getSha256();
+
+private:
+	CRC32 _crc32;         ///< Context of CRC32.
+	MD5_CTX _md5;         ///< Context of MD5.
+	SHA256_CTX _sha256;   ///< Context of SHA256.
+};
+
+} // namespace crypto
+} // namespace retdec
+
+#endif
@@ -8,8 +8,11 @@
 #define RETDEC_CTYPESPARSER_JSON_CTYPES_PARSER_H
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <rapidjson/document.h>
 
@@ -37,6 +40,24 @@ class JSONCTypesParser: public CTypesParser
 			const TypeWidths &typeWidths = {},
 			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
 
+		/// @name Lazy parsing.
+		/// @{
+		void index(
+			const char *json,
+			std::size_t size,
+			const std::shared_ptr<retdec::ctypes::Context> &context,
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
+		bool hasIndexedFunction(const std::string &name) const;
+		std::shared_ptr<retdec::ctypes::Function> getIndexedFunction(
+			const std::string &name);
+		/// @}
+
+	private:
+		/// Offset and size of a JSON value in the indexed JSON.
+		using JSONRange = std::pair<std::size_t, std::size_t>;
+		using JSONIndex = std::unordered_map<std::string, JSONRange>;
+
 	private:
 		std::string loadJson(std::istream &stream) const;
 		std::unique_ptr<rapidjson::Document> parseJson(char *buffer) const;
@@ -44,6 +65,8 @@ class JSONCTypesParser: public CTypesParser
 			const std::unique_ptr<rapidjson::Document> &root,
 			std::unique_ptr<retdec::ctypes::Module> &module);
 		void addTypesToMap(const rapidjson::Value &types);
+		const rapidjson::Value &getJsonType(const std::string &typeKey);
+		const rapidjson::Value &parseIndexedValue(const JSONRange &range);
 
 		/// @name Parsing methods.
 		/// @{
@@ -128,7 +151,7 @@ class JSONCTypesParser: public CTypesParser
 
 	private:
 		using ParserContext = std::unordered_map<std::string, std::shared_ptr<retdec::ctypes::Type>>;
-		using TypesMap = std::unordered_map<std::string, rapidjson::Value::ConstMemberIterator>;
+		using TypesMap = std::unordered_map<std::string, const rapidjson::Value *>;
 
 	private:
 		/// Context for the parser (to speedup the parsing).
@@ -139,6 +162,18 @@ class JSONCTypesParser: public CTypesParser
 
 		/// Call convention used when JSON does not contain one.
 		retdec::ctypes::CallConvention defaultCallConv;
+
+		/// JSON indexed by index(), not owned by the parser.
+		const char *indexedJson = nullptr;
+
+		/// Ranges of functions in the indexed JSON.
+		JSONIndex functionsIndex;
+
+		/// Ranges of types in the indexed JSON.
+		JSONIndex typesIndex;
+
+		/// Values from the indexed JSON parsed so far.
+		std::vector<std::unique_ptr<rapidjson::Document>> indexedValues;
 };
 
 } // namespace ctypesparser
@@ -7,6 +7,8 @@
 #ifndef RETDEC_DEBUGFORMAT_DEBUGFORMAT_H
 #define RETDEC_DEBUGFORMAT_DEBUGFORMAT_H
 
+#include <memory>
+
 #include <llvm/DebugInfo/DIContext.h>
 #include <llvm/DebugInfo/DWARF/DWARFContext.h>
 #include <llvm/Object/ObjectFile.h>
@@ -74,8 +76,9 @@ class DebugFormat
 		SymbolTable* _symtab = nullptr;
 		/// Underlying binary file representation.
 		retdec::loader::Image* _inFile = nullptr;
-		/// Underlying PDB representation.
-		retdec::pdbparser::PDBFile* _pdbFile = nullptr;
+		/// Underlying PDB representation. Released once its information
+		/// was converted into the containers below.
+		std::unique_ptr<retdec::pdbparser::PDBFile> _pdbFile;
 		/// Demangler.
 		retdec::bin2llvmir::Demangler* _demangler = nullptr;
 
@@ -30,6 +30,9 @@ public:
 		const ctypesparser::CTypesParser::TypeSignedness &typeSignedness,
 		unsigned defaultBitWidth) override;
 
+	std::size_t getContextSize() const;
+	void clearContext();
+
 private:
 	borland::Context _demangleContext;
 };
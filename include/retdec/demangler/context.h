@@ -7,6 +7,7 @@
 #ifndef RETDEC_CONTEXT_H
 #define RETDEC_CONTEXT_H
 
+#include <cstddef>
 #include <memory>
 #include <map>
 
@@ -177,6 +178,9 @@ public:
 	);
 	/// @}
 
+	std::size_t size() const;
+	void clear();
+
 private:
 	using BuiltInTypeNodes = std::map<
 		std::tuple<std::string, bool, bool>,
@@ -0,0 +1,28 @@
+/**
+ * @file include/retdec/demangler/stream_demangler.h
+ * @brief Demangling of streams of names.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_DEMANGLER_STREAM_DEMANGLER_H
+#define RETDEC_DEMANGLER_STREAM_DEMANGLER_H
+
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace retdec {
+namespace demangler {
+
+std::string demangleByScheme(const std::string &mangled);
+
+void demangleStream(
+	std::istream &in,
+	std::ostream &out,
+	std::size_t numOfThreads = 0);
+
+}
+}
+
+#endif //RETDEC_DEMANGLER_STREAM_DEMANGLER_H
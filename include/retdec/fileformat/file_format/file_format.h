@@ -7,15 +7,21 @@
 #ifndef RETDEC_FILEFORMAT_FILE_FORMAT_FILE_FORMAT_H
 #define RETDEC_FILEFORMAT_FILE_FORMAT_FILE_FORMAT_H
 
+#include <atomic>
 #include <fstream>
 #include <initializer_list>
 #include <map>
 #include <optional>
 #include <set>
+#include <shared_mutex>
 #include <utility>
 #include <vector>
 
+#include <llvm/ADT/ArrayRef.h>
+
 #include "retdec/utils/byte_value_storage.h"
+#include "retdec/utils/interval_index.h"
+#include "retdec/utils/memory_mapped_file.h"
 #include "retdec/utils/non_copyable.h"
 #include "retdec/fileformat/fftypes.h"
 #include "retdec/fileformat/utils/byte_array_buffer.h"
@@ -44,12 +50,31 @@ struct LoaderErrorInfo
 class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils::NonCopyable
 {
 	private:
+		retdec::utils::MemoryMappedFile mappedFile; ///< input file mapped into memory
 		byte_array_buffer auxBuff;               ///< auxiliary input buffer
 		std::ifstream auxFStream;                ///< auxiliary input file stream
 		std::istream auxIStream;                 ///< auxiliary input stream
-		std::vector<unsigned char> *loadedBytes; ///< reference to serialized content of input file
+		std::vector<unsigned char> readBytes;    ///< content of input file if it is not mapped into memory
+		llvm::ArrayRef<unsigned char> loadedBytes; ///< serialized content of input file
 		LoadFlags loadFlags;                     ///< load flags for configurable file loading
 
+		/**
+		 * Lazily built index of sections or segments by offset or address
+		 */
+		struct RegionIndex
+		{
+			retdec::utils::IntervalIndex<const SecSeg*> index; ///< index of regions
+			std::size_t numberOfRegions = 0;                     ///< number of regions when the index was built
+			std::uint64_t layoutVersion = 0;                     ///< layout version of regions when the index was built
+			bool isValid = false;                                ///< @c true if the index was built
+		};
+		mutable RegionIndex sectionOffsetIndex;  ///< index of sections by offset
+		mutable RegionIndex segmentOffsetIndex;  ///< index of segments by offset
+		mutable RegionIndex sectionAddressIndex; ///< index of sections by address
+		mutable RegionIndex segmentAddressIndex; ///< index of segments by address
+		mutable std::atomic<std::uint64_t> layoutVersion{0}; ///< incremented on change of offset, address or size of any indexed section or segment
+		mutable std::shared_mutex regionIndexMutex;          ///< guards (re)building of region indexes
+
 		/// @name Initialization methods
 		/// @{
 		void init();
@@ -74,7 +99,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		std::vector<SymbolTable*> symbolTables;                           ///< symbol tables
 		std::vector<RelocationTable*> relocationTables;                   ///< relocation tables
 		std::vector<DynamicTable*> dynamicTables;                         ///< tables with dynamic records
-		std::vector<unsigned char> bytes;                                 ///< content of file as bytes
+		llvm::ArrayRef<unsigned char> bytes;                              ///< content of file as bytes (mapped or read input file)
 		std::vector<String> strings;                                      ///< detected strings
 		std::vector<ElfNoteSecSeg> noteSecSegs;                           ///< note sections or segemnts found in ELF file
 		std::set<std::uint64_t> unknownRelocs;                            ///< unknown relocations
@@ -98,6 +123,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		/// @name Clear methods
 		/// @{
 		void clear();
+		void invalidateRegionIndexes();
 		/// @}
 
 		/// @name Protected detection methods
@@ -108,6 +134,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		/// @name Setters
 		/// @{
 		void setLoadedBytes(std::vector<unsigned char> *lBytes);
+		void appendBytes(const unsigned char *data, std::size_t size);
 		/// @}
 
 	public:
@@ -262,8 +289,8 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		const std::vector<SymbolTable*>& getSymbolTables() const;
 		const std::vector<RelocationTable*>& getRelocationTables() const;
 		const std::vector<DynamicTable*>& getDynamicTables() const;
-		const std::vector<unsigned char>& getBytes() const;
-		const std::vector<unsigned char>& getLoadedBytes() const;
+		llvm::ArrayRef<unsigned char> getBytes() const;
+		llvm::ArrayRef<unsigned char> getLoadedBytes() const;
 		const unsigned char* getBytesData() const;
 		const unsigned char* getLoadedBytesData() const;
 		const std::vector<String>& getStrings() const;
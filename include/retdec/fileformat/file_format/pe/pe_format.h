@@ -47,7 +47,7 @@ class PeFormat : public FileFormat
 		VisualBasicInfo visualBasicInfo;                           ///< visual basic header information
 
 		static const std::unordered_set<std::string> defDllList;   ///< Default set of DLLs for checking dependency missing
-		std::unordered_set<std::string> dllList;                   ///< Override set of DLLs for checking dependency missing
+		std::shared_ptr<const std::unordered_set<std::string>> dllList; ///< Override set of DLLs for checking dependency missing
 		bool errorLoadingDllList;                                  ///< If true, then an error happened while loading DLL list
 
 		/// @name Initialization methods
@@ -188,6 +188,7 @@ class PeFormat : public FileFormat
 		bool isMissingDependency(std::string dllname) const;
 		bool dllListFailedToLoad() const;
 		bool initDllList(const std::string & dllListFile);
+		static bool preloadDllList(const std::string & dllListFile);
 
 		int getPeClass() const;
 		bool isDotNet() const;
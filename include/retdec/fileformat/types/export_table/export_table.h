@@ -7,6 +7,9 @@
 #ifndef RETDEC_FILEFORMAT_TYPES_EXPORT_TABLE_EXPORT_TABLE_H
 #define RETDEC_FILEFORMAT_TYPES_EXPORT_TABLE_EXPORT_TABLE_H
 
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "retdec/fileformat/types/export_table/export.h"
@@ -16,6 +19,9 @@ namespace fileformat {
 
 /**
  * Table of exports
+ *
+ * Lookups by name and address use indexes which are built on the first lookup
+ * and dropped whenever exports are added or removed.
  */
 class ExportTable
 {
@@ -25,6 +31,17 @@ class ExportTable
 		std::string expHashCrc32;                   ///< exphash CRC32
 		std::string expHashMd5;                     ///< exphash MD5
 		std::string expHashSha256;                  ///< exphash SHA256
+		mutable std::unordered_map<std::string, std::size_t> nameIndex;               ///< positions of exports by their names
+		mutable std::vector<std::pair<unsigned long long, std::size_t>> addressIndex; ///< positions of exports sorted by their addresses
+		mutable bool nameIndexValid = false;                                          ///< @c true if @a nameIndex is up to date
+		mutable bool addressIndexValid = false;                                       ///< @c true if @a addressIndex is up to date
+
+		/// @name Auxiliary methods
+		/// @{
+		std::size_t findExport(const std::string &name) const;
+		std::size_t findExportOnAddress(unsigned long long address) const;
+		void invalidateIndexes();
+		/// @}
 	public:
 		/// @name Getters
 		/// @{
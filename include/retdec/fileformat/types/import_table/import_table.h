@@ -8,6 +8,9 @@
 #define RETDEC_FILEFORMAT_TYPES_IMPORT_TABLE_IMPORT_TABLE_H
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "retdec/fileformat/types/import_table/import.h"
@@ -17,6 +20,9 @@ namespace fileformat {
 
 /**
  * Table of imports
+ *
+ * Lookups by name and address use indexes which are built on the first lookup
+ * and dropped whenever imports are added or removed.
  */
 class ImportTable
 {
@@ -28,6 +34,17 @@ class ImportTable
 		std::string impHashCrc32;                     ///< imphash CRC32
 		std::string impHashMd5;                       ///< imphash MD5
 		std::string impHashSha256;                    ///< imphash SHA256
+		mutable std::unordered_map<std::string, std::size_t> nameIndex;               ///< positions of imports by their names
+		mutable std::vector<std::pair<unsigned long long, std::size_t>> addressIndex; ///< positions of imports sorted by their addresses
+		mutable bool nameIndexValid = false;                                          ///< @c true if @a nameIndex is up to date
+		mutable bool addressIndexValid = false;                                       ///< @c true if @a addressIndex is up to date
+
+		/// @name Auxiliary methods
+		/// @{
+		std::size_t findImport(const std::string &name) const;
+		std::size_t findImportOnAddress(unsigned long long address) const;
+		void invalidateIndexes();
+		/// @}
 	public:
 		/// @name Getters
 		/// @{
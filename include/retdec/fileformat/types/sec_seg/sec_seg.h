@@ -7,6 +7,8 @@
 #ifndef RETDEC_FILEFORMAT_TYPES_SEC_SEG_SEC_SEG_H
 #define RETDEC_FILEFORMAT_TYPES_SEC_SEG_SEC_SEG_H
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -54,7 +56,30 @@ class SecSeg
 		bool loaded = false;                  ///< @c true if content of section or segment was successfully loaded from input file
 		bool isEntropyValid = false;          ///< @c true if entropy has been computed
 
+		/**
+		 * Layout version of the file format whose indexes contain the section
+		 * or segment. A copy is not in any index, so the reference is not
+		 * copied.
+		 */
+		struct LayoutVersionRef
+		{
+			std::atomic<std::uint64_t> *version = nullptr;
+
+			LayoutVersionRef() = default;
+			LayoutVersionRef(const LayoutVersionRef&) {}
+			LayoutVersionRef& operator=(const LayoutVersionRef&)
+			{
+				if(version)
+				{
+					version->fetch_add(1, std::memory_order_relaxed);
+				}
+				return *this;
+			}
+		};
+		LayoutVersionRef layoutVersion;       ///< incremented on change of offset, address or size
+
 		void computeHashes();
+		void layoutChanged();
 	public:
 		virtual ~SecSeg() = default;
 
@@ -128,6 +153,7 @@ class SecSeg
 		void invalidateMemorySize();
 		void invalidateEntrySize();
 		void load(const FileFormat *sOwner);
+		void setLayoutVersion(std::atomic<std::uint64_t> *sVersion);
 		void dump(std::string &sDump) const;
 		bool hasCrc32() const;
 		bool hasMd5() const;
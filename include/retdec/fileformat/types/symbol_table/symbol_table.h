@@ -8,6 +8,9 @@
 #define RETDEC_FILEFORMAT_TYPES_SYMBOL_TABLE_SYMBOL_TABLE_H
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "retdec/fileformat/types/symbol_table/symbol.h"
@@ -17,6 +20,11 @@ namespace fileformat {
 
 /**
  * Class for symbol table
+ *
+ * Lookups by name, address and stored index use indexes which are built
+ * on the first lookup and dropped whenever symbols are added or removed.
+ * Non-const access to stored symbols (non-const getters and iterators) drops
+ * them too, because symbols may be changed through it.
  */
 class SymbolTable
 {
@@ -25,6 +33,20 @@ class SymbolTable
 		using symbolsIterator = std::vector<std::shared_ptr<Symbol>>::iterator;
 		std::vector<std::shared_ptr<Symbol>> table; ///< stored symbols
 		std::string name;                           ///< name of symbol table
+		mutable std::unordered_map<std::string, std::size_t> nameIndex;               ///< positions of symbols by their names
+		mutable std::vector<std::pair<unsigned long long, std::size_t>> addressIndex; ///< positions of symbols sorted by their addresses
+		mutable std::unordered_map<std::size_t, std::size_t> symbolIndexIndex;        ///< positions of symbols by their stored indexes
+		mutable bool nameIndexValid = false;                                          ///< @c true if @a nameIndex is up to date
+		mutable bool addressIndexValid = false;                                       ///< @c true if @a addressIndex is up to date
+		mutable bool symbolIndexIndexValid = false;                                   ///< @c true if @a symbolIndexIndex is up to date
+
+		/// @name Auxiliary methods
+		/// @{
+		std::size_t findSymbol(const std::string &name) const;
+		std::size_t findSymbolOnAddress(unsigned long long addr) const;
+		std::size_t findSymbolWithIndex(std::size_t symbolIndex) const;
+		void invalidateIndexes();
+		/// @}
 	public:
 		/// @name Const getters
 		/// @{
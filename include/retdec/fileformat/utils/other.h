@@ -7,6 +7,8 @@
 #ifndef RETDEC_FILEFORMAT_UTILS_OTHER_H
 #define RETDEC_FILEFORMAT_UTILS_OTHER_H
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -21,7 +23,11 @@ std::vector<std::string> getSupportedFileFormats();
 std::vector<std::string> getSupportedArchitectures();
 std::string lcidToStr(std::size_t lcid);
 std::string codePageToStr(std::size_t cpage);
+/// Number of occurrences of every byte value in data
+using ByteHistogram = std::array<std::size_t, 256>;
+
 double computeDataEntropy(const std::uint8_t *data, std::size_t dataLen);
+double computeHistogramEntropy(const ByteHistogram &histogram, std::size_t dataLen);
 
 } // namespace fileformat
 } // namespace retdec
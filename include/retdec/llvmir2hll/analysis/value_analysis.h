@@ -224,6 +224,7 @@ public:
 	/// @name Access To Alias Analysis
 	/// @{
 	void initAliasAnalysis(ShPtr<Module> module);
+	ShPtr<AliasAnalysis> getAliasAnalysis() const;
 	const VarSet &mayPointTo(ShPtr<Variable> var) const;
 	ShPtr<Variable> pointsTo(ShPtr<Variable> var) const;
 	bool mayBePointed(ShPtr<Variable> var) const;
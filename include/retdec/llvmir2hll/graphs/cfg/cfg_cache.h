@@ -0,0 +1,60 @@
+/**
+* @file include/retdec/llvmir2hll/graphs/cfg/cfg_cache.h
+* @brief A cache of control-flow graphs (CFGs) of functions.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_GRAPHS_CFG_CFG_CACHE_H
+#define RETDEC_LLVMIR2HLL_GRAPHS_CFG_CFG_CACHE_H
+
+#include <unordered_map>
+
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class CFG;
+class CFGBuilder;
+class Function;
+
+/**
+* @brief A cache of control-flow graphs (CFGs) of functions.
+*
+* The cache allows optimizations to share CFGs instead of building them from
+* scratch every time. Its users are responsible for keeping the cached CFGs
+* valid:
+*  - an optimization that gets a CFG from the cache and changes the function
+*    has to update the CFG (e.g. by CFG::replaceStmt() or CFG::removeStmt())
+*    or invalidate() it,
+*  - after running code that changes functions without knowing about the
+*    cache, invalidateAll() has to be called.
+*
+* Instances of this class have reference object semantics. The cache is not
+* thread-safe. This class is not meant to be subclassed.
+*/
+class CFGCache final: private retdec::utils::NonCopyable {
+public:
+	static ShPtr<CFGCache> create(ShPtr<CFGBuilder> cfgBuilder);
+
+	ShPtr<CFG> getCFG(ShPtr<Function> func);
+	bool hasCFG(ShPtr<Function> func) const;
+	void invalidate(ShPtr<Function> func);
+	void invalidateAll();
+
+private:
+	explicit CFGCache(ShPtr<CFGBuilder> cfgBuilder);
+
+private:
+	/// Builder of CFGs that are not in the cache.
+	ShPtr<CFGBuilder> cfgBuilder;
+
+	/// Cached CFGs of functions.
+	std::unordered_map<ShPtr<Function>, ShPtr<CFG>> cfgs;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
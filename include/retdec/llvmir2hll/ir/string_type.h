@@ -9,6 +9,7 @@
 
 #include <cstdint>
 #include <map>
+#include <mutex>
 
 #include "retdec/llvmir2hll/ir/type.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
@@ -50,6 +51,9 @@ private:
 	/// Set of already created string types with characters of the given size.
 	static SizeToStringTypeMap createdTypes;
 
+	/// Mutex guarding the set of already created types.
+	static std::mutex createdTypesMutex;
+
 private:
 	// Since instances are created by calling the static function create(), the
 	// constructor can be private.
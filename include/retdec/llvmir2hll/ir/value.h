@@ -7,12 +7,14 @@
 #ifndef RETDEC_LLVMIR2HLL_IR_VALUE_H
 #define RETDEC_LLVMIR2HLL_IR_VALUE_H
 
+#include <cstddef>
 #include <iosfwd>
 #include <string>
 
 #include <llvm/Support/raw_ostream.h>
 
 #include "retdec/llvmir2hll/support/metadatable.h"
+#include "retdec/llvmir2hll/support/node_pool.h"
 #include "retdec/llvmir2hll/support/observer.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/subject.h"
@@ -68,6 +70,19 @@ public:
 
 	std::string getTextRepr();
 
+	/// @name Allocation
+	/// @{
+	// Values are small and created in large numbers, so they are allocated
+	// from a pool instead of the general-purpose heap.
+	static void *operator new(std::size_t size) {
+		return NodePool::allocate(size);
+	}
+
+	static void operator delete(void *ptr, std::size_t size) {
+		NodePool::deallocate(ptr, size);
+	}
+	/// @}
+
 protected:
 	Value() = default;
 };
@@ -52,6 +52,7 @@ public:
 	/// @name Options
 	/// @{
 	void setOptionStrictFPUSemantics(bool strict = true);
+	void setOptionMaxStructuringWork(unsigned long long maxWork);
 	/// @}
 
 private:
@@ -95,6 +96,10 @@ private:
 	/// Use strict FPU semantics?
 	bool optionStrictFPUSemantics;
 
+	/// Maximal work spent on structuring of a single function (0 means no
+	/// limit).
+	unsigned long long optionMaxStructuringWork;
+
 	/// Should debugging messages be enabled?
 	bool enableDebug;
 
@@ -79,7 +79,14 @@ public:
 
 	ShPtr<Statement> convertFuncBody(llvm::Function &func);
 
+	/// @name Options
+	/// @{
+	void setOptionMaxWork(unsigned long long maxWork);
+	/// @}
+
 private:
+	class ReachabilityIndex;
+
 	/// @name Construction and traversal through control-flow graph
 	/// @{
 	ShPtr<CFGNode> createCFG(llvm::BasicBlock &root);
@@ -98,8 +105,7 @@ private:
 		std::function<bool (ShPtr<CFGNode>)> inspectFunc) const;
 	ShPtr<CFGNode> BFSFindFirst(ShPtr<CFGNode> cfg,
 		std::function<bool (ShPtr<CFGNode>)> pred) const;
-	bool existsPathWithoutLoopsBetween(const ShPtr<CFGNode> &node1,
-		const ShPtr<CFGNode> &node2) const;
+	bool isWorkLimitExceeded() const;
 	/// @}
 
 	/// @name Detection of constructions
@@ -171,9 +177,9 @@ private:
 	void reduceSwitchStatement(ShPtr<CFGNode> node);
 	ShPtr<CFGNode> getSwitchSuccessor(const ShPtr<CFGNode> &switchNode) const;
 	bool isNodeAfterAllSwitchClauses(const ShPtr<CFGNode> &node,
-		const ShPtr<CFGNode> &switchNode) const;
+		const ShPtr<CFGNode> &switchNode, ReachabilityIndex &index) const;
 	bool isNodeAfterSwitchClause(const ShPtr<CFGNode> &node,
-		const ShPtr<CFGNode> &clauseNode) const;
+		const ShPtr<CFGNode> &clauseNode, ReachabilityIndex &index) const;
 	bool hasDefaultClause(const ShPtr<CFGNode> &switchNode,
 		const ShPtr<CFGNode> &switchSuccessor) const;
 	bool isReducibleClause(const ShPtr<CFGNode> &clauseNode,
@@ -313,6 +319,13 @@ private:
 
 	/// The resulting module in BIR.
 	ShPtr<Module> resModule;
+
+	/// Maximal work (number of visited CFG nodes) spent on structuring of
+	/// a single function (0 means no limit).
+	unsigned long long optionMaxWork;
+
+	/// Work spent on structuring of the current function.
+	mutable unsigned long long work;
 };
 
 } // namespace llvmir2hll
@@ -0,0 +1,221 @@
+/**
+* @file include/retdec/llvmir2hll/llvmir2hll.h
+* @brief Convertor of LLVM IR into the specified target high-level language.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_LLVMIR2HLL_H
+#define RETDEC_LLVMIR2HLL_LLVMIR2HLL_H
+
+#include <string>
+
+#include <llvm/Pass.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "retdec/llvmir2hll/pattern/pattern_finder_runner.h"
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/types.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class AliasAnalysis;
+class ArithmExprEvaluator;
+class CallInfoObtainer;
+class Config;
+class HLLWriter;
+class Module;
+class Semantics;
+class VarNameGen;
+class VarRenamer;
+
+/**
+* @brief Parameters of the conversion of LLVM IR into the target HLL.
+*
+* The default values match the defaults of the @c retdec-llvmir2hll tool.
+* Each member corresponds to one of the tool's command-line parameters.
+*/
+struct LlvmIr2HllParams {
+	/// Name of the target HLL.
+	std::string targetHll = "c";
+	/// Output format.
+	std::string outputFormat = "plain";
+	/// Emit debugging messages, like information about the current phase.
+	bool debug = false;
+	/// The used semantics in the form 'sem1,sem2,...' (empty means that it
+	/// is created based on the data in the input LLVM IR).
+	std::string semantics;
+	/// Path to the configuration file (used only when no config object has
+	/// been given to the converter).
+	std::string configPath;
+	/// Emit debugging comments in the generated code.
+	bool emitDebugComments = false;
+	/// A comma separated list of optimizations to be enabled.
+	std::string enabledOpts;
+	/// A comma separated list of optimizations to be disabled.
+	std::string disabledOpts;
+	/// Disable all optimizations.
+	bool noOpts = false;
+	/// Enable aggressive optimizations.
+	bool aggressiveOpts = false;
+	/// Number of threads used to run function optimizations (0 means the
+	/// number of hardware threads).
+	unsigned optThreads = 1;
+	/// Disable renaming of variables.
+	bool noVarRenaming = false;
+	/// Disable conversion of constants into symbolic names.
+	bool noSymbolicNames = false;
+	/// Keep all brackets in the generated code.
+	bool keepAllBrackets = false;
+	/// Keep functions from standard libraries.
+	bool keepLibraryFunctions = false;
+	/// Do not emit time-varying information, like dates.
+	bool noTimeVaryingInfo = false;
+	/// Do not emit compound operators (like +=).
+	bool noCompoundOperators = false;
+	/// Validate the resulting module before generating the target code.
+	bool validateModule = false;
+	/// Comma-separated pattern finders to be run ("all" runs all of them).
+	std::string findPatterns;
+	/// Name of the used alias analysis.
+	std::string aliasAnalysis = "simple";
+	/// Name of the used generator of variable names.
+	std::string varNameGen = "fruit";
+	/// Prefix for all variable names returned by the generator.
+	std::string varNameGenPrefix;
+	/// Name of the used renamer of variable names.
+	std::string varRenamer = "readable";
+	/// Emit a control-flow graph for each function.
+	bool emitCFGs = false;
+	/// Name of the used CFG writer.
+	std::string cfgWriter = "dot";
+	/// Emit a call graph for the decompiled module.
+	bool emitCG = false;
+	/// Name of the used CG writer.
+	std::string cgWriter = "dot";
+	/// Name of the used obtainer of information about function calls.
+	std::string callInfoObtainer = "optim";
+	/// Name of the used evaluator of arithmetical expressions.
+	std::string arithmExprEvaluator = "c";
+	/// If nonempty, overwrites the module name detected by the front-end.
+	std::string forcedModuleName;
+	/// Force strict FPU semantics to be used.
+	bool strictFPUSemantics = false;
+	/// Maximal work (number of visited CFG nodes) spent on structuring of
+	/// a single function before it is structured by goto statements (0 means
+	/// no limit).
+	unsigned long long maxStructuringWork = 100000000;
+	/// Limit maximal memory to the given number of bytes (0 means no limit).
+	unsigned long long maxMemoryLimit = 0;
+	/// Limit maximal memory to half of system RAM.
+	bool maxMemoryLimitHalfRAM = false;
+	/// Base of the names of files into which CFGs and CGs are emitted.
+	std::string outputFilename;
+};
+
+/**
+* @brief This class is the main chunk of code that converts an LLVM
+*        module to the specified high-level language (HLL).
+*
+* The decompilation is composed of the following steps:
+* 1) The pass is instantiated with the output stream, where the target
+*    code will be emitted, and with the conversion parameters.
+* 2) The function runOnModule() is called, which decompiles the given
+*    LLVM IR into BIR (backend IR).
+* 3) The resulting IR is then converted into the requested HLL at the end of
+*    runOnModule().
+*
+* The pass requires @c llvm::LoopInfoWrapperPass and
+* @c llvm::ScalarEvolutionWrapperPass to be scheduled before it.
+*/
+class LlvmIr2Hll: public llvm::ModulePass {
+public:
+	LlvmIr2Hll(llvm::raw_pwrite_stream &out, const LlvmIr2HllParams &params,
+		ShPtr<Config> config = nullptr);
+
+	virtual llvm::StringRef getPassName() const override { return "Decompiler"; }
+	virtual bool runOnModule(llvm::Module &m) override;
+
+public:
+	/// Class identification.
+	static char ID;
+
+private:
+	virtual void getAnalysisUsage(llvm::AnalysisUsage &au) const override;
+
+	bool initialize(llvm::Module &m);
+	bool limitMaximalMemoryIfRequested();
+	void createSemantics();
+	void createSemanticsFromParameter();
+	void createSemanticsFromLLVMIR();
+	bool loadConfig();
+	void saveConfig();
+	bool convertLLVMIRToBIR();
+	void removeLibraryFuncs();
+	void removeCodeUnreachableInCFG();
+	void removeFuncsPrefixedWith(const StringSet &prefixes);
+	void fixSignedUnsignedTypes();
+	void convertLLVMIntrinsicFunctions();
+	void obtainDebugInfo();
+	void initAliasAnalysis();
+	void runOptimizations();
+	void renameVariables();
+	void convertConstantsToSymbolicNames();
+	void validateResultingModule();
+	void findPatterns();
+	void emitCFGs();
+	void emitCG();
+	void emitTargetHLLCode();
+	void finalize();
+	void cleanup();
+
+	StringSet parseListOfOpts(const std::string &opts) const;
+	std::string getTypeOfRunOptimizations() const;
+	StringVector getIdsOfPatternFindersToBeRun() const;
+	PatternFinderRunner::PatternFinders instantiatePatternFinders(
+		const StringVector &pfsIds);
+	ShPtr<PatternFinderRunner> instantiatePatternFinderRunner() const;
+	StringSet getPrefixesOfFuncsToBeRemoved() const;
+
+private:
+	/// Output stream into which the generated code will be emitted.
+	llvm::raw_pwrite_stream &out;
+
+	/// Parameters of the conversion.
+	const LlvmIr2HllParams params;
+
+	/// The input LLVM module.
+	llvm::Module *llvmModule;
+
+	/// The resulting module in BIR.
+	ShPtr<Module> resModule;
+
+	/// The used semantics.
+	ShPtr<Semantics> semantics;
+
+	/// The used config.
+	ShPtr<Config> config;
+
+	/// The used HLL writer.
+	ShPtr<HLLWriter> hllWriter;
+
+	/// The used alias analysis.
+	ShPtr<AliasAnalysis> aliasAnalysis;
+
+	/// The used obtainer of information about function and function calls.
+	ShPtr<CallInfoObtainer> cio;
+
+	/// The used evaluator of arithmetical expressions.
+	ShPtr<ArithmExprEvaluator> arithmExprEvaluator;
+
+	/// The used generator of variable names.
+	ShPtr<VarNameGen> varNameGen;
+
+	/// The used renamer of variables.
+	ShPtr<VarRenamer> varRenamer;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
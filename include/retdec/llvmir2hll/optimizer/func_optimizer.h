@@ -9,6 +9,7 @@
 
 #include "retdec/llvmir2hll/optimizer/optimizer.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/types.h"
 
 namespace retdec {
 namespace llvmir2hll {
@@ -37,11 +38,17 @@ class Module;
 *    (blocks).
 *
 * The functions are not optimized in any particular order. Optimizations for a
-* single function should not affect optimizations of other functions.
+* single function should not affect optimizations of other functions. The
+* optimization can be restricted to a subset of functions by calling
+* setFuncsToOptimize(), which allows to optimize disjoint subsets of functions
+* in parallel (see OptimizerManager).
 *
 * Instances of this class have reference object semantics.
 */
 class FuncOptimizer: public Optimizer {
+public:
+	void setFuncsToOptimize(const FuncVector &funcs);
+
 protected:
 	FuncOptimizer(ShPtr<Module> module);
 
@@ -70,6 +77,13 @@ protected:
 protected:
 	/// Function that is currently being optimized.
 	ShPtr<Function> currFunc;
+
+private:
+	/// Should only the functions in @c funcsToOptimize be optimized?
+	bool optimizeOnlySelectedFuncs;
+
+	/// Functions to be optimized (if @c optimizeOnlySelectedFuncs is set).
+	FuncVector funcsToOptimize;
 };
 
 } // namespace llvmir2hll
@@ -51,6 +51,16 @@ public:
 
 	ShPtr<Module> optimize();
 
+	/**
+	* @brief Returns @c true if the optimizer keeps the CFGs in the CFGCache
+	*        passed to it valid, @c false otherwise.
+	*
+	* Optimizers that do not know about any CFGCache may change the code
+	* arbitrarily, so all the cached CFGs have to be invalidated after they
+	* are run.
+	*/
+	virtual bool keepsCFGCacheValid() const { return false; }
+
 	/**
 	* @brief Creates an instance of OptimizerType with the given arguments and
 	*        optimizes the given module by it.
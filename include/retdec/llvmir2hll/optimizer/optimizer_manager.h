@@ -7,16 +7,21 @@
 #ifndef RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZER_MANAGER_H
 #define RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZER_MANAGER_H
 
+#include <cstddef>
+#include <vector>
+
 #include "retdec/llvmir2hll/optimizer/optimizer.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
 #include "retdec/llvm-support/diagnostics.h"
 #include "retdec/utils/non_copyable.h"
+#include "retdec/utils/thread_pool.h"
 
 namespace retdec {
 namespace llvmir2hll {
 
 class ArithmExprEvaluator;
+class CFGCache;
 class CallInfoObtainer;
 class HLLWriter;
 class Module;
@@ -25,6 +30,11 @@ class ValueAnalysis;
 /**
 * @brief A manager managing optimizations.
 *
+* When more than one thread is requested, function-local optimizations that
+* do not depend on shared state are run in parallel over disjoint sets of
+* functions. All the other optimizations act as barriers and are run over the
+* whole module in the calling thread.
+*
 * Instances of this class have reference object semantics. This class is not
 * meant to be subclassed.
 */
@@ -33,7 +43,8 @@ public:
 	OptimizerManager(const StringSet &enabledOpts, const StringSet &disabledOpts,
 		ShPtr<HLLWriter> hllWriter, ShPtr<ValueAnalysis> va,
 		ShPtr<CallInfoObtainer> cio, ShPtr<ArithmExprEvaluator> arithmExprEvaluator,
-		bool enableAggressiveOpts, bool enableDebug = false);
+		bool enableAggressiveOpts, bool enableDebug = false,
+		std::size_t numOfThreads = 1);
 
 	void optimize(ShPtr<Module> m);
 
@@ -41,11 +52,26 @@ private:
 	void printOptimization(const std::string &optName) const;
 	bool optShouldBeRun(const std::string &optName) const;
 	void runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimizer);
+	void runOptimizersInParallelProvidedTheyShouldBeRun(
+		const std::vector<ShPtr<Optimizer>> &optimizers);
 	bool shouldSecondCopyPropagationBeRun() const;
+	std::vector<FuncVector> splitFuncsIntoChunks(ShPtr<Module> m) const;
 
 	template<typename Optimization, typename... Args>
 	void run(ShPtr<Module> m, Args &&... args);
 
+	template<typename Optimization, typename... Args>
+	void runPerFunc(ShPtr<Module> m, Args &&... args);
+
+	/**
+	* @brief Returns an argument for an optimizer run in a worker thread.
+	*
+	* Arguments without any mutable state can be shared between threads.
+	*/
+	template<typename T>
+	static const T &getArgForWorker(const T &arg) { return arg; }
+	ShPtr<ValueAnalysis> getArgForWorker(const ShPtr<ValueAnalysis> &va) const;
+
 private:
 	/// No other optimization than these will be run.
 	const StringSet enabledOpts;
@@ -65,6 +91,9 @@ private:
 	/// Used evaluator of arithmetical expressions.
 	ShPtr<ArithmExprEvaluator> arithmExprEvaluator;
 
+	/// CFGs shared by optimizations that keep them valid.
+	ShPtr<CFGCache> cfgCache;
+
 	/// Enable aggressive optimizations?
 	bool enableAggressiveOpts;
 
@@ -76,6 +105,10 @@ private:
 
 	/// List of our optimizations that were run.
 	StringSet backendRunOpts;
+
+	/// Threads running function optimizations in parallel (null if the
+	/// optimizations are run sequentially).
+	UPtr<retdec::utils::ThreadPool> threadPool;
 };
 
 } // namespace llvmir2hll
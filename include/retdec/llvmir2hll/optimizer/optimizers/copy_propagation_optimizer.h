@@ -16,7 +16,7 @@ namespace retdec {
 namespace llvmir2hll {
 
 class CallInfoObtainer;
-class CFGBuilder;
+class CFGCache;
 class UseDefAnalysis;
 class UseDefChains;
 class ValueAnalysis;
@@ -64,9 +64,10 @@ class VarUsesVisitor;
 class CopyPropagationOptimizer final: public FuncOptimizer {
 public:
 	CopyPropagationOptimizer(ShPtr<Module> module, ShPtr<ValueAnalysis> va,
-		ShPtr<CallInfoObtainer> cio);
+		ShPtr<CallInfoObtainer> cio, ShPtr<CFGCache> cfgCache = nullptr);
 
 	virtual std::string getId() const override { return "CopyPropagation"; }
+	virtual bool keepsCFGCacheValid() const override { return true; }
 
 private:
 	virtual void doOptimization() override;
@@ -97,8 +98,8 @@ private:
 	bool shouldBeIncludedInDefUseChains(ShPtr<Variable> var);
 
 private:
-	/// The used builder of CFGs.
-	ShPtr<CFGBuilder> cfgBuilder;
+	/// Cache of CFGs of functions.
+	ShPtr<CFGCache> cfgCache;
 
 	/// Analysis of values.
 	ShPtr<ValueAnalysis> va;
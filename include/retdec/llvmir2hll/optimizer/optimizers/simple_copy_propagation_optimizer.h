@@ -16,7 +16,7 @@ namespace retdec {
 namespace llvmir2hll {
 
 class CFG;
-class CFGBuilder;
+class CFGCache;
 class CallInfoObtainer;
 class ValueAnalysis;
 class VarUsesVisitor;
@@ -66,9 +66,10 @@ class VarUsesVisitor;
 class SimpleCopyPropagationOptimizer final: public FuncOptimizer {
 public:
 	SimpleCopyPropagationOptimizer(ShPtr<Module> module, ShPtr<ValueAnalysis> va,
-		ShPtr<CallInfoObtainer> cio);
+		ShPtr<CallInfoObtainer> cio, ShPtr<CFGCache> cfgCache = nullptr);
 
 	virtual std::string getId() const override { return "SimpleCopyPropagation"; }
+	virtual bool keepsCFGCacheValid() const override { return true; }
 
 private:
 	virtual void doOptimization() override;
@@ -90,8 +91,8 @@ private:
 	using VarUSet = std::unordered_set<ShPtr<Variable>>;
 
 private:
-	/// The used builder of CFGs.
-	ShPtr<CFGBuilder> cfgBuilder;
+	/// Cache of CFGs of functions.
+	ShPtr<CFGCache> cfgCache;
 
 	/// Analysis of values.
 	ShPtr<ValueAnalysis> va;
@@ -9,8 +9,10 @@
 
 #include <cstddef>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 
-#include "retdec/llvmir2hll/support/types.h"
 #include "retdec/utils/array.h"
 
 /**
@@ -31,9 +33,14 @@ namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
+/// Mapping of a function name into the name of its header file.
+///
+/// Both the names are statically allocated, so they are not copied.
+using FuncCHeaderMap = std::unordered_map<std::string_view, std::string_view>;
+
 std::optional<std::string> getCHeaderFileForFuncFromMap(
 		const std::string &funcName,
-		const StringStringUMap &map);
+		const FuncCHeaderMap &map);
 
 } // namespace semantics
 } // namespace llvmir2hll
@@ -8,36 +8,71 @@
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_NAME_OF_PARAM_H
 
 #include <cstddef>
+#include <initializer_list>
+#include <mutex>
 #include <optional>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <vector>
+
+#include <llvm/ADT/ArrayRef.h>
 
 /**
 * @brief Sets a name of the given parameter for the given function.
+*
+* It is used in initializers of arrays of FuncParamName.
 */
 #define ADD_PARAM_NAME(funcName, paramPos, paramName) \
-	funcParamNamesMap[FuncParamPosPair(funcName, paramPos)] = paramName;
+	FuncParamName{funcName, paramPos, paramName},
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
-/// A pair of function name and parameter position.
-using FuncParamPosPair = std::pair<std::string, unsigned>;
-
 /**
-* @brief A hashing functor for FuncParamPosPair.
+* @brief A name of a parameter of a function.
+*
+* Arrays of these are constant-initialized, so they are placed into read-only
+* data and cost nothing upon startup.
 */
-struct FuncParamPosPairHasher {
-	std::size_t operator()(const FuncParamPosPair &p) const {
-		return std::hash<std::string>()(p.first) + p.second;
-	}
+struct FuncParamName {
+	std::string_view funcName;
+	unsigned paramPos;
+	std::string_view paramName;
 };
 
-/// Mapping of a function name and parameter position into the name of this
-/// parameter.
-using FuncParamNamesMap = std::unordered_map<FuncParamPosPair, std::string,
-	FuncParamPosPairHasher>;
+/// A part of a database of parameter names.
+using FuncParamNames = llvm::ArrayRef<FuncParamName>;
+
+/**
+* @brief A read-only database of parameter names composed of several arrays of
+*        FuncParamName.
+*
+* The names are not copied. An index for binary search (one pointer per name)
+* is built upon the first query, so a program that does not query the
+* database does not pay anything for it. When a parameter has more names, the
+* last one (in the order of the parts) is used.
+*/
+class FuncParamNamesMap {
+public:
+	FuncParamNamesMap(std::initializer_list<FuncParamNames> parts);
+
+	std::optional<std::string> find(const std::string &funcName,
+		unsigned paramPos) const;
+
+private:
+	void buildIndex() const;
+
+private:
+	/// Parts of the database.
+	std::vector<FuncParamNames> parts;
+
+	/// Has the index been built?
+	mutable std::once_flag indexBuilt;
+
+	/// Names sorted by the function name and parameter position.
+	mutable std::vector<const FuncParamName *> index;
+};
 
 std::optional<std::string> getNameOfParamFromMap(const std::string &funcName,
 	unsigned paramPos, const FuncParamNamesMap &map);
@@ -1,6 +1,6 @@
 /**
 * @file include/retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/g2.h
-* @brief Initializes FuncParamNamesMap for WinAPI functions starting with G
+* @brief Names of parameters of WinAPI functions starting with G
 *        (second part).
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
@@ -15,7 +15,7 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-void initFuncParamNamesMap_G2(FuncParamNamesMap &funcParamNamesMap);
+FuncParamNames getFuncParamNames_G2();
 
 } // namespace win_api
 } // namespace semantics
@@ -0,0 +1,42 @@
+/**
+* @file include/retdec/llvmir2hll/support/node_pool.h
+* @brief A pool allocator for small, frequently created IR nodes.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SUPPORT_NODE_POOL_H
+#define RETDEC_LLVMIR2HLL_SUPPORT_NODE_POOL_H
+
+#include <cstddef>
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief A pool allocator for small, frequently created IR nodes.
+*
+* Memory is carved from large chunks into blocks of a few fixed sizes, so
+* creating a node is usually just popping a block from a free list instead of
+* a call to the general-purpose allocator. Every thread has its own cache of
+* free blocks, so no locking is needed in the common case; blocks freed in a
+* different thread than they were allocated in are simply reused there.
+*
+* Chunks are never returned to the system. Blocks of destroyed nodes are
+* reused by new nodes of the same size class, so the memory consumption is
+* bounded by the peak number of living nodes.
+*
+* Requests larger than the largest size class are passed to the global
+* <tt>operator new</tt>.
+*/
+class NodePool {
+public:
+	NodePool() = delete;
+
+	static void *allocate(std::size_t size);
+	static void deallocate(void *ptr, std::size_t size);
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -8,13 +8,48 @@
 #define RETDEC_LLVMIR2HLL_SUPPORT_SUBJECT_H
 
 #include <algorithm>
-#include <vector>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include <llvm/ADT/SmallVector.h>
 
 #include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/utils/non_copyable.h"
 
 namespace retdec {
 namespace llvmir2hll {
 
+/**
+* @brief Marks a part of the run in which the IR is modified from several
+*        threads at once.
+*
+* Lists of observers of subjects are locked only while an instance of this
+* class exists. In sequential runs, there is nothing to guard, so subjects do
+* not pay for any locking.
+*
+* Instances have to be created before the threads start to modify the IR and
+* destroyed after all of them have finished.
+*/
+class ParallelIRModification: private retdec::utils::NonCopyable {
+public:
+	ParallelIRModification() { ++numOfActive; }
+	~ParallelIRModification() { --numOfActive; }
+
+	/**
+	* @brief Returns @c true if the IR may be modified from several threads
+	*        at once, @c false otherwise.
+	*/
+	static bool isActive() {
+		return numOfActive.load(std::memory_order_relaxed) > 0;
+	}
+
+private:
+	/// Number of existing instances.
+	static inline std::atomic<std::size_t> numOfActive{0};
+};
+
 /**
 * @brief Implementation of a generic typed observer using shared pointers
 *        (subject part).
@@ -37,6 +72,12 @@ namespace llvmir2hll {
 * };
 * @endcode
 *
+* Adding, removing, and notifying observers is thread-safe while there is a
+* ParallelIRModification instance, so values shared between functions (e.g.
+* global variables) can be observed by expressions that are created and
+* modified in parallel. However, observer_begin() and observer_end() do not
+* lock anything.
+*
 * @see Observer
 */
 template<typename SubjectType, typename ArgType = SubjectType>
@@ -89,6 +130,7 @@ public:
 	* @param[in] observer Observer to be added.
 	*/
 	void addObserver(ObserverPtr observer) {
+		auto lock = lockObservers();
 		observers.push_back(observer);
 	}
 
@@ -105,6 +147,7 @@ public:
 	* @brief Removes all observers.
 	*/
 	void removeObservers() {
+		auto lock = lockObservers();
 		observers.clear();
 	}
 
@@ -125,7 +168,12 @@ public:
 	void notifyObservers(ShPtr<ArgType> arg = nullptr) {
 		// We have to iterate over a copy of the container because it can be
 		// modified during the iteration (either by us or in an update() call).
-		for (const auto &observer : ObserverContainer(observers)) {
+		ObserverContainer observersCopy;
+		{
+			auto lock = lockObservers();
+			observersCopy = observers;
+		}
+		for (const auto &observer : observersCopy) {
 			notifyObserverOrRemoveItIfNotExists(observer, arg);
 		}
 	}
@@ -133,8 +181,9 @@ public:
 protected:
 	/// A container to store observers.
 	// Note that the used container has to preserve the order in which
-	// observers are added to it.
-	using ObserverContainer = std::vector<ObserverPtr>;
+	// observers are added to it. Most subjects (e.g. subexpressions) are
+	// observed just by their parent, so a single observer is stored inline.
+	using ObserverContainer = llvm::SmallVector<ObserverPtr, 1>;
 
 	// Observer iterator.
 	using observer_iterator = typename ObserverContainer::const_iterator;
@@ -189,11 +238,39 @@ private:
 	* @brief Removes the given observer and all the non-existing observers.
 	*/
 	void removeObserverAndNonExistingObservers(ObserverPtr observer) {
+		auto lock = lockObservers();
 		observers.erase(std::remove_if(observers.begin(), observers.end(),
 			[&observer](const auto &other) {
 				return other.expired() || observer.lock() == other.lock();
 			}
-		));
+		), observers.end());
+	}
+
+	/**
+	* @brief Locks the list of observers if the IR may be modified from several
+	*        threads at once.
+	*
+	* @see ParallelIRModification
+	*/
+	std::unique_lock<std::mutex> lockObservers() const {
+		if (!ParallelIRModification::isActive()) {
+			return std::unique_lock<std::mutex>();
+		}
+		return std::unique_lock<std::mutex>(getObserversMutex());
+	}
+
+	/**
+	* @brief Returns the mutex guarding the list of observers.
+	*
+	* Having a mutex in every subject would considerably increase the size of
+	* the IR, so the subjects share a fixed number of mutexes, selected by
+	* their address.
+	*/
+	std::mutex &getObserversMutex() const {
+		static std::array<std::mutex, 64> mutexes;
+		// The lowest bits are the same for all subjects due to alignment.
+		auto address = reinterpret_cast<std::uintptr_t>(this);
+		return mutexes[(address >> 4) % mutexes.size()];
 	}
 
 private:
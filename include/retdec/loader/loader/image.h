@@ -7,9 +7,12 @@
 #ifndef RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 #define RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 
+#include <atomic>
 #include <memory>
+#include <shared_mutex>
 
 #include "retdec/utils/byte_value_storage.h"
+#include "retdec/utils/interval_index.h"
 #include "retdec/fileformat/fftypes.h"
 #include "retdec/fileformat/file_format/file_format.h"
 #include "retdec/loader/loader/segment.h"
@@ -88,9 +91,19 @@ private:
 	const Segment* _getSegment(const std::string& name) const;
 	const Segment* _getSegmentWithIndex(std::size_t index) const;
 	const Segment* _getSegmentFromAddress(std::uint64_t address) const;
+	void invalidateSegmentIndex();
 
 	std::shared_ptr<retdec::fileformat::FileFormat> _fileFormat;
 	std::vector<std::unique_ptr<Segment>> _segments;
+	/// Segments by address, built lazily. The first segment in @c _segments wins.
+	mutable retdec::utils::IntervalIndex<const Segment*> _segmentIndex;
+	/// Incremented whenever segments are added, removed, reordered, resized or shrunk.
+	std::atomic<std::uint64_t> _segmentLayoutVersion{0};
+	/// Layout version of segments when @c _segmentIndex was built.
+	mutable std::uint64_t _segmentIndexVersion = 0;
+	mutable bool _segmentIndexValid = false;
+	/// Guards building of @c _segmentIndex, lookups may run in more threads at once.
+	mutable std::shared_mutex _segmentIndexMutex;
 	std::uint64_t _baseAddress;
 	NameGenerator _namelessSegNameGen;
 	std::string _statusMessage;
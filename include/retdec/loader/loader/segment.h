@@ -7,6 +7,7 @@
 #ifndef RETDEC_LOADER_RETDEC_LOADER_SEGMENT_H
 #define RETDEC_LOADER_RETDEC_LOADER_SEGMENT_H
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -57,6 +58,13 @@ public:
 	void addNonDecodableRange(retdec::common::Range<std::uint64_t> range);
 
 private:
+	friend class Image;
+
+	void layoutChanged();
+
+	/// Layout version of the image containing the segment, not copied.
+	std::atomic<std::uint64_t>* _layoutVersion = nullptr;
+
 	const retdec::fileformat::SecSeg* _secSeg;
 	std::uint64_t _address;
 	std::uint64_t _size;
@@ -0,0 +1,74 @@
+/**
+ * @file include/retdec/loader/utils/pointer_scanner.h
+ * @brief Declaration of scanner of pointers stored in segments.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_LOADER_UTILS_POINTER_SCANNER_H
+#define RETDEC_LOADER_UTILS_POINTER_SCANNER_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace retdec {
+namespace loader {
+
+class Image;
+class Segment;
+
+/**
+ * Scanner of words stored in segments of an image.
+ *
+ * Words of a segment are the word-sized values on addresses
+ * <tt>segment start + i * word size</tt>. The scanner reads them directly from
+ * the raw data of the segment and classifies all of them in one pass against
+ * the sorted address ranges of segments, instead of looking up the segment of
+ * every word and of every value. The results are the same as those of
+ * Image::getWord() and Image::isPointer() on the same addresses.
+ *
+ * Images that the fast path cannot handle (overlapping segments, bytes that
+ * are not 8 bits long, unknown endianness) are scanned word by word through
+ * the image.
+ *
+ * The scanner works with the segments the image has when it is created, so
+ * it has to be created again after segments change.
+ */
+class PointerScanner
+{
+public:
+	/**
+	 * Kinds of words, a word can be of more kinds at once.
+	 */
+	enum Kind : std::uint8_t
+	{
+		READABLE = 1 << 0, ///< Word can be read, see Image::getWord().
+		ZERO = 1 << 1, ///< Word is readable and its value is zero.
+		POINTER = 1 << 2 ///< Word is a pointer, see Image::isPointer().
+	};
+
+	explicit PointerScanner(const Image* image);
+
+	std::uint64_t getWordSize() const;
+
+	void classify(const Segment* segment, std::vector<std::uint8_t>& kinds) const;
+	std::vector<std::uint64_t> findPointers(const Segment* segment) const;
+
+private:
+	bool isPointerValue(std::uint64_t value) const;
+	void classifyByImage(const Segment* segment, std::vector<std::uint8_t>& kinds) const;
+	std::uint8_t classifyByImage(std::uint64_t address) const;
+	void classifyByRanges(const std::vector<std::uint64_t>& values, std::uint8_t* kinds) const;
+
+	const Image* _image; ///< Scanned image.
+	std::uint64_t _wordSize = 0; ///< Size of words in bytes.
+	bool _littleEndian = false; ///< Whether words are little endian.
+	bool _fast = false; ///< Whether words can be read from raw data.
+	/// Sorted disjoint ranges <tt>[start, end)</tt> of addresses pointers can point to.
+	std::vector<std::pair<std::uint64_t, std::uint64_t>> _ranges;
+};
+
+} // namespace loader
+} // namespace retdec
+
+#endif
@@ -11,6 +11,7 @@
 #include "retdec/pdbparser/pdb_symbols.h"
 #include "retdec/pdbparser/pdb_types.h"
 #include "retdec/pdbparser/pdb_utils.h"
+#include "retdec/utils/memory_mapped_file.h"
 
 namespace retdec {
 namespace pdbparser {
@@ -152,13 +153,7 @@ class PDBFile
 		{
 			return pdb_version;
 		}
-		PDBStream * get_stream(unsigned int num)
-		{
-			if (num < num_streams)
-				return &streams[num];
-			else
-				return nullptr;
-		}
+		PDBStream * get_stream(unsigned int num);
 		const char * get_module_name(unsigned int num)
 		{
 			if (num < modules.size())
@@ -166,25 +161,21 @@ class PDBFile
 			else
 				return nullptr;
 		}
-		PDBTypes * get_types_container(void)
-		{
-			return pdb_types;
-		}
-		PDBSymbols * get_symbols_container(void)
-		{
-			return pdb_symbols;
-		}
+		PDBTypes * get_types_container(void);
+		PDBSymbols * get_symbols_container(void);
 		PDBFunctionAddressMap * get_functions(void)
 		{
-			if (pdb_symbols != nullptr)
-				return &pdb_symbols->get_functions();
+			PDBSymbols *symbols = get_symbols_container();
+			if (symbols != nullptr)
+				return &symbols->get_functions();
 			else
 				return nullptr;
 		}
 		PDBGlobalVarAddressMap * get_global_variables(void)
 		{
-			if (pdb_symbols != nullptr)
-				return &pdb_symbols->get_global_variables();
+			PDBSymbols *symbols = get_symbols_container();
+			if (symbols != nullptr)
+				return &symbols->get_global_variables();
 			else
 				return nullptr;
 		}
@@ -198,6 +189,7 @@ class PDBFile
 	private:
 		// Internal functions
 		bool stream_is_linear(PDB_DWORD *pages, int num_pages);
+		bool stream_is_in_file(PDB_DWORD *pages, int num_pages);
 		char * extract_stream(PDB_DWORD *pages, int num_pages);
 		PDBFileState load_pdb_v200(void);
 		PDBFileState load_pdb_v700(void);
@@ -211,7 +203,8 @@ class PDBFile
 		unsigned int pdb_version;
 		unsigned int page_size;
 		unsigned int pdb_file_size;
-		char * pdb_file_data;
+		char * pdb_file_data;  // mapped content of PDB file
+		retdec::utils::MemoryMappedFile pdb_file;
 		unsigned int num_streams;
 		int pdb_fpo_num;
 		int pdb_newfpo_num;
@@ -13,6 +13,8 @@
 
 #include "retdec/common/basic_block.h"
 #include "retdec/common/function.h"
+#include "retdec/config/config.h"
+#include "retdec/llvmir2hll/llvmir2hll.h"
 
 namespace retdec {
 
@@ -39,6 +41,44 @@ LlvmModuleContextPair disassemble(
 		const std::string& inputPath,
 		retdec::common::FunctionSet* fs = nullptr);
 
+/**
+ * Decompile the input file into the target high-level language.
+ *
+ * The whole bin2llvmir pipeline and the llvmir2hll conversion run in this
+ * process, on the same LLVM module. Unlike in the script-driven decompilation,
+ * the module is not written into bitcode and parsed again, and the config is
+ * not saved into a file between the two parts.
+ *
+ * \param[in,out] config    Decompilation config. Its input file has to be
+ *                          set. On success, it is updated with everything
+ *                          bin2llvmir found out about the input.
+ * \param[in]     params    Parameters of the conversion into the target HLL.
+ * \param[out]    outString If not \c nullptr, filled with the generated code.
+ * \return \c true if the decompilation succeeded, \c false otherwise.
+ */
+bool decompile(
+		retdec::config::Config& config,
+		const retdec::llvmir2hll::LlvmIr2HllParams& params =
+				retdec::llvmir2hll::LlvmIr2HllParams(),
+		std::string* outString = nullptr);
+
+/**
+ * Load data that do not depend on the decompiled input (library type
+ * information, precompiled static code signatures, compiler detection rules
+ * and the PE DLL list) into process-wide caches.
+ *
+ * Decompilations and detections run later in this process, or in processes
+ * forked from it, then reuse the loaded data instead of loading them again.
+ *
+ * \param[in] config      Config whose parameters specify the data to load.
+ * \param[in] dllListFile File with the list of present DLLs. Nothing is
+ *                        loaded if it is empty.
+ * \return \c false if the DLL list cannot be loaded, \c true otherwise.
+ */
+bool preloadStaticData(
+		const retdec::config::Config& config,
+		const std::string& dllListFile = std::string());
+
 } // namespace retdec
 
 #endif
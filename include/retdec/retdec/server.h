@@ -0,0 +1,37 @@
+/**
+ * \file include/retdec/retdec/server.h
+ * \brief Decompilation server.
+ * \copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_RETDEC_SERVER_H
+#define RETDEC_RETDEC_SERVER_H
+
+#include <string>
+
+#include "retdec/config/config.h"
+
+namespace retdec {
+
+/**
+ * Run the decompilation server on \p socketPath.
+ *
+ * Data shared by all decompilations are loaded by preloadStaticData() before
+ * any request is accepted. Each request is a single line with a path to the
+ * config of the decompilation. The generated code is written into the
+ * config's output file, and the updated config is written back. The server
+ * answers with "OK" or "ERROR <message>".
+ *
+ * \param[in] socketPath  Path of the Unix domain socket to listen on.
+ * \param[in] baseConfig  Config specifying the shared data (LTI files, etc.).
+ * \param[in] dllListFile File with the list of present DLLs, may be empty.
+ * \return Process exit code. Returns only when the server fails.
+ */
+int runServer(
+		const std::string& socketPath,
+		const retdec::config::Config& baseConfig,
+		const std::string& dllListFile = std::string());
+
+} // namespace retdec
+
+#endif
@@ -18,6 +18,10 @@
 #include "retdec/fileformat/fileformat.h"
 #include "retdec/common/address.h"
 
+namespace yaracpp {
+	class YaraDetector;
+} // namespace yaracpp
+
 namespace retdec {
 namespace loader {
 	class Image;
@@ -120,13 +124,16 @@ class Finder
 				const std::string& yaraFile);
 		void search(
 				const retdec::loader::Image& image,
-				const std::set<std::string>& yaraFiles);
+				const std::set<std::string>& yaraFiles,
+				const std::string& cacheDirectory = std::string());
 		void search(
 				const retdec::loader::Image& image,
 				const retdec::config::Config& config);
 		void searchAndConfirm(
 				const retdec::loader::Image& image,
 				const retdec::config::Config& config);
+		static void preloadSignatures(
+				const std::set<std::string>& yaraFiles);
 		/// @}
 
 		/// @name Getters.
@@ -159,6 +166,10 @@ class Finder
 		using ByteData = typename std::pair<const std::uint8_t*, std::size_t>;
 
 	private:
+		void search(
+				const retdec::fileformat::FileFormat* fileFormat,
+				yaracpp::YaraDetector& detector,
+				const std::string& signaturePath = std::string());
 		bool initDisassembler();
 		void solveReferences();
 
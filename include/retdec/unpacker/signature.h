@@ -148,6 +148,7 @@ public:
 
 	uint64_t getSize() const;
 	uint64_t getCaptureSize() const;
+	const std::vector<Signature::Byte>& getBytes() const;
 
 	bool match(const MatchSettings& settings, retdec::loader::Image* file) const;
 	bool match(const MatchSettings& settings, const retdec::utils::DynamicBuffer& data) const;
@@ -0,0 +1,89 @@
+/**
+ * @file include/retdec/unpacker/signature_matcher.h
+ * @brief Declaration of class for matching multiple signatures at once.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UNPACKER_SIGNATURE_MATCHER_H
+#define RETDEC_UNPACKER_SIGNATURE_MATCHER_H
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "retdec/loader/loader.h"
+#include "retdec/unpacker/signature.h"
+#include "retdec/utils/dynamic_buffer.h"
+
+namespace retdec {
+namespace unpacker {
+
+/**
+ * Class for matching a set of signatures against the same data in a single scan.
+ *
+ * Every signature is added together with its search distance (see Signature::MatchSettings) and gets an ID,
+ * which is the order in which it was added. Matching then returns the ID of the first signature (the lowest ID)
+ * that matches the data, the same result as if the signatures were matched one by one in their order.
+ *
+ * Every signature is indexed by its anchor - the first two consecutive exact bytes. The data are scanned only
+ * once and full signatures are compared only at positions where their anchor occurs. Signatures without
+ * an anchor (e.g. consisting only of wildcards) are compared at every position of their search range.
+ */
+class SignatureMatcher
+{
+public:
+	/**
+	 * Filter of signatures to match. Only signatures for which it returns true are matched.
+	 */
+	using Filter = std::function<bool(std::size_t)>;
+
+	SignatureMatcher() = default;
+
+	std::size_t addSignature(const Signature* signature, uint64_t searchDistance = 0);
+	std::size_t getNumberOfSignatures() const;
+
+	bool match(uint64_t offset, retdec::loader::Image* file, std::size_t& id,
+				retdec::utils::DynamicBuffer& capturedData, const Filter& filter = Filter()) const;
+	bool match(uint64_t offset, const retdec::utils::DynamicBuffer& data, std::size_t& id,
+				retdec::utils::DynamicBuffer& capturedData, const Filter& filter = Filter()) const;
+	bool match(uint64_t offset, const std::vector<uint8_t>& data, std::size_t& id,
+				retdec::utils::DynamicBuffer& capturedData, const Filter& filter = Filter()) const;
+
+private:
+	/**
+	 * Signature with its matching settings.
+	 */
+	struct Entry
+	{
+		const Signature* signature; ///< Matched signature.
+		uint64_t searchDistance; ///< Maximum search distance, 0 means no searching.
+		uint64_t anchorOffset; ///< Offset of the anchor in the signature.
+		bool hasAnchor; ///< Whether the signature has an anchor.
+	};
+
+	/**
+	 * Occurrence of an anchor in a signature.
+	 */
+	struct Anchor
+	{
+		std::size_t id; ///< ID of the signature.
+		uint64_t offset; ///< Offset of the anchor in the signature.
+	};
+
+	static uint64_t getNumberOfStarts(const Entry& entry);
+	static bool matchAt(const Entry& entry, const std::vector<uint8_t>& data, uint64_t start);
+	static void capture(const Entry& entry, const std::vector<uint8_t>& data, uint64_t start,
+				retdec::utils::DynamicBuffer& capturedData);
+
+	std::vector<Entry> _entries; ///< All signatures ordered by their IDs.
+	std::unordered_map<uint16_t, std::vector<Anchor>> _anchors; ///< Signatures indexed by their anchors.
+	std::vector<std::size_t> _unanchored; ///< Signatures without an anchor.
+	uint64_t _scanLength = 0; ///< Number of positions to scan to find all signatures.
+	uint64_t _maxMatchLength = 0; ///< Maximum number of bytes needed to match any signature.
+};
+
+} // namespace unpacker
+} // namespace retdec
+
+#endif
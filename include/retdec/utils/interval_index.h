@@ -0,0 +1,160 @@
+/**
+* @file include/retdec/utils/interval_index.h
+* @brief Index of possibly overlapping intervals for fast point queries.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_INTERVAL_INDEX_H
+#define RETDEC_UTILS_INTERVAL_INDEX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <vector>
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Index of possibly overlapping half-open intervals mapping a point to
+*        the value of the interval containing it.
+*
+* @tparam T Type of values. A value-initialized @c T is returned for points
+*           not covered by any interval.
+*
+* When more intervals contain the same point, the one added first wins. Usage:
+* add() all the intervals, call build(), and then find() values. The index
+* splits the covered space into disjoint ranges with a constant result, so
+* find() is a binary search.
+*
+* find() does not modify the index, so it can be called from more threads at
+* once. add(), build() and clear() must not run concurrently with any other
+* call.
+*/
+template<typename T>
+class IntervalIndex {
+public:
+	/**
+	* @brief Adds the interval <tt>[start, end)</tt> with the given value.
+	*
+	* Empty intervals are ignored. The index has to be rebuilt by build()
+	* before the interval is taken into account.
+	*/
+	void add(std::uint64_t start, std::uint64_t end, const T &value) {
+		if (start < end) {
+			intervals.push_back({start, end, value});
+		}
+	}
+
+	/**
+	* @brief Adds the interval of the given size starting at @a start.
+	*
+	* The end of the interval is clamped to the highest representable point.
+	*/
+	void addSized(std::uint64_t start, std::uint64_t size, const T &value) {
+		const auto max = std::numeric_limits<std::uint64_t>::max();
+		add(start, size > max - start ? max : start + size, value);
+	}
+
+	/**
+	* @brief Builds the index from all the added intervals.
+	*/
+	void build() {
+		bounds.clear();
+		values.clear();
+
+		std::vector<std::size_t> byStart(intervals.size());
+		std::vector<std::size_t> byEnd(intervals.size());
+		for (std::size_t i = 0; i < intervals.size(); ++i) {
+			byStart[i] = byEnd[i] = i;
+		}
+		std::sort(byStart.begin(), byStart.end(),
+			[this](std::size_t a, std::size_t b) {
+				return intervals[a].start < intervals[b].start;
+			});
+		std::sort(byEnd.begin(), byEnd.end(),
+			[this](std::size_t a, std::size_t b) {
+				return intervals[a].end < intervals[b].end;
+			});
+
+		// Sweep over all the bounds. Active intervals are kept ordered by
+		// the order in which they were added, so the first one wins.
+		std::set<std::size_t> active;
+		auto startIt = byStart.begin();
+		auto endIt = byEnd.begin();
+		while (startIt != byStart.end() || endIt != byEnd.end()) {
+			std::uint64_t bound = endIt != byEnd.end()
+				? intervals[*endIt].end
+				: intervals[*startIt].start;
+			if (startIt != byStart.end()) {
+				bound = std::min(bound, intervals[*startIt].start);
+			}
+
+			for (; endIt != byEnd.end() && intervals[*endIt].end == bound; ++endIt) {
+				active.erase(*endIt);
+			}
+			for (; startIt != byStart.end() && intervals[*startIt].start == bound; ++startIt) {
+				active.insert(*startIt);
+			}
+
+			const T value = active.empty() ? T() : intervals[*active.begin()].value;
+			if (values.empty() || !(values.back() == value)) {
+				bounds.push_back(bound);
+				values.push_back(value);
+			}
+		}
+	}
+
+	/**
+	* @brief Returns the value of the first added interval containing
+	*        @a point, or a value-initialized @c T if there is no such
+	*        interval.
+	*/
+	T find(std::uint64_t point) const {
+		auto it = std::upper_bound(bounds.begin(), bounds.end(), point);
+		if (it == bounds.begin()) {
+			return T();
+		}
+
+		return values[it - bounds.begin() - 1];
+	}
+
+	/**
+	* @brief Removes all the intervals.
+	*/
+	void clear() {
+		intervals.clear();
+		bounds.clear();
+		values.clear();
+	}
+
+	/**
+	* @brief Returns @c true if no interval was added, @c false otherwise.
+	*/
+	bool empty() const {
+		return intervals.empty();
+	}
+
+private:
+	struct Interval {
+		std::uint64_t start;
+		std::uint64_t end;
+		T value;
+	};
+
+	/// Added intervals.
+	std::vector<Interval> intervals;
+
+	/// Sorted starts of the disjoint ranges.
+	std::vector<std::uint64_t> bounds;
+
+	/// Value for each range from @c bounds (until the next bound).
+	std::vector<T> values;
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -0,0 +1,55 @@
+/**
+* @file include/retdec/utils/memory_mapped_file.h
+* @brief Private memory mapping of a file.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_MEMORY_MAPPED_FILE_H
+#define RETDEC_UTILS_MEMORY_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Content of a file mapped into memory.
+*
+* The mapping is private (copy-on-write). The file itself is never modified,
+* but the mapped bytes may be patched in place (e.g. when relocations are
+* applied) and only the touched pages are then copied by the system. Pages
+* that are only read are shared with the page cache, so even large files
+* cost no heap memory.
+*/
+class MemoryMappedFile: private NonCopyable {
+public:
+	MemoryMappedFile() = default;
+	explicit MemoryMappedFile(const std::string &path);
+	~MemoryMappedFile();
+
+	bool open(const std::string &path);
+	void close();
+
+	bool isOpen() const;
+	std::uint8_t *getData() const;
+	std::size_t getSize() const;
+
+private:
+	/// Mapped content of the file (@c nullptr for empty files).
+	std::uint8_t *data = nullptr;
+
+	/// Size of the file.
+	std::size_t size = 0;
+
+	/// Whether a file is mapped.
+	bool opened = false;
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
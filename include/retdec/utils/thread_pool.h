@@ -0,0 +1,86 @@
+/**
+* @file include/retdec/utils/thread_pool.h
+* @brief A simple pool of worker threads.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_THREAD_POOL_H
+#define RETDEC_UTILS_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief A fixed-size pool of worker threads executing submitted tasks.
+*
+* Tasks are executed in the order in which they were submitted. The result of
+* a task (or the exception it has thrown) is obtained through the future
+* returned by submit().
+*
+* The destructor waits until all the submitted tasks are finished.
+*/
+class ThreadPool: private NonCopyable {
+public:
+	explicit ThreadPool(std::size_t numOfThreads = 0);
+	~ThreadPool();
+
+	std::size_t getNumOfThreads() const;
+
+	/**
+	* @brief Submits the given task for execution.
+	*
+	* @return Future holding the result of the task.
+	*/
+	template<typename Task>
+	auto submit(Task &&task) -> std::future<std::invoke_result_t<Task>> {
+		using Result = std::invoke_result_t<Task>;
+
+		// std::function requires a copyable target, so the task has to be
+		// wrapped into a shared pointer.
+		auto packagedTask = std::make_shared<std::packaged_task<Result()>>(
+			std::forward<Task>(task));
+		auto result = packagedTask->get_future();
+		enqueue([packagedTask]() { (*packagedTask)(); });
+		return result;
+	}
+
+	static std::size_t getDefaultNumOfThreads();
+
+private:
+	void enqueue(std::function<void ()> task);
+	void runWorker();
+
+private:
+	/// Worker threads.
+	std::vector<std::thread> workers;
+
+	/// Tasks waiting for execution.
+	std::queue<std::function<void ()>> tasks;
+
+	/// Mutex guarding @c tasks and @c stopping.
+	std::mutex tasksMutex;
+
+	/// Signalizes that there is a new task or that the pool is stopping.
+	std::condition_variable tasksCondition;
+
+	/// Is the pool being destroyed?
+	bool stopping = false;
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -22,12 +22,14 @@ class YaraRule
 {
 	private:
 		std::string name;               ///< name of rule
+		std::string nameSpace;          ///< namespace of rule
 		std::vector<YaraMeta> metas;    ///< all meta-data related to rule
 		std::vector<YaraMatch> matches; ///< all matches of rule
 	public:
 		/// @name Const getters
 		/// @{
 		const std::string &getName() const;
+		const std::string &getNamespace() const;
 		const YaraMeta* getMeta(const std::string &id) const;
 		const YaraMatch* getMatch(std::size_t index) const;
 		const YaraMatch* getFirstMatch() const;
@@ -47,6 +49,7 @@ class YaraRule
 		/// @name Setters
 		/// @{
 		void setName(const std::string &ruleName);
+		void setNamespace(const std::string &ruleNamespace);
 		/// @}
 
 		/// @name Other methods
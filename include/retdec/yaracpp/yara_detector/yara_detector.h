@@ -8,6 +8,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <yara/compiler.h>
@@ -62,8 +63,10 @@ class YaraDetector
 		std::vector<YaraRule> undetectedRules;   ///< representation of undetected rules
 		YR_RULES* textFilesRules;                ///< rules from input text files
 		std::vector<YR_RULES*> precompiledRules; ///< rules from precompiled files
+		std::vector<YR_RULES*> sharedRules;      ///< rules shared with other instances
 		bool stateIsValid;                       ///< internal state of instance
 		bool needsRecompilation;                 ///< indicates whether text files need recompilation
+		bool hasTextRules;                       ///< indicates whether any text rules were added
 
 		/// @name Static auxiliary methods
 		/// @{
@@ -83,13 +86,19 @@ class YaraDetector
 		/// @{
 		bool addRules(const char *string);
 		bool addRuleFile(const std::string &pathToFile, const std::string &nameSpace = std::string());
+		bool addPrecompiledRuleFile(const std::string &pathToFile);
+		bool addRuleFiles(const std::vector<std::pair<std::string, std::string>> &ruleFiles,
+			const std::string &cacheDirectory = std::string());
+		bool saveCompiledRules(const std::string &pathToFile);
 		bool isInValidState() const;
+		static bool isPrecompiledRuleFile(const std::string &pathToFile);
 		/// @}
 
 		/// @name Detection methods
 		/// @{
 		bool analyze(const std::string &pathToInputFile, bool storeAllRules = false);
 		bool analyze(std::vector<std::uint8_t> &bytes, bool storeAllRules = false);
+		bool analyze(const std::uint8_t *bytes, std::size_t size, bool storeAllRules = false);
 		const std::vector<YaraRule>& getDetectedRules() const;
 		const std::vector<YaraRule>& getUndetectedRules() const;
 		/// @}
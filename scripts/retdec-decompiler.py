@@ -191,6 +191,11 @@ def parse_args(args):
                         action='store_true',
                         help='Disables backend optimizations.')
 
+    parser.add_argument('--backend-opt-threads',
+                        dest='backend_opt_threads',
+                        metavar='N',
+                        help='Number of threads used to run function optimizations (0 means all available threads).')
+
     parser.add_argument('--backend-no-symbolic-names',
                         dest='backend_no_symbolic_names',
                         action='store_true',
@@ -303,6 +308,11 @@ def parse_args(args):
                         help='No default signatures for statically linked code analysis are loaded '
                              '(options static-code-sigfile/archive are still available).')
 
+    parser.add_argument('--static-code-cache-dir',
+                        dest='static_code_cache_dir',
+                        help='Existing directory where compiled signatures for statically linked code '
+                             'analysis and for tool detection are cached between decompilations.')
+
     parser.add_argument('--max-memory',
                         dest='max_memory',
                         help='Limits the maximal memory of fileinfo, unpacker, bin2llvmir, '
@@ -789,6 +799,9 @@ class Decompiler:
                 for par in config.FILEINFO_EXTERNAL_YARA_EXTRA_CRYPTO_DATABASES:
                     fileinfo_params.extend(['--crypto', par])
 
+            if self.args.static_code_cache_dir:
+                fileinfo_params.extend(['--yara-cache-dir', self.args.static_code_cache_dir])
+
             if self.args.max_memory:
                 fileinfo_params.extend(['--max-memory', self.args.max_memory])
             elif not self.args.no_memory_limit:
@@ -861,6 +874,9 @@ class Decompiler:
                     for ed in config.FILEINFO_EXTERNAL_YARA_EXTRA_CRYPTO_DATABASES:
                         fileinfo_params.extend(['--crypto', ed])
 
+                if self.args.static_code_cache_dir:
+                    fileinfo_params.extend(['--yara-cache-dir', self.args.static_code_cache_dir])
+
                 if self.args.max_memory:
                     fileinfo_params.extend(['--max-memory', self.args.max_memory])
                 elif not self.args.no_memory_limit:
@@ -1034,6 +1050,10 @@ class Decompiler:
             for i in self.args.static_code_sigfile:
                 CmdRunner.run_cmd([config.CONFIGTOOL, self.config_file, '--write', '--user-signature', i])
 
+            if self.args.static_code_cache_dir:
+                CmdRunner.run_cmd([config.CONFIGTOOL, self.config_file, '--write', '--signatures-cache',
+                                   self.args.static_code_cache_dir])
+
             # Store paths of type files into config.
             if os.path.isdir(config.GENERIC_TYPES_DIR):
                 CmdRunner.run_cmd([config.CONFIGTOOL, self.config_file, '--write', '--types', config.GENERIC_TYPES_DIR])
@@ -1175,6 +1195,9 @@ class Decompiler:
         if self.args.backend_no_compound_operators:
             llvmir2hll_params.append('-no-compound-operators')
 
+        if self.args.backend_opt_threads:
+            llvmir2hll_params.append('-opt-threads=' + self.args.backend_opt_threads)
+
         if self.args.backend_find_patterns:
             llvmir2hll_params.extend(['-find-patterns', self.args.backend_find_patterns])
 
@@ -4,20 +4,26 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <set>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <llvm/ADT/BitVector.h>
 #include <llvm/ADT/PostOrderIterator.h>
+#include <llvm/ADT/SparseBitVector.h>
 #include <llvm/Analysis/OrderedBasicBlock.h>
 #include <llvm/IR/CFG.h>
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/Instructions.h>
 #include <llvm/Support/raw_ostream.h>
 
+#include "retdec/utils/thread_pool.h"
 #include "retdec/utils/time.h"
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
@@ -31,6 +37,224 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
+namespace {
+
+/**
+ * Functions with more (definitions * basic blocks) are solved with sparse
+ * bit sets. Dense bit vectors of such functions would take too much memory.
+ */
+const std::size_t denseBitsLimit = std::size_t(1) << 27;
+
+/**
+ * Modules (or sets of invalidated functions) with fewer basic blocks are
+ * solved sequentially. Starting worker threads would take longer than
+ * the analysis itself.
+ */
+const std::size_t parallelBasicBlocksLimit = 2048;
+
+/**
+ * Data-flow information of a single function.
+ *
+ * Definitions are numbered so that all definitions of the same source get
+ * consecutive numbers. Basic blocks are numbered in the function's order.
+ */
+class FunctionSets
+{
+	public:
+		/// Basic block entries by their numbers.
+		std::vector<BasicBlockEntry*> blocks;
+		/// Numbers of basic blocks in reverse post order.
+		/// Unreachable basic blocks are not included.
+		std::vector<unsigned> rpo;
+		/// Predecessors of each basic block.
+		std::vector<std::vector<unsigned>> preds;
+		/// Definitions generated by each basic block.
+		std::vector<std::vector<unsigned>> gens;
+		/// Sources killed (defined) by each basic block.
+		std::vector<std::vector<unsigned>> kills;
+
+		/// Definitions by their numbers.
+		std::vector<Definition*> defs;
+		/// Source number of each definition.
+		std::vector<unsigned> defSources;
+		/// Number of the first definition of each source, followed by
+		/// the number of all definitions.
+		std::vector<unsigned> sourceBegins;
+		/// Numbers of the defined sources.
+		std::unordered_map<const llvm::Value*, unsigned> sources;
+};
+
+void initializeBits(BitVector& bits, const FunctionSets& fs)
+{
+	bits.resize(fs.defs.size());
+}
+
+void initializeBits(SparseBitVector<>&, const FunctionSets&)
+{
+	// Nothing to do, sparse bit sets do not have a fixed size.
+}
+
+/**
+ * Dense kill set contains all definitions of the killed sources.
+ */
+void initializeKill(BitVector& kill, const FunctionSets& fs, unsigned bb)
+{
+	kill.resize(fs.defs.size());
+	for (unsigned s : fs.kills[bb])
+	{
+		kill.set(fs.sourceBegins[s], fs.sourceBegins[s + 1]);
+	}
+}
+
+/**
+ * Sparse kill set contains only the killed sources. Setting all their
+ * definitions in every basic block would be too slow in huge functions.
+ */
+void initializeKill(SparseBitVector<>& kill, const FunctionSets& fs, unsigned bb)
+{
+	for (unsigned s : fs.kills[bb])
+	{
+		kill.set(s);
+	}
+}
+
+/**
+ * REACH_out[B] = GEN[B] + ( REACH_in[B] - KILL[B] )
+ * @param[in,out] defs REACH_in[B] on input, REACH_out[B] on output.
+ */
+void transfer(
+		BitVector& defs,
+		const BitVector& gen,
+		const BitVector& kill,
+		const FunctionSets&)
+{
+	defs.reset(kill);
+	defs |= gen;
+}
+
+void transfer(
+		SparseBitVector<>& defs,
+		const SparseBitVector<>& gen,
+		const SparseBitVector<>& kill,
+		const FunctionSets& fs)
+{
+	SparseBitVector<> out = gen;
+	for (unsigned d : defs)
+	{
+		if (!kill.test(fs.defSources[d]))
+		{
+			out.set(d);
+		}
+	}
+	defs = std::move(out);
+}
+
+/**
+ * Iterate the data-flow equations to a fixpoint.
+ * REACH_in[B] = Sum (p in pred[B]) (REACH_out[p])
+ * @return REACH_out of every basic block.
+ */
+template <typename Bits>
+std::vector<Bits> propagate(const FunctionSets& fs)
+{
+	std::vector<Bits> outs(fs.blocks.size());
+	std::vector<Bits> gens(fs.blocks.size());
+	std::vector<Bits> kills(fs.blocks.size());
+	for (unsigned bb = 0; bb < fs.blocks.size(); ++bb)
+	{
+		initializeBits(outs[bb], fs);
+		initializeBits(gens[bb], fs);
+		for (unsigned d : fs.gens[bb])
+		{
+			gens[bb].set(d);
+		}
+		initializeKill(kills[bb], fs, bb);
+	}
+
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+
+		for (unsigned bb : fs.rpo)
+		{
+			Bits defs;
+			initializeBits(defs, fs);
+			for (unsigned p : fs.preds[bb])
+			{
+				defs |= outs[p];
+			}
+			transfer(defs, gens[bb], kills[bb], fs);
+
+			if (defs != outs[bb])
+			{
+				outs[bb] = std::move(defs);
+				changed = true;
+			}
+		}
+	}
+
+	return outs;
+}
+
+/**
+ * Connect uses with definitions reaching them -- either from the same basic
+ * block, or from the ends of its predecessors.
+ */
+template <typename Bits>
+void initializeDefsAndUses(const FunctionSets& fs, const std::vector<Bits>& outs)
+{
+	for (unsigned bb = 0; bb < fs.blocks.size(); ++bb)
+	{
+		BasicBlockEntry& bbe = *fs.blocks[bb];
+		OrderedBasicBlock obb(bbe.bb);
+
+		for (Use &u : bbe.uses)
+		{
+			for (auto dIt = bbe.defs.rbegin(); dIt != bbe.defs.rend(); ++dIt)
+			{
+				Definition &d = *dIt;
+
+				if (d.getSource() != u.src)
+				{
+					continue;
+				}
+
+				if (obb.dominates(d.def, u.use))
+				{
+					d.uses.insert(&u);
+					u.defs.insert(&d);
+					break;
+				}
+			}
+
+			if (!u.defs.empty())
+			{
+				continue;
+			}
+
+			auto sIt = fs.sources.find(u.src);
+			if (sIt == fs.sources.end())
+			{
+				continue;
+			}
+
+			unsigned s = sIt->second;
+			for (unsigned p : fs.preds[bb])
+			for (unsigned d = fs.sourceBegins[s]; d < fs.sourceBegins[s + 1]; ++d)
+			{
+				if (outs[p].test(d))
+				{
+					fs.defs[d]->uses.insert(&u);
+					u.defs.insert(fs.defs[d]);
+				}
+			}
+		}
+	}
+}
+
+} // anonymous namespace
+
 //
 //=============================================================================
 //  ReachingDefinitionsAnalysis
@@ -48,7 +272,16 @@ bool ReachingDefinitionsAnalysis::runOnModule(
 
 	clear();
 	initializeBasicBlocks(M);
-	run();
+
+	std::vector<const Function*> fncs;
+	for (Function& F : M)
+	{
+		if (!F.isDeclaration())
+		{
+			fncs.push_back(&F);
+		}
+	}
+	run(fncs);
 
 	_run = true;
 	return false;
@@ -65,22 +298,100 @@ bool ReachingDefinitionsAnalysis::runOnFunction(
 
 	clear();
 	initializeBasicBlocks(F);
-	run();
+	run({&F});
 
 	_run = true;
 	return false;
 }
 
-void ReachingDefinitionsAnalysis::run()
+/**
+ * Drop results of function @a F. They are recomputed by the next
+ * updateOnModule(). Functions must be invalidated whenever they are modified,
+ * and also before they are erased from the module.
+ */
+void ReachingDefinitionsAnalysis::invalidate(const llvm::Function* F)
 {
-	initializeBasicBlocksPrev();
-	initializeKillGenSets();
-	propagate();
-	initializeDefsAndUses();
+	bbMap.erase(F);
+}
 
-	LOG << *this << "\n";
+/**
+ * Incrementally update the analysis of module @a M -- recompute it only for
+ * functions invalidated since the last run, and for functions added to
+ * the module since then. Results of all the other functions are kept.
+ * If the analysis was not run yet, this is the same as runOnModule() with
+ * the default settings. Otherwise, settings of the last run are used.
+ */
+bool ReachingDefinitionsAnalysis::updateOnModule(llvm::Module& M)
+{
+	if (!_run)
+	{
+		return runOnModule(M);
+	}
 
-	clearInternal();
+	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(&M);
+
+	std::set<const Function*> moduleFncs;
+	std::vector<const Function*> fncs;
+	for (Function& F : M)
+	{
+		moduleFncs.insert(&F);
+		if (!F.isDeclaration() && bbMap.count(&F) == 0)
+		{
+			initializeBasicBlocks(F);
+			fncs.push_back(&F);
+		}
+	}
+
+	// Functions erased from the module.
+	for (auto it = bbMap.begin(); it != bbMap.end();)
+	{
+		it = moduleFncs.count(it->first) ? std::next(it) : bbMap.erase(it);
+	}
+
+	run(fncs);
+	return false;
+}
+
+/**
+ * Solve functions @a fncs, whose basic blocks are already initialized.
+ * Functions are independent, so bigger sets of them are solved in parallel.
+ */
+void ReachingDefinitionsAnalysis::run(const std::vector<const Function*>& fncs)
+{
+	std::size_t bbCount = 0;
+	for (auto* F : fncs)
+	{
+		bbCount += F->size();
+	}
+
+	if (fncs.size() > 1
+			&& bbCount >= parallelBasicBlocksLimit
+			&& ThreadPool::getDefaultNumOfThreads() > 1)
+	{
+		ThreadPool pool;
+		std::vector<std::future<void>> results;
+		results.reserve(fncs.size());
+		for (auto* F : fncs)
+		{
+			auto& bbs = bbMap[F];
+			results.push_back(pool.submit([F, &bbs]() {
+				solveFunction(F, bbs);
+			}));
+		}
+		for (auto& r : results)
+		{
+			r.get();
+		}
+	}
+	else
+	{
+		for (auto* F : fncs)
+		{
+			solveFunction(F, bbMap[F]);
+		}
+	}
+
+	LOG << *this << "\n";
 }
 
 void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Module& M)
@@ -184,125 +495,117 @@ bool ReachingDefinitionsAnalysis::wasRun() const
 }
 
 /**
- * Clear internal structures used to compute RDA, but not needed to use it once
- * it is computed.
+ * Solve reaching definitions of function @a F with basic blocks @a bbs.
+ * This touches only the given function's data, so it can run in parallel
+ * for different functions.
  */
-void ReachingDefinitionsAnalysis::clearInternal()
+void ReachingDefinitionsAnalysis::solveFunction(
+		const llvm::Function* F,
+		BasicBlockMap& bbs)
 {
-	for (auto& pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	// Declarations have no basic blocks to solve, and there is no entry
+	// block to start the traversal from.
+	if (F->empty())
 	{
-		BasicBlockEntry& bb = pair.second;
-		bb.defsOut.clear();
-		bb.genDefs.clear();
-		bb.killDefs.clear();
+		return;
 	}
-}
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
-{
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
-	{
-		auto B = pair.first;
-		auto &entry = pair.second;
+	FunctionSets fs;
 
-		for (auto PI = pred_begin(B), E = pred_end(B); PI != E; ++PI)
-		{
-			auto* pred = *PI;
-			auto p = pair1.second.find(pred);
-
-			assert(p != pair1.second.end() && "we should have all BBs stored in bbMap");
+	std::unordered_map<const BasicBlock*, unsigned> bbNumbers;
+	for (const BasicBlock& B : *F)
+	{
+		auto fIt = bbs.find(&B);
+		assert(fIt != bbs.end() && "we should have all BBs stored in bbMap");
 
-			entry.prevBBs.insert( &p->second );
-		}
+		bbNumbers[&B] = fs.blocks.size();
+		fs.blocks.push_back(&fIt->second);
 	}
-}
 
-void ReachingDefinitionsAnalysis::initializeKillGenSets()
-{
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
-	{
-		pair.second.initializeKillDefSets();
-	}
-}
+	fs.preds.resize(fs.blocks.size());
+	fs.gens.resize(fs.blocks.size());
+	fs.kills.resize(fs.blocks.size());
 
-void ReachingDefinitionsAnalysis::propagate()
-{
-	for (auto &pair1 : bbMap)
+	// Predecessors, and sources killed by basic blocks.
+	//
+	std::vector<unsigned> sourceSizes;
+	for (unsigned bb = 0; bb < fs.blocks.size(); ++bb)
 	{
-		const Function* fnc = pair1.first;
+		BasicBlockEntry& bbe = *fs.blocks[bb];
 
-		std::vector<BasicBlockEntry*> workList;
-		workList.reserve(pair1.second.size());
-		ReversePostOrderTraversal<const Function*> RPOT(fnc); // Expensive to create
-		for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
+		for (auto* pred : predecessors(bbe.bb))
 		{
-			const BasicBlock* bb = *I;
-			auto fIt = pair1.second.find(bb);
-			assert(fIt != pair1.second.end());
-			workList.push_back(&(fIt->second));
-
-			fIt->second.changed = true;
+			unsigned p = bbNumbers[pred];
+			fs.preds[bb].push_back(p);
+			bbe.prevBBs.insert(fs.blocks[p]);
 		}
 
-		bool changed = true;
-		while (changed)
+		for (Definition& d : bbe.defs)
 		{
-			changed = false;
-
-			for (auto* bbe : workList)
+			auto ins = fs.sources.emplace(d.getSource(), fs.sources.size());
+			unsigned s = ins.first->second;
+			if (ins.second)
 			{
-				changed |= bbe->initDefsOut();
+				sourceSizes.push_back(0);
 			}
+			++sourceSizes[s];
+			fs.kills[bb].push_back(s);
 		}
 	}
-}
 
-void ReachingDefinitionsAnalysis::initializeDefsAndUses()
-{
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	// Number definitions so that definitions of the same source are
+	// consecutive, and find the last definition of each source in each
+	// basic block (generated definitions).
+	//
+	fs.sourceBegins.resize(sourceSizes.size() + 1, 0);
+	for (unsigned s = 0; s < sourceSizes.size(); ++s)
 	{
-		BasicBlockEntry &bb = pair.second;
-		OrderedBasicBlock obb(bb.bb);
+		fs.sourceBegins[s + 1] = fs.sourceBegins[s] + sourceSizes[s];
+	}
+	fs.defs.resize(fs.sourceBegins.back());
+	fs.defSources.resize(fs.sourceBegins.back());
 
-		for (Use &u : bb.uses)
+	std::vector<unsigned> nextNumbers(fs.sourceBegins.begin(), fs.sourceBegins.end() - 1);
+	std::vector<unsigned> lastDefs(sourceSizes.size());
+	for (unsigned bb = 0; bb < fs.blocks.size(); ++bb)
+	{
+		for (Definition& d : fs.blocks[bb]->defs)
 		{
-			for (auto dIt = bb.defs.rbegin(); dIt != bb.defs.rend(); ++dIt)
-			{
-				Definition &d = *dIt;
+			unsigned s = fs.sources[d.getSource()];
+			unsigned n = nextNumbers[s]++;
+			fs.defs[n] = &d;
+			fs.defSources[n] = s;
+			lastDefs[s] = n;
+		}
 
-				if (d.getSource() != u.src)
-				{
-					continue;
-				}
+		// Killed sources may contain duplicates, the last definition of
+		// a source is generated only once.
+		auto& kills = fs.kills[bb];
+		std::sort(kills.begin(), kills.end());
+		kills.erase(std::unique(kills.begin(), kills.end()), kills.end());
+		for (unsigned s : kills)
+		{
+			fs.gens[bb].push_back(lastDefs[s]);
+		}
+	}
 
-				if (obb.dominates(d.def, u.use))
-				{
-					d.uses.insert(&u);
-					u.defs.insert(&d);
-					break;
-				}
-			}
+	ReversePostOrderTraversal<const Function*> RPOT(F); // Expensive to create
+	for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
+	{
+		fs.rpo.push_back(bbNumbers[*I]);
+	}
 
-			if (u.defs.empty())
-			{
-				for (auto p : bb.prevBBs)
-				for (auto d : p->defsOut)
-				{
-					if (d->getSource() == u.src)
-					{
-						d->uses.insert(&u);
-						u.defs.insert(d);
-					}
-				}
-			}
-		}
+	if (fs.defs.size() * fs.blocks.size() > denseBitsLimit)
+	{
+		initializeDefsAndUses(fs, propagate<SparseBitVector<>>(fs));
+	}
+	else
+	{
+		initializeDefsAndUses(fs, propagate<BitVector>(fs));
 	}
 }
 
+
 const BasicBlockEntry& ReachingDefinitionsAnalysis::getBasicBlockEntry(
 		const Instruction* I) const
 {
@@ -362,54 +665,6 @@ BasicBlockEntry::BasicBlockEntry(const llvm::BasicBlock* b) :
 
 }
 
-void BasicBlockEntry::initializeKillDefSets()
-{
-	killDefs.clear();
-	genDefs.clear();
-
-	for (auto dIt = defs.rbegin(); dIt != defs.rend(); ++dIt)
-	{
-		Definition& d = *dIt;
-
-		bool added = (killDefs.insert(d.getSource())).second;
-		if (added)
-		{
-			genDefs.insert(&d);
-		}
-	}
-}
-
-/**
- * REACH_in[B] = Sum (p in pred[B]) (REACH_out[p])
- * REACH_out[B] = GEN[B] + ( REACH_in[B] - KILL[B] )
- */
-Changed BasicBlockEntry::initDefsOut()
-{
-	auto oldSz = defsOut.size();
-
-	if (defsOut.empty() && !genDefs.empty())
-	{
-		defsOut = std::move(genDefs);
-	}
-
-	for (auto* p : prevBBs)
-	{
-		if (p->changed)
-		{
-			for (auto* d : p->defsOut)
-			{
-				if (killDefs.find(d->getSource()) == killDefs.end())
-				{
-					defsOut.insert(d);
-				}
-			}
-		}
-	}
-
-	changed = oldSz != defsOut.size();
-	return changed;
-}
-
 std::string BasicBlockEntry::getName() const
 {
 	std::stringstream out;
@@ -77,12 +77,7 @@ bool AsmInstructionRemover::run(Module& M)
 
 	// Free Capstone instructions.
 	//
-	auto& insnMap = AsmInstruction::getLlvmToCapstoneInsnMap(&M);
-	for (auto& p : insnMap)
-	{
-		cs_free(p.second, 1);
-	}
-	insnMap.clear();
+	AsmInstruction::getLlvmToCapstoneInsnMap(&M).clear();
 
 	// Remove special global variable.
 	//
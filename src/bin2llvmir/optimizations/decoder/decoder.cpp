@@ -102,6 +102,7 @@ bool Decoder::run()
 	}
 
 	initTranslator();
+	initDisassemblyCache();
 	initDryRunCsInstruction();
 	initEnvironment();
 	initRanges();
@@ -146,6 +147,15 @@ void Decoder::decode()
 	JumpTarget jt;
 	while (getJumpTarget(jt))
 	{
+		// Let workers disassemble the next target while this one is decoded.
+		//
+		if (_disasmCache && !_jumpTargets.empty())
+		{
+			_disasmCache->prefetch(
+					_jumpTargets.top().getAddress(),
+					_jumpTargets.top().getMode());
+		}
+
 		LOG << "\t" << "processing : " << jt << std::endl;
 		decodeJumpTarget(jt);
 	}
@@ -317,13 +327,20 @@ void Decoder::decodeJumpTarget(const JumpTarget& jt)
 		}
 		_somethingDecoded = true;
 
-		_llvm2capstone->emplace(res.llvmInsn, res.capstoneInsn);
+		_llvm2capstone->emplace(
+				res.llvmInsn,
+				res.capstoneInsn,
+				_c2l->getBasicMode());
 
 		bbEnd |= getJumpTargetsFromInstruction(oldAddr, res, bytes.second);
 		bbEnd |= instructionBreaksBasicBlock(oldAddr, res);
 
 		handleDelaySlotTypical(addr, res, bytes, irb);
 		handleDelaySlotLikely(addr, res, bytes, irb);
+
+		// Only a compact record is kept in the mapping, details are
+		// disassembled again if they are needed.
+		cs_free(res.capstoneInsn, 1);
 	}
 	while (!bbEnd);
 
@@ -335,6 +352,21 @@ void Decoder::decodeJumpTarget(const JumpTarget& jt)
 capstone2llvmir::Capstone2LlvmIrTranslator::TranslationResultOne
 Decoder::translate(ByteData& bytes, common::Address& addr, llvm::IRBuilder<>& irb)
 {
+	if (_disasmCache)
+	{
+		if (cs_insn* insn = _disasmCache->take(
+				addr,
+				_c2l->getBasicMode(),
+				bytes.second))
+		{
+			auto res = _c2l->translateOne(insn, irb);
+			bytes.first += res.size;
+			bytes.second -= res.size;
+			addr += res.size;
+			return res;
+		}
+	}
+
 	auto res = _c2l->translateOne(bytes.first, bytes.second, addr, irb);
 
 	// MIPS 64-bit mode can decompile more instructions than the 32-bit mode.
@@ -1353,7 +1385,11 @@ void Decoder::handleDelaySlotTypical(
 		{
 			break;
 		}
-		_llvm2capstone->emplace(r.llvmInsn, r.capstoneInsn);
+		_llvm2capstone->emplace(
+				r.llvmInsn,
+				r.capstoneInsn,
+				_c2l->getBasicMode());
+		cs_free(r.capstoneInsn, 1);
 	}
 
 	irb.SetInsertPoint(oldIp);
@@ -1410,7 +1446,11 @@ void Decoder::handleDelaySlotLikely(
 			{
 				break;
 			}
-			_llvm2capstone->emplace(res.llvmInsn, res.capstoneInsn);
+			_llvm2capstone->emplace(
+					res.llvmInsn,
+					res.capstoneInsn,
+					_c2l->getBasicMode());
+			cs_free(res.capstoneInsn, 1);
 		}
 
 		_likelyBb2Target.emplace(newBb, target);
@@ -85,6 +85,32 @@ void Decoder::initTranslator()
 			_module,
 			basicMode,
 			extraMode);
+
+	// Details of decoded instructions are disassembled again on demand.
+	_llvm2capstone->setDisassembler(arch, extraMode, _image->getImage());
+}
+
+/**
+ * Initialize cache of instructions disassembled in parallel, if more than one
+ * thread may be used.
+ */
+void Decoder::initDisassemblyCache()
+{
+	std::size_t threads = _config->getConfig().parameters.getNumberOfThreads();
+	if (threads == 0)
+	{
+		threads = utils::ThreadPool::getDefaultNumOfThreads();
+	}
+	// One thread is the decoder itself.
+	//
+	if (threads > 1)
+	{
+		_disasmCache = std::make_unique<DisassemblyCache>(
+				_image,
+				_c2l->getArchitecture(),
+				_c2l->getExtraMode(),
+				threads - 1);
+	}
 }
 
 /**
@@ -0,0 +1,245 @@
+/**
+* @file src/bin2llvmir/optimizations/decoder/disassembly_cache.cpp
+* @brief Cache of instructions disassembled ahead of decoding.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <chrono>
+
+#include "retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h"
+
+using namespace retdec::common;
+
+namespace retdec {
+namespace bin2llvmir {
+
+DisassemblyCache::Chunk::~Chunk()
+{
+	for (auto* insn : insns)
+	{
+		if (insn)
+		{
+			cs_free(insn, 1);
+		}
+	}
+}
+
+DisassemblyCache::DisassemblyCache(
+		FileImage* image,
+		cs_arch arch,
+		cs_mode extraMode,
+		std::size_t numOfThreads)
+		:
+		_image(image),
+		_arch(arch),
+		_extraMode(extraMode),
+		_pool(numOfThreads)
+{
+
+}
+
+/**
+ * Schedule disassembly of a chunk starting at @a addr in @a basicMode.
+ * Nothing is done if such a chunk already exists, or there are no data at
+ * @a addr.
+ */
+void DisassemblyCache::prefetch(common::Address addr, cs_mode basicMode)
+{
+	ChunkKey key(basicMode, addr);
+	if (addr.isUndefined() || _chunks.count(key))
+	{
+		return;
+	}
+
+	auto bytes = _image->getImage()->getRawSegmentData(addr);
+	if (bytes.first == nullptr || bytes.second == 0)
+	{
+		return;
+	}
+	auto size = std::min(bytes.second, CHUNK_SIZE + MAX_INSN_SIZE);
+
+	while (_chunks.size() >= MAX_CHUNKS && !_chunksOrder.empty())
+	{
+		_chunks.erase(_chunksOrder.front());
+		_chunksOrder.pop();
+	}
+
+	auto* data = bytes.first;
+	_chunks.emplace(key, _pool.submit([this, addr, basicMode, data, size]() {
+		return disassemble(addr, basicMode, data, size);
+	}).share());
+	_chunksOrder.push(key);
+}
+
+/**
+ * Take the instruction disassembled at @a addr in @a basicMode.
+ * The decoder never waits for workers: if no finished chunk contains the
+ * address, disassembly of a chunk starting there is only scheduled and the
+ * caller disassembles the single instruction on its own.
+ * @return Instruction whose ownership is passed to the caller, or @c nullptr
+ *         if the instruction is not available or it is longer than
+ *         @a maxSize. In such a case, the caller should disassemble the
+ *         instruction on its own.
+ */
+cs_insn* DisassemblyCache::take(
+		common::Address addr,
+		cs_mode basicMode,
+		std::size_t maxSize)
+{
+	// Chunks may overlap, check the closest finished ones that start before
+	// addr. Taking from a chunk may schedule (and evict) other chunks, so the
+	// candidates are collected first.
+	//
+	std::vector<std::shared_ptr<Chunk>> candidates;
+	auto it = _chunks.upper_bound(ChunkKey(basicMode, addr));
+	for (unsigned i = 0; i < 2 && it != _chunks.begin(); ++i)
+	{
+		--it;
+		if (it->first.first != basicMode)
+		{
+			break;
+		}
+
+		if (isReady(it->second))
+		{
+			candidates.push_back(it->second.get());
+		}
+	}
+
+	for (auto& chunk : candidates)
+	{
+		if (chunk->start <= addr && addr < chunk->end)
+		{
+			if (auto* insn = takeFromChunk(*chunk, addr, basicMode, maxSize))
+			{
+				return insn;
+			}
+		}
+	}
+
+	// Either the address was already taken, the linear sweep of the
+	// covering chunk is not synchronized with the decoder, or the chunk is
+	// not finished yet. Prepare the code that follows for later.
+	//
+	prefetch(addr, basicMode);
+	return nullptr;
+}
+
+/**
+ * Check if the chunk was already disassembled, without waiting for it.
+ */
+bool DisassemblyCache::isReady(const ChunkFuture& chunk)
+{
+	return chunk.wait_for(std::chrono::seconds(0))
+			== std::future_status::ready;
+}
+
+cs_insn* DisassemblyCache::takeFromChunk(
+		Chunk& chunk,
+		common::Address addr,
+		cs_mode basicMode,
+		std::size_t maxSize)
+{
+	auto it = std::lower_bound(
+			chunk.addresses.begin(),
+			chunk.addresses.end(),
+			addr.getValue());
+
+	// Linear sweep hit the end of a chunk, disassemble what follows.
+	//
+	if (!chunk.continuationPrefetched
+			&& chunk.taken >= chunk.insns.size() / 2)
+	{
+		chunk.continuationPrefetched = true;
+		prefetch(chunk.end, basicMode);
+	}
+
+	if (it == chunk.addresses.end() || *it != addr)
+	{
+		return nullptr;
+	}
+
+	auto& insn = chunk.insns[it - chunk.addresses.begin()];
+	if (insn == nullptr || insn->size > maxSize)
+	{
+		return nullptr;
+	}
+
+	cs_insn* res = insn;
+	insn = nullptr;
+	++chunk.taken;
+	return res;
+}
+
+/**
+ * Linear sweep disassembly of @a bytes at @a start. Runs in a worker thread,
+ * so it must not touch any shared state.
+ */
+std::shared_ptr<DisassemblyCache::Chunk> DisassemblyCache::disassemble(
+		common::Address start,
+		cs_mode basicMode,
+		const std::uint8_t* bytes,
+		std::size_t size) const
+{
+	auto chunk = std::make_shared<Chunk>();
+	chunk->start = start;
+	chunk->end = start;
+
+	csh handle = 0;
+	if (cs_open(_arch, static_cast<cs_mode>(basicMode + _extraMode), &handle)
+			!= CS_ERR_OK)
+	{
+		return chunk;
+	}
+	if (cs_option(handle, CS_OPT_DETAIL, CS_OPT_ON) != CS_ERR_OK)
+	{
+		cs_close(&handle);
+		return chunk;
+	}
+
+	auto minInsnSize = getMinInsnSize(basicMode);
+	std::uint64_t address = start;
+	const std::uint64_t chunkEnd = start + CHUNK_SIZE;
+	cs_insn* insn = cs_malloc(handle);
+	while (size > 0 && address < chunkEnd)
+	{
+		if (cs_disasm_iter(handle, &bytes, &size, &address, insn))
+		{
+			chunk->addresses.push_back(insn->address);
+			chunk->insns.push_back(insn);
+			insn = cs_malloc(handle);
+		}
+		else
+		{
+			// Skip undecodable bytes, the decoder handles them itself.
+			//
+			auto skip = std::min(size, minInsnSize);
+			bytes += skip;
+			size -= skip;
+			address += skip;
+		}
+	}
+	cs_free(insn, 1);
+	cs_close(&handle);
+
+	chunk->end = address;
+
+	return chunk;
+}
+
+std::size_t DisassemblyCache::getMinInsnSize(cs_mode basicMode) const
+{
+	switch (_arch)
+	{
+		case CS_ARCH_X86:
+			return 1;
+		case CS_ARCH_ARM:
+			return basicMode & CS_MODE_THUMB ? 2 : 4;
+		default:
+			return 4;
+	}
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
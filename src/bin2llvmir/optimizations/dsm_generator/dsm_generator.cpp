@@ -291,6 +291,10 @@ void DsmGenerator::generateInstruction(AsmInstruction& ai, std::ostream& ret)
 	generateAlignedAddress(ai.getAddress(), ret);
 	getAsmInstructionHex(ai, ret);
 	ret << ALIGN << INSTR_SEPARATOR << processInstructionDsm(ai) << "\n";
+
+	// Do not keep details of all the instructions at once.
+	AsmInstruction::getLlvmToCapstoneInsnMap(_module).releaseCapstoneInsn(
+			ai.getLlvmToAsmInstruction());
 }
 
 std::string DsmGenerator::processInstructionDsm(AsmInstruction& ai)
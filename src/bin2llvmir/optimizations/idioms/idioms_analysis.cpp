@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/bin2llvmir/optimizations/idioms/idioms_analysis.h"
 
 using namespace llvm;
@@ -11,6 +13,21 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
+/**
+ * Get opcodes of all instructions in a BasicBlock
+ *
+ * @param bb BasicBlock to inspect
+ * @return set of opcodes
+ */
+IdiomsAnalysis::OpcodeSet IdiomsAnalysis::getOpcodes(const llvm::BasicBlock & bb) {
+	OpcodeSet opcodes;
+
+	for (const Instruction & insn : bb)
+		opcodes.set(insn.getOpcode());
+
+	return opcodes;
+}
+
 /**
  * Analyse given BasicBlock and use instruction exchanger to transform
  * instruction idioms
@@ -18,15 +35,32 @@ namespace bin2llvmir {
  * @param bb BasicBlock to analyse
  * @param exchanger instruction idiom exchanger
  * @param fname instruction idiom exchanger name (for debug purpose only)
+ * @param rootOpcodes opcodes of instructions the exchanger can replace
+ *
+ * The exchanger is called only on instructions with one of @a rootOpcodes, so
+ * its patterns are not tried on instructions that cannot match them. When
+ * there is no such instruction in @a bb, the basic block is not walked at all.
  */
-bool IdiomsAnalysis::analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname) {
+bool IdiomsAnalysis::analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname,
+		std::initializer_list<unsigned> rootOpcodes) {
+	auto isRoot = [&rootOpcodes](unsigned opcode) {
+		return std::find(rootOpcodes.begin(), rootOpcodes.end(), opcode) != rootOpcodes.end();
+	};
+
+	if (std::none_of(rootOpcodes.begin(), rootOpcodes.end(),
+			[this](unsigned opcode) { return m_bbOpcodes.test(opcode); }))
+		return false;
+
 	bool change_made = false;
 
 	for (BasicBlock::iterator iter = bb.begin(), end = bb.end(); iter != end; /**/) {
 		BasicBlock::iterator insn = iter;
 		++iter; // go to next instruction to use valid iterator in next loop
 
-		// call exchanger on every instruction
+		if (! isRoot((*insn).getOpcode()))
+			continue;
+
+		// call exchanger on every candidate instruction
 		Instruction * res = (this->*exchanger)(insn);
 
 		if (res) {
@@ -51,6 +85,10 @@ bool IdiomsAnalysis::analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsA
 		}
 	}
 
+	// Exchangers create new instructions (and may remove others).
+	if (change_made)
+		m_bbOpcodes = getOpcodes(bb);
+
 	return change_made;
 }
 
@@ -84,185 +122,227 @@ bool IdiomsAnalysis::doAnalysis(Function & f, Pass * p) {
 	// Inspect basic-block idioms
 	for (Function::iterator b = f.begin(); b != f.end(); ++b) {
 		BasicBlock & bb = *b;
+		m_bbOpcodes = getOpcodes(bb);
+
 		if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_x86 || arch == ARCH_THUMB || arch == ARCH_ANY)
 			if (cc == CC_GCC || cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY) {
 				change_made |= analyse(bb, &IdiomsMagicDivMod::signedMod1,
-											"IdiomsMagicDivMod::signedMod1");
+											"IdiomsMagicDivMod::signedMod1",
+											{Instruction::Add});
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::signedMod2,
-											"IdiomsMagicDivMod::signedMod2");
+											"IdiomsMagicDivMod::signedMod2",
+											{Instruction::Add});
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicUnsignedDiv2,
-											"IdiomsMagicDivMod::magicUnsignedDiv2");
+											"IdiomsMagicDivMod::magicUnsignedDiv2",
+											{Instruction::LShr});
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicUnsignedDiv1,
-											"IdiomsMagicDivMod::magicUnsignedDiv1");
+											"IdiomsMagicDivMod::magicUnsignedDiv1",
+											{Instruction::Trunc});
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv1,
-											"IdiomsMagicDivMod::magicSignedDiv1");
+											"IdiomsMagicDivMod::magicSignedDiv1",
+											{Instruction::Sub});
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv2,
-											"IdiomsMagicDivMod::magicSignedDiv2");
+											"IdiomsMagicDivMod::magicSignedDiv2",
+											{Instruction::Sub});
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv3,
-											"IdiomsMagicDivMod::magicSignedDiv3");
+											"IdiomsMagicDivMod::magicSignedDiv3",
+											{Instruction::Sub});
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv4,
-											"IdiomsMagicDivMod::magicSignedDiv4");
+											"IdiomsMagicDivMod::magicSignedDiv4",
+											{Instruction::Sub});
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv5,
-											"IdiomsMagicDivMod::magicSignedDiv5");
+											"IdiomsMagicDivMod::magicSignedDiv5",
+											{Instruction::Sub});
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv6,
-											"IdiomsMagicDivMod::magicSignedDiv6");
+											"IdiomsMagicDivMod::magicSignedDiv6",
+											{Instruction::Sub});
 
 				// Found in PowerPC - div 10
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv7pos,
-											"IdiomsMagicDivMod::magicSignedDiv7pos");
+											"IdiomsMagicDivMod::magicSignedDiv7pos",
+											{Instruction::Sub});
 
 				// Found in PowerPC - the same as previous, but the divisor
 				// is negative, i.e. div -10
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv7neg,
-											"IdiomsMagicDivMod::magicSignedDiv7neg");
+											"IdiomsMagicDivMod::magicSignedDiv7neg",
+											{Instruction::Sub});
 
 				// Found in PowerPC - div 6
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv8pos,
-											"IdiomsMagicDivMod::magicSignedDiv8pos");
+											"IdiomsMagicDivMod::magicSignedDiv8pos",
+											{Instruction::Sub});
 
 				// Found in PowerPC - the same as previous, but the divisor
 				// is negative, i.e. div -3
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv8neg,
-											"IdiomsMagicDivMod::magicSignedDiv8neg");
+											"IdiomsMagicDivMod::magicSignedDiv8neg",
+											{Instruction::Sub});
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::unsignedMod,
-											"IdiomsMagicDivMod::unsignedMod");
+											"IdiomsMagicDivMod::unsignedMod",
+											{Instruction::Sub});
 		}
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsGCC::exchangeSignedModuloByTwo,
-										"IdiomsGCC::exchangeSignedModuloByTwo");
+										"IdiomsGCC::exchangeSignedModuloByTwo",
+										{Instruction::Sub});
 
 		// PowerPC model lacks FPU and x86 uses x87.
 		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
 			if (cc == CC_GCC || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsGCC::exchangeCopysign,
-											"IdiomsGCC::exchangeCopysign");
+											"IdiomsGCC::exchangeCopysign",
+											{Instruction::Or});
 
 		// PowerPC model lacks FPU and x86 uses x87.
 		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
 			if (cc == CC_GCC || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsGCC::exchangeFloatAbs,
-											"IdiomsGCC::exchangeFloatAbs");
+											"IdiomsGCC::exchangeFloatAbs",
+											{Instruction::And});
 
 		if (arch == ARCH_x86 || arch == ARCH_ANY)
 			if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsVStudio::exchangeOrMinusOneAssign,
-											"IdiomsVStudio::exchangeOrMinusOneAssign");
+											"IdiomsVStudio::exchangeOrMinusOneAssign",
+											{Instruction::Or});
 
 		if (arch == ARCH_x86 || arch == ARCH_ANY)
 			if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsVStudio::exchangeAndZeroAssign,
-										"IdiomsVStudio::exchangeAndZeroAssign");
+										"IdiomsVStudio::exchangeAndZeroAssign",
+										{Instruction::And});
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv1,
-										"IdiomsGCC::exchangeCondBitShiftDiv1");
+										"IdiomsGCC::exchangeCondBitShiftDiv1",
+										{Instruction::AShr});
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv2,
-										"IdiomsGCC::exchangeCondBitShiftDiv2");
+										"IdiomsGCC::exchangeCondBitShiftDiv2",
+										{Instruction::Sub});
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv3,
-										"IdiomsGCC::exchangeCondBitShiftDiv3");
+										"IdiomsGCC::exchangeCondBitShiftDiv3",
+										{Instruction::Sub});
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsCommon::exchangeSignedModulo2n,
-										"IdiomsCommon::exchangeSignedModulo2n");
+										"IdiomsCommon::exchangeSignedModulo2n",
+										{Instruction::Sub});
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_Intel || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsCommon::exchangeGreaterEqualZero,
-										"IdiomsCommon::exchangeGreaterEqualZero");
+										"IdiomsCommon::exchangeGreaterEqualZero",
+										{Instruction::Xor, Instruction::LShr});
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsGCC::exchangeXorMinusOne,
-										"IdiomsGCC::exchangeXorMinusOne");
+										"IdiomsGCC::exchangeXorMinusOne",
+										{Instruction::Xor});
 
 		if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
 			if (cc == CC_GCC || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsCommon::exchangeDivByMinusTwo,
-											"IdiomsCommon::exchangeDivByMinusTwo");
+											"IdiomsCommon::exchangeDivByMinusTwo",
+											{Instruction::Sub});
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsCommon::exchangeLessThanZero,
-										"IdiomsCommon::exchangeLessThanZero");
+										"IdiomsCommon::exchangeLessThanZero",
+										{Instruction::LShr});
 
 		// PowerPC model lacks FPU and x86 uses x87.
 		if (cc == CC_GCC || cc == CC_ANY)
 			if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
 				change_made |= analyse(bb, &IdiomsGCC::exchangeFloatNeg,
-											"IdiomsGCC::exchangeFloatNeg");
+											"IdiomsGCC::exchangeFloatNeg",
+											{Instruction::Xor});
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsCommon::exchangeUnsignedModulo2n,
-										"IdiomsCommon::exchangeUnsignedModulo2n");
+										"IdiomsCommon::exchangeUnsignedModulo2n",
+										{Instruction::And});
 
 		// all arch
 		if (cc == CC_LLVM || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
-											"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
+											"IdiomsLLVM::exchangeIsGreaterThanMinusOne",
+											{Instruction::ICmp});
 
 		// all arch
 		// all compilers
 		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftSDiv1,
-									"IdiomsCommon::exchangeBitShiftSDiv1");
+									"IdiomsCommon::exchangeBitShiftSDiv1",
+									{Instruction::Or});
 
 		// all arch
 		// all compilers
 		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftSDiv2,
-									"IdiomsCommon::exchangeBitShiftSDiv2");
+									"IdiomsCommon::exchangeBitShiftSDiv2",
+									{Instruction::AShr});
 
 		// all arch
 		// all compilers
 		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftUDiv,
-									"IdiomsCommon::exchangeBitShiftUDiv");
+									"IdiomsCommon::exchangeBitShiftUDiv",
+									{Instruction::LShr});
 
 		// all arch
 		// all compilers
 		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftMul,
-									"IdiomsCommon::exchangeBitShiftMul");
+									"IdiomsCommon::exchangeBitShiftMul",
+									{Instruction::Shl});
 
 		// all arch
 		if (cc == CC_LLVM || cc == CC_ANY) {
 			change_made |= analyse(bb, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
-										"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
+										"IdiomsLLVM::exchangeIsGreaterThanMinusOne",
+										{Instruction::ICmp});
 		}
 
 		// all arch
 		if (cc == CC_LLVM || cc == CC_ANY) {
 			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareEq,
-										"IdiomsLLVM::exchangeCompareEq");
+										"IdiomsLLVM::exchangeCompareEq",
+										{Instruction::Xor});
 
 	#if 0
 			/* We do not recognize this well */
 			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareNeq,
-										"IdiomsLLVM::exchangeCompareNeq");
+										"IdiomsLLVM::exchangeCompareNeq",
+										{Instruction::Xor});
 	#endif
 
 			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareSlt,
-										"IdiomsLLVM::exchangeCompareSlt");
+										"IdiomsLLVM::exchangeCompareSlt",
+										{Instruction::And});
 
 			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareSle,
-									"IdiomsLLVM::exchangeCompareSle");
+									"IdiomsLLVM::exchangeCompareSle",
+									{Instruction::Or});
 		}
 	}
 
@@ -55,8 +55,9 @@ void ProviderInitialization::setConfig(retdec::config::Config* c)
  */
 bool ProviderInitialization::runOnModule(Module& m)
 {
-	static bool firstRun = true;
-	if (!firstRun)
+	// Providers are initialized only once for each module. A process may
+	// decompile several modules, so this must not be a process-wide flag.
+	if (ConfigProvider::getConfig(&m))
 	{
 		return false;
 	}
@@ -149,8 +150,6 @@ bool ProviderInitialization::runOnModule(Module& m)
 
 	AsmInstruction::clear();
 
-	firstRun = false;
-
 	return false;
 }
 
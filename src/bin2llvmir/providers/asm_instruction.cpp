@@ -7,6 +7,7 @@
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/InstIterator.h>
 
+#include "retdec/loader/loader/image.h"
 #include "retdec/utils/container.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/names.h"
@@ -19,6 +20,335 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
+//
+//==============================================================================
+// Llvm2CapstoneInsnMap
+//==============================================================================
+//
+
+Llvm2CapstoneInsnMap::Llvm2CapstoneInsnMap(Llvm2CapstoneInsnMap&& o) noexcept
+{
+	*this = std::move(o);
+}
+
+Llvm2CapstoneInsnMap& Llvm2CapstoneInsnMap::operator=(
+		Llvm2CapstoneInsnMap&& o) noexcept
+{
+	if (this != &o)
+	{
+		releaseCapstoneInsns();
+		closeDisassembler();
+
+		_insns = std::move(o._insns);
+		_addr2llvm = std::move(o._addr2llvm);
+		_details = std::move(o._details);
+		_owners = std::move(o._owners);
+		_ownersEpoch = o._ownersEpoch;
+		_handle = o._handle;
+		_arch = o._arch;
+		_extraMode = o._extraMode;
+		_image = o._image;
+
+		o._details.clear();
+		o._handle = 0;
+		o._image = nullptr;
+	}
+	return *this;
+}
+
+Llvm2CapstoneInsnMap::~Llvm2CapstoneInsnMap()
+{
+	releaseCapstoneInsns();
+	closeDisassembler();
+}
+
+/**
+ * Set up disassembly of full instructions from @a image on demand.
+ * @param arch      Capstone architecture of the instructions.
+ * @param extraMode Capstone extra mode (e.g. endianness) of all instructions.
+ * @param image     Image the instructions are disassembled from. It has to
+ *                  outlive all getCapstoneInsn() calls.
+ * @return @c True if Capstone was successfully initialized, @c false
+ *         otherwise.
+ */
+bool Llvm2CapstoneInsnMap::setDisassembler(
+		cs_arch arch,
+		cs_mode extraMode,
+		const retdec::loader::Image* image)
+{
+	releaseCapstoneInsns();
+	closeDisassembler();
+
+	_arch = arch;
+	_extraMode = extraMode;
+	_image = image;
+
+	if (cs_open(_arch, _extraMode, &_handle) != CS_ERR_OK)
+	{
+		_handle = 0;
+		return false;
+	}
+	if (cs_option(_handle, CS_OPT_DETAIL, CS_OPT_ON) != CS_ERR_OK)
+	{
+		closeDisassembler();
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Add record of Capstone instruction @a i underlying LLVM-to-ASM mapping
+ * instruction @a s. The instruction itself is not kept, the caller still owns
+ * it. If there already is an instruction for @a s, nothing is changed.
+ * @param s         LLVM-to-ASM mapping instruction.
+ * @param i         Capstone instruction.
+ * @param basicMode Capstone basic mode @a i was disassembled in.
+ * @return @c True if the instruction was added, @c false otherwise.
+ */
+bool Llvm2CapstoneInsnMap::emplace(
+		llvm::StoreInst* s,
+		const cs_insn* i,
+		cs_mode basicMode)
+{
+	Insn insn;
+	insn.address = i->address;
+	insn.id = i->id;
+	insn.size = i->size;
+	insn.mode = basicMode;
+	if (!_insns.try_emplace(s, insn).second)
+	{
+		return false;
+	}
+
+	if (auto* ci = dyn_cast<ConstantInt>(s->getValueOperand()))
+	{
+		_addr2llvm[ci->getZExtValue()] = s;
+	}
+	++_ownersEpoch;
+	return true;
+}
+
+/**
+ * @return Record of Capstone instruction underlying LLVM-to-ASM mapping
+ *         instruction @a s, or @c nullptr if there is no such instruction.
+ */
+const Llvm2CapstoneInsnMap::Insn* Llvm2CapstoneInsnMap::getInsn(
+		llvm::StoreInst* s) const
+{
+	auto it = _insns.find(s);
+	return it != _insns.end() ? &it->second : nullptr;
+}
+
+/**
+ * @return Full Capstone instruction (with details) underlying LLVM-to-ASM
+ *         mapping instruction @a s, or @c nullptr if there is no such
+ *         instruction or it can not be disassembled. The instruction is
+ *         disassembled on the first request and owned by this table until
+ *         it is released by releaseCapstoneInsn() or the table is cleared.
+ */
+cs_insn* Llvm2CapstoneInsnMap::getCapstoneInsn(llvm::StoreInst* s)
+{
+	auto dit = _details.find(s);
+	if (dit != _details.end())
+	{
+		return dit->second;
+	}
+
+	auto it = _insns.find(s);
+	if (it == _insns.end())
+	{
+		return nullptr;
+	}
+
+	auto* insn = disassemble(it->second);
+	if (insn)
+	{
+		_details[s] = insn;
+	}
+	return insn;
+}
+
+/**
+ * Free the full Capstone instruction underlying LLVM-to-ASM mapping
+ * instruction @a s, if it was disassembled. Its record is kept, so it is
+ * disassembled again if it is asked for.
+ */
+void Llvm2CapstoneInsnMap::releaseCapstoneInsn(llvm::StoreInst* s)
+{
+	auto it = _details.find(s);
+	if (it != _details.end())
+	{
+		cs_free(it->second, 1);
+		_details.erase(it);
+	}
+}
+
+/**
+ * @return The last added LLVM-to-ASM mapping instruction for address @a addr
+ *         that still exists, or @c nullptr if there is no such instruction.
+ */
+llvm::StoreInst* Llvm2CapstoneInsnMap::getLlvmToAsmInstruction(
+		retdec::common::Address addr) const
+{
+	auto it = _addr2llvm.find(addr);
+	return it != _addr2llvm.end()
+			? cast_or_null<StoreInst>(static_cast<Value*>(it->second))
+			: nullptr;
+}
+
+/**
+ * @return Cached LLVM-to-ASM mapping instruction owning instruction @a i,
+ *         or @c nullptr if there is no valid cached owner.
+ *
+ * A cached owner is valid if it still exists in the same function as @a i,
+ * and no mapping instruction was added since it was cached. The decoder is
+ * the only one adding mapping instructions, and the passes running while
+ * mapping instructions exist do not reorder LLVM instructions in their
+ * functions.
+ */
+llvm::StoreInst* Llvm2CapstoneInsnMap::getOwner(llvm::Instruction* i) const
+{
+	auto it = _owners.find(i);
+	if (it == _owners.end()
+			|| it->second.epoch != _ownersEpoch
+			|| static_cast<Value*>(it->second.insn) != i)
+	{
+		return nullptr;
+	}
+
+	auto* s = cast_or_null<StoreInst>(static_cast<Value*>(it->second.owner));
+	return s && s->getParent() && s->getFunction() == i->getFunction()
+			? s
+			: nullptr;
+}
+
+/**
+ * Cache LLVM-to-ASM mapping instruction @a s as the owner of instruction @a i.
+ */
+void Llvm2CapstoneInsnMap::setOwner(llvm::Instruction* i, llvm::StoreInst* s)
+{
+	auto& o = _owners[i];
+	o.insn = i;
+	o.owner = s;
+	o.epoch = _ownersEpoch;
+}
+
+/**
+ * Disassemble full Capstone instruction described by record @a insn again.
+ * @return Instruction that must be freed by the caller, or @c nullptr if it
+ *         can not be disassembled.
+ */
+cs_insn* Llvm2CapstoneInsnMap::disassemble(const Insn& insn) const
+{
+	if (_handle == 0 || _image == nullptr)
+	{
+		return nullptr;
+	}
+
+	auto bytes = _image->getRawSegmentData(insn.address);
+	if (bytes.first == nullptr || bytes.second < insn.size)
+	{
+		return nullptr;
+	}
+
+	if (cs_option(_handle, CS_OPT_MODE, insn.mode + _extraMode) != CS_ERR_OK)
+	{
+		return nullptr;
+	}
+
+	cs_insn* res = cs_malloc(_handle);
+	const std::uint8_t* code = bytes.first;
+	std::size_t size = insn.size;
+	std::uint64_t address = insn.address;
+	bool ok = cs_disasm_iter(_handle, &code, &size, &address, res);
+
+	// The same fallback as in capstone2llvmir -- some MIPS32 instructions
+	// are disassembled only in the MIPS64 mode.
+	if (!ok && _arch == CS_ARCH_MIPS && insn.mode == CS_MODE_MIPS32)
+	{
+		code = bytes.first;
+		size = insn.size;
+		address = insn.address;
+		if (cs_option(_handle, CS_OPT_MODE, CS_MODE_MIPS64 + _extraMode)
+				== CS_ERR_OK)
+		{
+			ok = cs_disasm_iter(_handle, &code, &size, &address, res);
+		}
+	}
+
+	if (!ok)
+	{
+		cs_free(res, 1);
+		return nullptr;
+	}
+
+	assert(res->id == insn.id && res->size == insn.size);
+	return res;
+}
+
+void Llvm2CapstoneInsnMap::releaseCapstoneInsns()
+{
+	for (auto& p : _details)
+	{
+		cs_free(p.second, 1);
+	}
+	_details.clear();
+}
+
+void Llvm2CapstoneInsnMap::closeDisassembler()
+{
+	if (_handle)
+	{
+		cs_close(&_handle);
+		_handle = 0;
+	}
+}
+
+Llvm2CapstoneInsnMap::iterator Llvm2CapstoneInsnMap::begin()
+{
+	return _insns.begin();
+}
+Llvm2CapstoneInsnMap::iterator Llvm2CapstoneInsnMap::end()
+{
+	return _insns.end();
+}
+Llvm2CapstoneInsnMap::const_iterator Llvm2CapstoneInsnMap::begin() const
+{
+	return _insns.begin();
+}
+Llvm2CapstoneInsnMap::const_iterator Llvm2CapstoneInsnMap::end() const
+{
+	return _insns.end();
+}
+
+std::size_t Llvm2CapstoneInsnMap::size() const
+{
+	return _insns.size();
+}
+
+bool Llvm2CapstoneInsnMap::empty() const
+{
+	return _insns.empty();
+}
+
+/**
+ * Remove all instructions and free all disassembled ones. The disassembler
+ * is kept.
+ */
+void Llvm2CapstoneInsnMap::clear()
+{
+	releaseCapstoneInsns();
+	_insns.clear();
+	_addr2llvm.clear();
+	_owners.clear();
+}
+
+//
+//==============================================================================
+// AsmInstruction
+//==============================================================================
+//
+
 std::vector<AsmInstruction::ModuleGlobalPair> AsmInstruction::_module2global;
 std::vector<AsmInstruction::ModuleInstructionMap> AsmInstruction::_module2instMap;
 
@@ -34,9 +364,37 @@ AsmInstruction::AsmInstruction(llvm::Instruction* inst)
 		return;
 	}
 
+	// Get the special global only once, this is called for every
+	// instruction in many passes.
+	auto* gv = getLlvmToAsmGlobalVariable(inst->getModule());
+	if (gv == nullptr)
+	{
+		return;
+	}
+	auto isLlvmToAsm = [gv](Instruction* i)
+	{
+		auto* s = dyn_cast<StoreInst>(i);
+		return s && s->getPointerOperand() == gv;
+	};
+
+	auto* insns = findLlvmToCapstoneInsnMap(inst->getModule());
+	if (insns)
+	{
+		if (auto* s = insns->getOwner(inst))
+		{
+			_llvmToAsmInstr = s;
+			return;
+		}
+	}
+
+	// Walk back to the owner, and remember it for all the instructions on
+	// the way -- passes usually ask for the following instructions too.
+	SmallVector<Instruction*, 16> visited;
 	auto* bb = inst->getParent();
-	while (inst && !isLlvmToAsmInstructionPrivate(inst))
+	while (inst && !isLlvmToAsm(inst))
 	{
+		visited.push_back(inst);
+
 		if (&bb->front() == inst)
 		{
 			if (&bb->getParent()->front() == bb)
@@ -55,8 +413,15 @@ AsmInstruction::AsmInstruction(llvm::Instruction* inst)
 		}
 	}
 
-	auto* s = dyn_cast_or_null<StoreInst>(inst);
-	_llvmToAsmInstr = isLlvmToAsmInstructionPrivate(s) ? s : nullptr;
+	_llvmToAsmInstr = inst ? cast<StoreInst>(inst) : nullptr;
+
+	if (insns && _llvmToAsmInstr)
+	{
+		for (auto* i : visited)
+		{
+			insns->setOwner(i, _llvmToAsmInstr);
+		}
+	}
 }
 
 AsmInstruction::AsmInstruction(llvm::BasicBlock* bb)
@@ -94,6 +459,17 @@ AsmInstruction::AsmInstruction(llvm::Module* m, retdec::common::Address addr)
 		return;
 	}
 
+	if (auto* insns = findLlvmToCapstoneInsnMap(m))
+	{
+		if (auto* s = insns->getLlvmToAsmInstruction(addr))
+		{
+			_llvmToAsmInstr = s;
+			return;
+		}
+	}
+
+	// Mapping instructions that were not created by the decoder (e.g. in
+	// tests) are not indexed.
 	ConstantInt* ci = ConstantInt::get(
 			Type::getInt64Ty(m->getContext()),
 			addr,
@@ -182,20 +558,30 @@ const llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariablePrivate(
 	}
 }
 
-Llvm2CapstoneInsnMap& AsmInstruction::getLlvmToCapstoneInsnMap(
+Llvm2CapstoneInsnMap* AsmInstruction::findLlvmToCapstoneInsnMap(
 		const llvm::Module* m)
 {
 	for (auto& p : _module2instMap)
 	{
 		if (p.first == m)
 		{
-			return p.second;
+			return &p.second;
 		}
 	}
+	return nullptr;
+}
+
+Llvm2CapstoneInsnMap& AsmInstruction::getLlvmToCapstoneInsnMap(
+		const llvm::Module* m)
+{
+	if (auto* insns = findLlvmToCapstoneInsnMap(m))
+	{
+		return *insns;
+	}
 
 	auto it = _module2instMap.emplace(_module2instMap.end(), std::make_pair(
 			m,
-			std::map<llvm::StoreInst*, cs_insn*>()));
+			Llvm2CapstoneInsnMap()));
 	return it->second;
 }
 
@@ -343,16 +729,8 @@ bool AsmInstruction::isInvalid() const
 
 cs_insn* AsmInstruction::getCapstoneInsn() const
 {
-	for (auto& p : _module2instMap)
-	{
-		if (p.first == _llvmToAsmInstr->getModule())
-		{
-			auto it =  p.second.find(_llvmToAsmInstr);
-			return it != p.second.end() ? it->second : nullptr;
-		}
-	}
-
-	return nullptr;
+	auto* insns = findLlvmToCapstoneInsnMap(_llvmToAsmInstr->getModule());
+	return insns ? insns->getCapstoneInsn(_llvmToAsmInstr) : nullptr;
 }
 
 std::string AsmInstruction::getDsm() const
@@ -363,7 +741,9 @@ std::string AsmInstruction::getDsm() const
 
 std::size_t AsmInstruction::getByteSize() const
 {
-	return getCapstoneInsn()->size;
+	auto* insns = findLlvmToCapstoneInsnMap(_llvmToAsmInstr->getModule());
+	auto* insn = insns ? insns->getInsn(_llvmToAsmInstr) : nullptr;
+	return insn ? insn->size : 0;
 }
 
 retdec::common::Address AsmInstruction::getAddress() const
@@ -6,6 +6,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <iterator>
 
 #include "retdec/ctypes/floating_point_type.h"
 #include "retdec/ctypes/function_type.h"
@@ -32,6 +33,77 @@ namespace bin2llvmir {
 //=============================================================================
 //
 
+std::map<Lti::LtiCacheKey, std::shared_ptr<Lti::LtiFile>> Lti::_ltiCache;
+std::mutex Lti::_ltiCacheMutex;
+
+/**
+ * Map the LTI file @p filePath into memory and index its functions.
+ * Use isLoaded() to check whether the file could be read.
+ */
+Lti::LtiFile::LtiFile(
+		const std::string& filePath,
+		unsigned bitSize,
+		const ctypesparser::TypeConfig::TypeWidths& typeWidths)
+		:
+		_parser(bitSize)
+{
+	const char* data = nullptr;
+	std::size_t size = 0;
+	if (_mappedFile.open(filePath))
+	{
+		data = reinterpret_cast<const char*>(_mappedFile.getData());
+		size = _mappedFile.getSize();
+	}
+	else
+	{
+		std::ifstream file(filePath);
+		if (!file)
+		{
+			return;
+		}
+		_content.assign(
+				std::istreambuf_iterator<char>(file),
+				std::istreambuf_iterator<char>());
+		data = _content.data();
+		size = _content.size();
+	}
+
+	std::string cc = "cdecl";
+	if (retdec::utils::containsCaseInsensitive(filePath, "win"))
+	{
+		cc = "stdcall";
+	}
+
+	_parser.index(
+			data,
+			size,
+			std::make_shared<retdec::ctypes::Context>(),
+			typeWidths,
+			cc);
+	_loaded = true;
+}
+
+bool Lti::LtiFile::isLoaded() const
+{
+	return _loaded;
+}
+
+/**
+ * Get function @p name from this file, parse it if it was not needed so far.
+ * @return Function, or @c nullptr if the file does not contain it.
+ */
+std::shared_ptr<retdec::ctypes::Function> Lti::LtiFile::getFunction(
+		const std::string& name)
+{
+	if (!_parser.hasIndexedFunction(name))
+	{
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _parser.getIndexedFunction(name);
+}
+
 Lti::Lti(
 	llvm::Module *m,
 	Config *c,
@@ -43,12 +115,6 @@ Lti::Lti(
 		_typeConfig(typeConfig),
 		_image(objf)
 {
-	_ltiModule = std::make_unique<retdec::ctypes::Module>(
-			std::make_shared<retdec::ctypes::Context>());
-
-	_ltiParser = ctypesparser::JSONCTypesParser(
-			static_cast<unsigned>(c->getConfig().architecture.getBitSize()));
-
 	for (auto& l : _config->getConfig().parameters.libraryTypeInfoPaths)
 	{
 		if (retdec::utils::startsWith(retdec::utils::stripDirs(l), "cstdlib"))
@@ -96,18 +162,72 @@ Lti::Lti(
 
 void Lti::loadLtiFile(const std::string& filePath)
 {
-	std::ifstream file(filePath);
+	auto file = getParsedLtiFile(
+			filePath,
+			static_cast<unsigned>(
+					_config->getConfig().architecture.getBitSize()),
+			_typeConfig->typeWidths());
 	if (file)
 	{
-		std::string cc = "cdecl";
-		if (retdec::utils::containsCaseInsensitive(filePath, "win"))
-		{
-			cc = "stdcall";
-		}
-		_ltiParser.parseInto(file, _ltiModule, _typeConfig->typeWidths(), cc);
+		_ltiFiles.push_back(file);
+	}
+}
+
+/**
+ * Get the LTI file @p filePath indexed with the given parameters.
+ * The file is indexed only the first time it is requested, then it is taken
+ * from the process-wide cache.
+ * @return Indexed file, or @c nullptr if the file can not be read.
+ */
+std::shared_ptr<Lti::LtiFile> Lti::getParsedLtiFile(
+		const std::string& filePath,
+		unsigned bitSize,
+		const ctypesparser::TypeConfig::TypeWidths& typeWidths)
+{
+	std::lock_guard<std::mutex> lock(_ltiCacheMutex);
+
+	LtiCacheKey key(filePath, bitSize, typeWidths);
+	auto fIt = _ltiCache.find(key);
+	if (fIt != _ltiCache.end())
+	{
+		return fIt->second;
+	}
+
+	auto ret = std::make_shared<LtiFile>(filePath, bitSize, typeWidths);
+	if (!ret->isLoaded())
+	{
+		return nullptr;
+	}
+
+	_ltiCache.emplace(key, ret);
+	return ret;
+}
+
+/**
+ * Index the given LTI files in advance, so that the following decompilations
+ * of @p bitSize binaries in this process do not have to.
+ * This is useful for long-running processes that decompile many inputs.
+ */
+void Lti::preloadLtiFiles(
+		const std::set<std::string>& filePaths,
+		unsigned bitSize,
+		const ctypesparser::TypeConfig::TypeWidths& typeWidths)
+{
+	for (auto& f : filePaths)
+	{
+		getParsedLtiFile(f, bitSize, typeWidths);
 	}
 }
 
+/**
+ * Drop all the LTI files indexed so far.
+ */
+void Lti::clearCache()
+{
+	std::lock_guard<std::mutex> lock(_ltiCacheMutex);
+	_ltiCache.clear();
+}
+
 bool Lti::hasLtiFunction(const std::string& name)
 {
 	return getLtiFunction(name) != nullptr;
@@ -116,7 +236,16 @@ bool Lti::hasLtiFunction(const std::string& name)
 std::shared_ptr<retdec::ctypes::Function> Lti::getLtiFunction(
 		const std::string& name)
 {
-	return _ltiModule->getFunctionWithName(name);
+	// Files are searched in the order in which they were loaded -- the first
+	// file defining the function wins.
+	for (auto& file : _ltiFiles)
+	{
+		if (auto f = file->getFunction(name))
+		{
+			return f;
+		}
+	}
+	return nullptr;
 }
 
 /**
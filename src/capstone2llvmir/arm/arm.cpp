@@ -85,11 +85,11 @@ void Capstone2LlvmIrTranslatorArm_impl::translateInstruction(
 	cs_detail* d = i->detail;
 	cs_arm* ai = &d->arm;
 
-	auto fIt = _i2fm.find(i->id);
-	if (fIt != _i2fm.end() && fIt->second != nullptr)
-	{
-		auto f = fIt->second;
+	// The same mapping as in _i2fm, but meant for fast search.
+	static const IdTable<decltype(_i2fm)::mapped_type> i2ft(_i2fm);
 
+	if (auto f = i2ft.get(i->id))
+	{
 		bool branchInsn = i->id == ARM_INS_B || i->id == ARM_INS_BX
 				|| i->id == ARM_INS_BL || i->id == ARM_INS_BLX
 				|| i->id == ARM_INS_CBZ || i->id == ARM_INS_CBNZ;
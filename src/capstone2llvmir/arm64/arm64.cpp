@@ -327,11 +327,11 @@ void Capstone2LlvmIrTranslatorArm64_impl::translateInstruction(
 
 	//std::cout << i->mnemonic << " " << i->op_str << std::endl;
 
-	auto fIt = _i2fm.find(i->id);
-	if (fIt != _i2fm.end() && fIt->second != nullptr)
-	{
-		auto f = fIt->second;
+	// The same mapping as in _i2fm, but meant for fast search.
+	static const IdTable<decltype(_i2fm)::mapped_type> i2ft(_i2fm);
 
+	if (auto f = i2ft.get(i->id))
+	{
 		(this->*f)(i, ai, irb);
 	}
 	else
@@ -257,15 +257,7 @@ Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::translateOne(
 
 	if (disasmRes)
 	{
-		auto* a2l = generateSpecialAsm2LlvmInstr(irb, insn);
-		translateInstruction(insn, irb);
-
-		res.llvmInsn = a2l;
-		res.capstoneInsn = insn;
-		res.size = insn->size;
-		res.branchCall = _branchGenerated;
-		res.inCondition = _inCondition;
-
+		res = translateOne(insn, irb);
 		a = address;
 	}
 	else
@@ -276,6 +268,29 @@ Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::translateOne(
 	return res;
 }
 
+template <typename CInsn, typename CInsnOp>
+typename Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::TranslationResultOne
+Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::translateOne(
+		cs_insn* insn,
+		llvm::IRBuilder<>& irb)
+{
+	TranslationResultOne res;
+
+	_branchGenerated = nullptr;
+	_inCondition = false;
+
+	auto* a2l = generateSpecialAsm2LlvmInstr(irb, insn);
+	translateInstruction(insn, irb);
+
+	res.llvmInsn = a2l;
+	res.capstoneInsn = insn;
+	res.size = insn->size;
+	res.branchCall = _branchGenerated;
+	res.inCondition = _inCondition;
+
+	return res;
+}
+
 //
 //==============================================================================
 // Capstone related getters - from Capstone2LlvmIrTranslator.
@@ -333,8 +348,7 @@ std::size_t Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::getDelaySlot(uint32_
 template <typename CInsn, typename CInsnOp>
 llvm::GlobalVariable* Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::getRegister(uint32_t r)
 {
-	auto fIt = _capstone2LlvmRegs.find(r);
-	return fIt != _capstone2LlvmRegs.end() ? fIt->second : nullptr;
+	return _capstone2LlvmRegs.get(r);
 }
 
 template <typename CInsn, typename CInsnOp>
@@ -405,13 +419,13 @@ template <typename CInsn, typename CInsnOp>
 llvm::Type* Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::getRegisterType(
 		uint32_t r) const
 {
-	auto fIt = _reg2type.find(r);
-	if (fIt == _reg2type.end())
+	auto* t = _reg2typeTable.get(r);
+	if (t == nullptr)
 	{
 		throw GenericError(
 				"Missing type for register number: " + std::to_string(r));
 	}
-	return fIt->second;
+	return t;
 }
 
 template <typename CInsn, typename CInsnOp>
@@ -708,6 +722,7 @@ void Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::initialize()
 
 	initializeRegNameMap();
 	initializeRegTypeMap();
+	_reg2typeTable = IdTable<llvm::Type*>(_reg2type);
 	initializePseudoCallInstructionIDs();
 	initializeArchSpecific();
 
@@ -971,7 +986,7 @@ llvm::GlobalVariable* Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::createRegi
 	}
 
 	_llvm2CapstoneRegs[gv] = r;
-	_capstone2LlvmRegs[r] = gv;
+	_capstone2LlvmRegs.set(r, gv);
 
 	return gv;
 }
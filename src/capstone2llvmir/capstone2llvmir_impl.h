@@ -8,6 +8,9 @@
 #ifndef CAPSTONE2LLVMIR_CAPSTONE2LLVMIR_IMPL_H
 #define CAPSTONE2LLVMIR_CAPSTONE2LLVMIR_IMPL_H
 
+#include <unordered_map>
+
+#include "capstone2llvmir/id_table.h"
 #include "capstone2llvmir/llvmir_utils.h"
 #include "retdec/capstone2llvmir/capstone2llvmir.h"
 
@@ -77,6 +80,9 @@ class Capstone2LlvmIrTranslator_impl : virtual public Capstone2LlvmIrTranslator
 				std::size_t& size,
 				retdec::common::Address& a,
 				llvm::IRBuilder<>& irb) override;
+		virtual TranslationResultOne translateOne(
+				cs_insn* insn,
+				llvm::IRBuilder<>& irb) override;
 //
 //==============================================================================
 // Capstone related getters - from Capstone2LlvmIrTranslator.
@@ -637,11 +643,13 @@ class Capstone2LlvmIrTranslator_impl : virtual public Capstone2LlvmIrTranslator
 		/// Capstone provides type information for registers, so all registers
 		/// need to be manually mapped here.
 		std::map<uint32_t, llvm::Type*> _reg2type;
+		/// The same mapping as in @c _reg2type, but meant for fast search.
+		IdTable<llvm::Type*> _reg2typeTable;
 
 		/// Maps with all LLVM registers created by the translator.
 		/// Used for bidirectional queries.
-		std::map<llvm::GlobalVariable*, uint32_t> _llvm2CapstoneRegs;
-		std::map<uint32_t, llvm::GlobalVariable*> _capstone2LlvmRegs;
+		std::unordered_map<llvm::GlobalVariable*, uint32_t> _llvm2CapstoneRegs;
+		IdTable<llvm::GlobalVariable*> _capstone2LlvmRegs;
 
 		/// If the last translated instruction generated branch call, it is
 		/// stored to this member.
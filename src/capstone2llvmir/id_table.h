@@ -0,0 +1,69 @@
+/**
+ * @file src/capstone2llvmir/id_table.h
+ * @brief Table of values indexed by Capstone IDs.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_CAPSTONE2LLVMIR_ID_TABLE_H
+#define RETDEC_CAPSTONE2LLVMIR_ID_TABLE_H
+
+#include <cstddef>
+#include <vector>
+
+namespace retdec {
+namespace capstone2llvmir {
+
+/**
+ * Table of values indexed by Capstone IDs (instruction IDs, register
+ * numbers, etc.).
+ *
+ * Capstone IDs are small consecutive numbers, so the table is a vector
+ * indexed by them and a lookup takes constant time. IDs without a value are
+ * mapped to a value-initialized @c T (e.g. @c nullptr for pointers).
+ */
+template <typename T>
+class IdTable
+{
+	public:
+		IdTable() = default;
+
+		/**
+		 * Create a table with the same content as the given associative
+		 * container of (ID, value) pairs.
+		 */
+		template <typename Map>
+		explicit IdTable(const Map& m)
+		{
+			for (auto& p : m)
+			{
+				set(p.first, p.second);
+			}
+		}
+
+		void set(std::size_t id, const T& value)
+		{
+			if (id >= _values.size())
+			{
+				_values.resize(id + 1, T());
+			}
+			_values[id] = value;
+		}
+
+		T get(std::size_t id) const
+		{
+			return id < _values.size() ? _values[id] : T();
+		}
+
+		void clear()
+		{
+			_values.clear();
+		}
+
+	private:
+		std::vector<T> _values;
+};
+
+} // namespace capstone2llvmir
+} // namespace retdec
+
+#endif
@@ -107,10 +107,11 @@ void Capstone2LlvmIrTranslatorPowerpc_impl::translateInstruction(
 	cs_detail* d = i->detail;
 	cs_ppc* pi = &d->ppc;
 
-	auto fIt = _i2fm.find(i->id);
-	if (fIt != _i2fm.end() && fIt->second != nullptr)
+	// The same mapping as in _i2fm, but meant for fast search.
+	static const IdTable<decltype(_i2fm)::mapped_type> i2ft(_i2fm);
+
+	if (auto f = i2ft.get(i->id))
 	{
-		auto f = fIt->second;
 		(this->*f)(i, pi, irb);
 	}
 	else
@@ -18,6 +18,8 @@ const std::string JSON_keepAllFuncs             = "keepAllFuncs";
 const std::string JSON_selectedDecodeOnly       = "selectedDecodeOnly";
 const std::string JSON_outputFile               = "outputFile";
 const std::string JSON_ordinalNumDir            = "ordinalNumDirectory";
+const std::string JSON_staticSigsCacheDir       = "staticSignaturesCacheDirectory";
+const std::string JSON_numberOfThreads          = "numberOfThreads";
 const std::string JSON_userStaticSigPaths       = "userStaticSignPaths";
 const std::string JSON_staticSigPaths           = "staticSignPaths";
 const std::string JSON_libraryTypeInfoPaths     = "libraryTypeInfoPaths";
@@ -107,6 +109,16 @@ void Parameters::setOrdinalNumbersDirectory(const std::string& n)
 	_ordinalNumbersDirectory = n;
 }
 
+void Parameters::setStaticSignaturesCacheDirectory(const std::string& n)
+{
+	_staticSignaturesCacheDirectory = n;
+}
+
+void Parameters::setNumberOfThreads(unsigned n)
+{
+	_numberOfThreads = n;
+}
+
 std::string Parameters::getOutputFile() const
 {
 	return _outputFile;
@@ -117,6 +129,20 @@ std::string Parameters::getOrdinalNumbersDirectory() const
 	return _ordinalNumbersDirectory;
 }
 
+std::string Parameters::getStaticSignaturesCacheDirectory() const
+{
+	return _staticSignaturesCacheDirectory;
+}
+
+/**
+ * @return Maximal number of threads the decompilation may use.
+ * Zero means the number of threads supported by the hardware.
+ */
+unsigned Parameters::getNumberOfThreads() const
+{
+	return _numberOfThreads;
+}
+
 /**
  * Returns JSON object (associative array) holding parameters information.
  * @return JSON object.
@@ -131,6 +157,8 @@ void Parameters::serialize(Writer& writer) const
 	serdes::serializeBool(writer, JSON_selectedDecodeOnly, isSelectedDecodeOnly());
 	serdes::serializeString(writer, JSON_outputFile, getOutputFile());
 	serdes::serializeString(writer, JSON_ordinalNumDir, getOrdinalNumbersDirectory());
+	serdes::serializeString(writer, JSON_staticSigsCacheDir, getStaticSignaturesCacheDirectory());
+	serdes::serializeUint64(writer, JSON_numberOfThreads, getNumberOfThreads());
 
 	serdes::serializeContainer(writer, JSON_selectedRanges, selectedRanges);
 	serdes::serializeContainer(writer, JSON_userStaticSigPaths, userStaticSignaturePaths);
@@ -163,7 +191,9 @@ void Parameters::deserialize(const rapidjson::Value& val)
 	setIsKeepAllFunctions( serdes::deserializeBool(val, JSON_keepAllFuncs) );
 	setIsSelectedDecodeOnly( serdes::deserializeBool(val, JSON_selectedDecodeOnly) );
 	setOrdinalNumbersDirectory( serdes::deserializeString(val, JSON_ordinalNumDir) );
+	setStaticSignaturesCacheDirectory( serdes::deserializeString(val, JSON_staticSigsCacheDir) );
 	setOutputFile( serdes::deserializeString(val, JSON_outputFile) );
+	setNumberOfThreads( serdes::deserializeUint64(val, JSON_numberOfThreads, 1) );
 
 	serdes::deserializeContainer(val, JSON_selectedRanges, selectedRanges);
 	serdes::deserializeContainer(val, JSON_staticSigPaths, staticSignaturePaths);
@@ -62,6 +62,7 @@ void printHelp()
 	std::cout << "\t--keep-unreachable-funcs true/false" << std::endl;
 	std::cout << "\t--signatures path" << std::endl;
 	std::cout << "\t--user-signature path" << std::endl;
+	std::cout << "\t--signatures-cache path" << std::endl;
 	std::cout << "\t--types path" << std::endl;
 	std::cout << "\t--abis path" << std::endl;
 	std::cout << "\t--ords path" << std::endl;
@@ -288,6 +289,10 @@ int handleArguments(std::vector<std::string> &args)
 			{
 				config.parameters.userStaticSignaturePaths.insert(val);
 			}
+			else if (opt == "--signatures-cache")
+			{
+				config.parameters.setStaticSignaturesCacheDirectory(val);
+			}
 			else if (opt == "--types")
 			{
 				std::vector<std::string> files;
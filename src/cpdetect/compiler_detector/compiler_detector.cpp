@@ -161,6 +161,57 @@ ToolType metaToTool(const std::string &toolMeta)
 	return ToolType::UNKNOWN;
 }
 
+/**
+ * Add all YARA files from the given @p dir to @p paths.
+ */
+void collectRuleFiles(
+		const FilesystemPath& dir,
+		const std::set<std::string>& suffixes,
+		bool recursive,
+		std::vector<std::string>& paths)
+{
+	if (!dir.isDirectory())
+	{
+		return;
+	}
+
+	for (const auto *subpath : dir)
+	{
+		if (subpath->isFile()
+				&& std::any_of(suffixes.begin(), suffixes.end(),
+				[&] (const auto &suffix)
+			{
+				return endsWith(subpath->getPath(), suffix);
+			}
+		))
+		{
+			paths.push_back(subpath->getPath());
+		}
+		else if (recursive && subpath->isDirectory())
+		{
+			collectRuleFiles(*subpath, suffixes, false, paths);
+		}
+	}
+}
+
+/**
+ * Assign YARA namespaces to internal rule files. Rule sets are shared by
+ * their contents and namespaces, so this must be the same for detection and
+ * for preloading.
+ */
+std::vector<std::pair<std::string, std::string>> internalRuleFiles(
+		const std::vector<std::string>& paths)
+{
+	std::vector<std::pair<std::string, std::string>> ruleFiles;
+	unsigned iCntr = 0;
+	for (const auto &ruleFile : paths)
+	{
+		std::string nameSpace = "internal_" + std::to_string(iCntr++);
+		ruleFiles.emplace_back(ruleFile, nameSpace);
+	}
+	return ruleFiles;
+}
+
 } // anonymous namespace
 
 /**
@@ -298,28 +349,54 @@ void CompilerDetector::populateInternalPaths(
 		const retdec::utils::FilesystemPath& dir,
 		bool recursive)
 {
-	if (!dir.isDirectory())
-	{
-		return;
-	}
+	collectRuleFiles(dir, externalSuffixes, recursive, internalPaths);
+}
 
-	for (const auto *subpath : dir)
+/**
+ * Compile the internal rule sets used for PE, ELF and Mach-O inputs into
+ * the process-wide YARA rules cache, so that detections run later in this
+ * process (or in processes forked from it) do not compile them again.
+ *
+ * Every architecture has its own rule set. Rule sets of raw inputs depend on
+ * the input and are compiled on their first use.
+ */
+void CompilerDetector::preloadSignatures()
+{
+	FilesystemPath rulesDir(getThisBinaryDirectoryPath());
+	rulesDir.append(YARA_RULES_PATH);
+
+	auto preload = [](const FilesystemPath& dir, bool recursive) {
+		std::vector<std::string> paths;
+		collectRuleFiles(dir, EXTERNAL_DATABASE_SUFFIXES, recursive, paths);
+		if (!paths.empty())
+		{
+			YaraDetector yara;
+			yara.addRuleFiles(internalRuleFiles(paths));
+		}
+	};
+
+	for (const std::string format : {"pe/", "elf/", "macho/"})
 	{
-		if (subpath->isFile()
-				&& std::any_of(externalSuffixes.begin(), externalSuffixes.end(),
-				[&] (const auto &suffix)
-			{
-				return endsWith(subpath->getPath(), suffix);
-			}
-		))
+		FilesystemPath formatDir(rulesDir.getPath());
+		formatDir.append(format);
+		if (!formatDir.isDirectory())
 		{
-			internalPaths.push_back(subpath->getPath());
+			continue;
 		}
-		else if (recursive && subpath->isDirectory())
+
+		for (const auto *archDir : formatDir)
 		{
-			populateInternalPaths(*subpath);
+			if (archDir->isDirectory())
+			{
+				preload(*archDir, false);
+			}
 		}
 	}
+
+	// Fat Mach-O binaries use rules of all the architectures.
+	FilesystemPath machoDir(rulesDir.getPath());
+	machoDir.append("macho/");
+	preload(machoDir, true);
 }
 
 /**
@@ -339,15 +416,8 @@ void CompilerDetector::getAllHeuristics()
  */
 ReturnCode CompilerDetector::getAllSignatures()
 {
-	YaraDetector yara;
-
 	// Add internal paths.
-	unsigned iCntr = 0;
-	for (const auto &ruleFile : internalPaths)
-	{
-		std::string nameSpace = "internal_" + std::to_string(iCntr++);
-		yara.addRuleFile(ruleFile, nameSpace);
-	}
+	auto ruleFiles = internalRuleFiles(internalPaths);
 
 	unsigned eCntr = 0;
 	if (cpParams.external && getExternalDatabases())
@@ -355,11 +425,17 @@ ReturnCode CompilerDetector::getAllSignatures()
 		for (const auto &item : externalDatabase)
 		{
 			std::string nameSpace = "external_" + std::to_string(eCntr++);
-			yara.addRuleFile(item, nameSpace);
+			ruleFiles.emplace_back(item, nameSpace);
 		}
 	}
 
-	yara.analyze(fileParser.getPathToFile(), cpParams.searchType != SearchType::EXACT_MATCH);
+	// Rules are compiled only once per process (or once at all if a cache
+	// directory is given), which dominates the detection time otherwise.
+	YaraDetector yara;
+	yara.addRuleFiles(ruleFiles, cpParams.cacheDirectory);
+
+	const auto bytes = fileParser.getBytes();
+	yara.analyze(bytes.data(), bytes.size(), cpParams.searchType != SearchType::EXACT_MATCH);
 	const auto &detected = yara.getDetectedRules();
 	const auto &undetected = yara.getUndetectedRules();
 	auto result = false;
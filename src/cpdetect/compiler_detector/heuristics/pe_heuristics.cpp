@@ -1081,9 +1081,19 @@ void PeHeuristics::getNetHeuristic()
 		const auto start = sec->getOffset();
 		const auto end = start + sec->getLoadedSize() - 1;
 
-		const std::string sig =
-			"0000010B160C----------0208----------0D0906085961D21304091E630861D21305070811051E62110460D19D081758;";
-		if (search.findUnslashedSignature(sig, start, end))
+		// All signatures are searched in a single pass over the section.
+		// The first three belong to Phoenix, AssemblyInvoke and CliSecure,
+		// the rest to .netshrink.
+		std::vector<std::string> patterns =
+		{
+			"0000010B160C----------0208----------0D0906085961D21304091E630861D21305070811051E62110460D19D081758;",
+			"282D00000A6F2E00000A14146F2F00000A;",
+			"436C69005300650063007500720065;"
+		};
+		patterns.insert(patterns.end(), dotNetShrinkPatterns.begin(), dotNetShrinkPatterns.end());
+		const auto found = search.findUnslashedSignatures(patterns, start, end);
+
+		if (found[0])
 		{
 			version = "1.7 - 1.8";
 		}
@@ -1096,21 +1106,21 @@ void PeHeuristics::getNetHeuristic()
 			addPacker(source, strength, "Phoenix", version);
 		}
 
-		if (search.findUnslashedSignature("282D00000A6F2E00000A14146F2F00000A;", start, end))
+		if (found[1])
 		{
 			addPacker(source, strength, "AssemblyInvoke");
 		}
 
-		if (search.findUnslashedSignature("436C69005300650063007500720065;", start, end))
+		if (found[2])
 		{
 			addPacker(source, strength, "CliSecure");
 		}
 
 		// Note: Before modifying the following loop to std::any_of(),
 		//       please see #231 (compilation bug with GCC 5).
-		for (const auto& str : dotNetShrinkPatterns)
+		for (auto it = found.begin() + 3; it != found.end(); ++it)
 		{
-			if (search.findUnslashedSignature(str, start, end))
+			if (*it)
 			{
 				addPacker(source, strength, ".netshrink", "2.01 (demo)");
 				break;
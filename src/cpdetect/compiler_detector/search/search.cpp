@@ -5,6 +5,7 @@
  */
 
 #include <algorithm>
+#include <array>
 #include <map>
 
 #include "retdec/utils/container.h"
@@ -31,19 +32,71 @@ const std::map<Architecture, std::vector<Search::RelativeJump>> jumpMap =
 	{Architecture::X86_64, {Search::RelativeJump("EB", 1), Search::RelativeJump("E9", 4)}}
 };
 
+const char hexDigits[] = "0123456789ABCDEF";
+
+/**
+ * Get value of nibble in signature pattern
+ * @param c Character of signature pattern
+ * @param value Into this parameter is stored value of nibble
+ * @return @c true if @a c is a significant nibble, @c false if it is a wildcard
+ *
+ * Only uppercase hexadecimal digits are significant. Wildcards have @a value set
+ * to zero, other characters (which never match content of file) to 16.
+ */
+bool getSignatureNibble(char c, unsigned char &value)
+{
+	if(c == '-' || c == '?' || c == ';')
+	{
+		value = 0;
+		return false;
+	}
+
+	const auto *pos = std::find(hexDigits, hexDigits + 16, c);
+	value = static_cast<unsigned char>(pos - hexDigits);
+	return true;
+}
+
 } // anonymous namespace
 
 /**
  * Constructor
  * @param fileParser Parser of input file
  */
-Search::Search(retdec::fileformat::FileFormat &fileParser) : parser(fileParser), averageSlashLen(0)
+Search::Search(retdec::fileformat::FileFormat &fileParser) : parser(fileParser), content(nullptr), contentSize(0), averageSlashLen(0)
 {
-	const auto &bytes = parser.getLoadedBytes();
-	bytesToHexString(bytes, nibbles);
-	bytesToString(bytes, plain);
+	const auto bytes = parser.getLoadedBytes();
+	bytesToString(bytes.data(), bytes.size(), plain);
 	fileLoaded = !bytes.empty();
-	fileSupported = parser.hexToLittle(nibbles) && parser.getNumberOfNibblesInByte();
+	content = bytes.data();
+	contentSize = bytes.size();
+
+	// Search works with little endian representation of file content. Only big
+	// endian files need a converted copy, content of other files is used in place.
+	const auto wordSize = parser.getBytesPerWord();
+	if(parser.isUnknownEndian())
+	{
+		fileSupported = false;
+	}
+	else if(parser.isLittleEndian())
+	{
+		fileSupported = true;
+	}
+	else if(!wordSize || contentSize < wordSize)
+	{
+		fileSupported = false;
+	}
+	else
+	{
+		swappedBytes.assign(bytes.begin(), bytes.end() - contentSize % wordSize);
+		for(std::size_t i = 0, e = swappedBytes.size(); i < e; i += wordSize)
+		{
+			std::reverse(swappedBytes.begin() + i, swappedBytes.begin() + i + wordSize);
+		}
+		content = swappedBytes.data();
+		contentSize = swappedBytes.size();
+		fileSupported = true;
+	}
+	fileSupported = fileSupported && parser.getNumberOfNibblesInByte();
 	jumps = mapGetValueOrDefault(jumpMap, parser.getTargetArchitecture(), std::vector<RelativeJump>());
 
 	for(std::size_t i = 0, e = jumps.size(); i < e; ++i)
@@ -128,6 +181,117 @@ std::size_t Search::bytesFromNibbles(std::size_t nNibbles) const
 	return parser.bytesFromNibbles(nNibbles);
 }
 
+/**
+ * Get number of nibbles in content of file
+ * @return Number of nibbles in content of file
+ */
+std::size_t Search::getNumberOfNibbles() const
+{
+	return contentSize * 2;
+}
+
+/**
+ * Get nibble of file content in hexadecimal representation
+ * @param nibbleIndex Index of nibble (high nibble of byte precedes its low nibble)
+ * @return Uppercase hexadecimal digit
+ */
+char Search::getNibble(std::size_t nibbleIndex) const
+{
+	const auto byte = content[nibbleIndex / 2];
+	return hexDigits[nibbleIndex % 2 ? byte & 0x0F : byte >> 4];
+}
+
+/**
+ * Check if file content has specified nibbles on position @a nibbleIndex
+ * @param hexString Coveted nibbles as uppercase hexadecimal string
+ * @param nibbleIndex Index of first nibble in file content
+ * @return @c true if file content has @a hexString on position @a nibbleIndex,
+ *    @c false otherwise
+ */
+bool Search::hasNibblesOnPosition(const std::string &hexString, std::size_t nibbleIndex) const
+{
+	const auto nibblesSize = getNumberOfNibbles();
+	if(nibbleIndex >= nibblesSize || nibblesSize - nibbleIndex < hexString.length())
+	{
+		return false;
+	}
+
+	for(std::size_t i = 0, e = hexString.length(); i < e; ++i)
+	{
+		if(getNibble(nibbleIndex + i) != hexString[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Compile signature pattern without slashes into byte values and masks
+ * @param signPattern Signature pattern
+ * @param patternIndex Index of pattern stored into compiled patterns
+ * @param compiled Into this parameter are appended compiled patterns for both
+ *    possible alignments of the first nibble of pattern
+ * @return @c false if pattern can never match, @c true otherwise
+ */
+bool Search::compileUnslashedSignature(const std::string &signPattern, std::size_t patternIndex, std::vector<MaskedPattern> &compiled) const
+{
+	for(std::size_t alignment = 0; alignment < 2; ++alignment)
+	{
+		MaskedPattern pattern;
+		pattern.patternIndex = patternIndex;
+		pattern.alignment = alignment;
+		pattern.nibbleLength = signPattern.length();
+		const auto byteLength = (alignment + pattern.nibbleLength + 1) / 2;
+		pattern.values.assign(byteLength, 0);
+		pattern.masks.assign(byteLength, 0);
+
+		for(std::size_t i = 0, e = signPattern.length(); i < e; ++i)
+		{
+			unsigned char value = 0;
+			if(!getSignatureNibble(signPattern[i], value))
+			{
+				continue;
+			}
+			else if(value > 0x0F)
+			{
+				return false;
+			}
+
+			const auto position = alignment + i;
+			const unsigned char shift = position % 2 ? 0 : 4;
+			pattern.values[position / 2] |= value << shift;
+			pattern.masks[position / 2] |= 0x0F << shift;
+		}
+
+		const auto anchorIt = std::find(pattern.masks.begin(), pattern.masks.end(), 0xFF);
+		pattern.anchor = anchorIt == pattern.masks.end() ? std::string::npos : anchorIt - pattern.masks.begin();
+		compiled.push_back(std::move(pattern));
+	}
+
+	return true;
+}
+
+/**
+ * Check if compiled pattern matches content of file on specified byte offset
+ * @param pattern Compiled pattern
+ * @param byteOffset Offset of the first byte of pattern in file content
+ * @return @c true if pattern matches, @c false otherwise
+ */
+bool Search::matchesOnPosition(const MaskedPattern &pattern, std::size_t byteOffset) const
+{
+	for(std::size_t i = 0, e = pattern.values.size(); i < e; ++i)
+	{
+		if((content[byteOffset + i] & pattern.masks[i]) != pattern.values[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 /**
  * Check if input file was successfully loaded
  * @return @c true if file was successfully loaded, @c false otherwise
@@ -146,15 +310,6 @@ bool Search::isFileSupported() const
 	return fileSupported;
 }
 
-/**
- * Get content of file in hexadecimal string representation
- * @return Content of file in hexadecimal string representation
- */
-const std::string& Search::getNibbles() const
-{
-	return nibbles;
-}
-
 /**
  * Get content of file as plain string
  * @return Content of file as plain string
@@ -180,8 +335,8 @@ const Search::RelativeJump* Search::getRelativeJump(std::size_t fileOffset, std:
 	for(const auto &jump : jumps)
 	{
 		const auto nibblesAfter = nibblesFromBytes(jump.getBytesAfter());
-		if(!hasSubstringOnPosition(nibbles, jump.getSlash(), nibbleOffset) ||
-			(nibbleOffset + jump.getSlashNibbleSize() + nibblesAfter - 1 >= nibbles.length()))
+		if(!hasNibblesOnPosition(jump.getSlash(), nibbleOffset) ||
+			(nibbleOffset + jump.getSlashNibbleSize() + nibblesAfter - 1 >= getNumberOfNibbles()))
 		{
 			continue;
 		}
@@ -251,22 +406,95 @@ unsigned long long Search::countImpNibbles(const std::string &signPattern) const
  */
 unsigned long long Search::findUnslashedSignature(const std::string &signPattern, std::size_t startOffset, std::size_t stopOffset) const
 {
-	if(startOffset > stopOffset)
+	return findUnslashedSignatures({signPattern}, startOffset, stopOffset).front();
+}
+
+/**
+ * Method tells which of the patterns are present in selected area of file. Unable
+ *    for slashed signatures
+ * @param signPatterns Signature patterns
+ * @param startOffset Start offset in file (in bytes)
+ * @param stopOffset Stop offset in file (in bytes)
+ * @return For each pattern, number of its significant nibbles if it is present
+ *    in area, 0 otherwise
+ *
+ * All patterns are searched in one pass over the area. Each pattern is compiled
+ * into byte values and masks and indexed by its first byte without wildcards,
+ * so that only patterns whose indexed byte occurs in file are compared.
+ */
+std::vector<unsigned long long> Search::findUnslashedSignatures(const std::vector<std::string> &signPatterns, std::size_t startOffset, std::size_t stopOffset) const
+{
+	std::vector<unsigned long long> result(signPatterns.size(), 0);
+	if(startOffset > stopOffset || startOffset >= contentSize)
 	{
-		return 0;
+		return result;
+	}
+
+	// pattern may be found on nibble offsets from interval <start, limit - length>
+	const auto start = nibblesFromBytes(startOffset);
+	const auto limit = std::min(nibblesFromBytes(stopOffset) + 1, getNumberOfNibbles());
+	std::vector<MaskedPattern> compiled;
+	for(std::size_t i = 0, e = signPatterns.size(); i < e; ++i)
+	{
+		if(!signPatterns[i].empty() && signPatterns[i].length() <= limit - start)
+		{
+			compileUnslashedSignature(signPatterns[i], i, compiled);
+		}
 	}
 
-	const auto startIterator = nibbles.begin() + nibblesFromBytes(startOffset);
-	const auto stopIndex = nibblesFromBytes(stopOffset) + 1;
-	const auto stopIterator = stopIndex < nibbles.size() ? nibbles.begin() + stopIndex : nibbles.end();
-	const auto it = std::search(startIterator, stopIterator, signPattern.begin(), signPattern.end(),
-		[] (const char fileNibble, const char signatureNibble)
+	std::vector<bool> found(signPatterns.size(), false);
+	std::size_t remaining = signPatterns.size();
+	const auto lastByteOffset = [&](const MaskedPattern &pattern)
+	{
+		return (limit - pattern.nibbleLength - pattern.alignment) / 2;
+	};
+	const auto tryMatch = [&](const MaskedPattern &pattern, std::size_t byteOffset)
+	{
+		if(!found[pattern.patternIndex] && byteOffset >= startOffset &&
+			pattern.alignment + pattern.nibbleLength <= limit &&
+			byteOffset <= lastByteOffset(pattern) && matchesOnPosition(pattern, byteOffset))
 		{
-			return fileNibble == signatureNibble || signatureNibble == '-' || signatureNibble == '?' || signatureNibble == ';';
+			found[pattern.patternIndex] = true;
+			result[pattern.patternIndex] = countImpNibbles(signPatterns[pattern.patternIndex]);
+			--remaining;
 		}
-	);
+	};
 
-	return (it != stopIterator) ? countImpNibbles(signPattern) : 0;
+	// patterns consisting only of partially significant bytes cannot be indexed
+	std::array<std::vector<const MaskedPattern*>, 256> index;
+	std::size_t scanEnd = startOffset;
+	for(const auto &pattern : compiled)
+	{
+		if(pattern.alignment + pattern.nibbleLength > limit)
+		{
+			continue;
+		}
+		else if(pattern.anchor == std::string::npos)
+		{
+			for(std::size_t i = startOffset, e = lastByteOffset(pattern); i <= e && !found[pattern.patternIndex]; ++i)
+			{
+				tryMatch(pattern, i);
+			}
+		}
+		else
+		{
+			index[pattern.values[pattern.anchor]].push_back(&pattern);
+			scanEnd = std::max(scanEnd, lastByteOffset(pattern) + pattern.anchor + 1);
+		}
+	}
+
+	for(std::size_t i = startOffset; i < scanEnd && remaining; ++i)
+	{
+		for(const auto *pattern : index[content[i]])
+		{
+			if(i >= pattern->anchor)
+			{
+				tryMatch(*pattern, i - pattern->anchor);
+			}
+		}
+	}
+
+	return result;
 }
 
 /**
@@ -312,7 +540,7 @@ unsigned long long Search::findSlashedSignature(const std::string &signPattern,
  */
 unsigned long long Search::exactComparison(const std::string &signPattern, std::size_t fileOffset, std::size_t shift) const
 {
-	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = nibbles.length();
+	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = getNumberOfNibbles();
 		fileIndex < fileLen; ++sigIndex, ++fileIndex)
 	{
 		if(sigIndex == signPattern.length() || signPattern[sigIndex] == ';')
@@ -338,7 +566,7 @@ unsigned long long Search::exactComparison(const std::string &signPattern, std::
 			// move after one nibble is in header of cycle
 			fileIndex += jump->getSlashNibbleSize() + nibblesFromBytes(jump->getBytesAfter()) + moveSize - 1;
 		}
-		else if(signPattern[sigIndex] != nibbles[fileIndex] && signPattern[sigIndex] != '-' && signPattern[sigIndex] != '?')
+		else if(signPattern[sigIndex] != getNibble(fileIndex) && signPattern[sigIndex] != '-' && signPattern[sigIndex] != '?')
 		{
 			return 0;
 		}
@@ -361,7 +589,7 @@ bool Search::countSimilarity(const std::string &signPattern, Similarity &sim, st
 {
 	Similarity result;
 
-	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = nibbles.length(); fileIndex < fileLen; ++sigIndex, ++fileIndex)
+	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = getNumberOfNibbles(); fileIndex < fileLen; ++sigIndex, ++fileIndex)
 	{
 		if(sigIndex == signPattern.length() || signPattern[sigIndex] == ';')
 		{
@@ -397,7 +625,7 @@ bool Search::countSimilarity(const std::string &signPattern, Similarity &sim, st
 			}
 			continue;
 		}
-		else if(signPattern[sigIndex] == nibbles[fileIndex])
+		else if(signPattern[sigIndex] == getNibble(fileIndex))
 		{
 			++result.same;
 		}
@@ -535,7 +763,7 @@ bool Search::createSignature(std::string &pattern, std::size_t fileOffset, std::
 {
 	pattern.clear();
 
-	for(std::size_t i = 0, fileIndex = nibblesFromBytes(fileOffset), fileLen = nibbles.length(), nibbleSize = nibblesFromBytes(size);
+	for(std::size_t i = 0, fileIndex = nibblesFromBytes(fileOffset), fileLen = getNumberOfNibbles(), nibbleSize = nibblesFromBytes(size);
 		fileIndex < fileLen && i < nibbleSize; ++i, ++fileIndex)
 	{
 		std::int64_t moveSize = 0;
@@ -548,7 +776,7 @@ bool Search::createSignature(std::string &pattern, std::size_t fileOffset, std::
 		}
 		else
 		{
-			pattern += nibbles[fileIndex];
+			pattern += getNibble(fileIndex);
 		}
 	}
 
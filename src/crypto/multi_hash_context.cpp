@@ -0,0 +1,96 @@
+/**
+* @file src/crypto/multi_hash_context.cpp
+* @brief Implementation of class MultiHashContext.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <vector>
+
+#include "retdec/crypto/multi_hash_context.h"
+#include "retdec/utils/conversion.h"
+
+namespace retdec {
+namespace crypto {
+
+namespace {
+
+/// Size of blocks processed by all the algorithms at once. It is small
+/// enough for a block to stay in the L1 cache.
+constexpr std::size_t BLOCK_SIZE = 16 * 1024;
+
+} // anonymous namespace
+
+/**
+ * Constructor.
+ */
+MultiHashContext::MultiHashContext()
+{
+	MD5_Init(&_md5);
+	SHA256_Init(&_sha256);
+}
+
+/**
+ * Adds the new data to all hashes.
+ *
+ * @param data Pointer to the start of data.
+ * @param size Size of data.
+ */
+void MultiHashContext::addData(const std::uint8_t* data, std::size_t size)
+{
+	if (!data)
+	{
+		return;
+	}
+
+	while (size)
+	{
+		const auto blockSize = std::min(size, BLOCK_SIZE);
+		_crc32.add(data, blockSize);
+		MD5_Update(&_md5, data, blockSize);
+		SHA256_Update(&_sha256, data, blockSize);
+		data += blockSize;
+		size -= blockSize;
+	}
+}
+
+/**
+ * Gets CRC32 of all added data.
+ */
+std::string MultiHashContext::getCrc32()
+{
+	return _crc32.getHash();
+}
+
+/**
+ * Gets MD5 of all added data.
+ *
+ * This method may be called only once.
+ */
+std::string MultiHashContext::getMd5()
+{
+	std::vector<unsigned char> digest(MD5_DIGEST_LENGTH);
+	MD5_Final(digest.data(), &_md5);
+
+	std::string md5;
+	retdec::utils::bytesToHexString(digest, md5, 0, 0, false);
+	return md5;
+}
+
+/**
+ * Gets SHA256 of all added data.
+ *
+ * This method may be called only once.
+ */
+std::string MultiHashContext::getSha256()
+{
+	std::vector<unsigned char> digest(SHA256_DIGEST_LENGTH);
+	SHA256_Final(digest.data(), &_sha256);
+
+	std::string sha;
+	retdec::utils::bytesToHexString(digest, sha, 0, 0, false);
+	return sha;
+}
+
+} // namespace crypto
+} // namespace retdec
@@ -10,6 +10,8 @@
 #include <sstream>
 
 #include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
 
 #include "retdec/ctypes/ctypes.h"
 #include "retdec/ctypesparser/json_ctypes_parser.h"
@@ -53,6 +55,91 @@ const std::string JSON_union                = "union";
 const std::string JSON_unknown_type         = "unknown";
 const std::string JSON_void                 = "void";
 
+/**
+* @brief SAX handler which finds ranges of all functions and types in JSON
+*        without parsing them.
+*/
+class JSONIndexer: public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, JSONIndexer>
+{
+	public:
+		using Index = std::unordered_map<std::string, std::pair<std::size_t, std::size_t>>;
+
+	public:
+		JSONIndexer(const rapidjson::MemoryStream &stream, Index &functions, Index &types):
+			stream(stream), functions(functions), types(types) {}
+
+		bool Key(const char *str, rapidjson::SizeType length, bool)
+		{
+			if (depth == 1)
+			{
+				std::string key(str, length);
+				section = key == JSON_functions ? &functions
+					: key == JSON_types ? &types : nullptr;
+			}
+			else if (depth == 2)
+			{
+				name.assign(str, length);
+			}
+			return true;
+		}
+
+		bool StartObject()
+		{
+			if (depth == 1 && section)
+			{
+				(section == &functions ? hasFunctionsObject : hasTypesObject) = true;
+			}
+			else if (depth == 2 && section)
+			{
+				// The opening brace has already been read.
+				start = stream.Tell() - 1;
+			}
+			++depth;
+			return true;
+		}
+
+		bool EndObject(rapidjson::SizeType)
+		{
+			--depth;
+			if (depth == 2 && section)
+			{
+				// Only the first definition is used, like in the parser.
+				section->emplace(name, std::make_pair(start, stream.Tell() - start));
+			}
+			return true;
+		}
+
+		bool StartArray()
+		{
+			++depth;
+			return true;
+		}
+
+		bool EndArray(rapidjson::SizeType)
+		{
+			--depth;
+			return true;
+		}
+
+		bool hasFunctions() const { return hasFunctionsObject; }
+		bool hasTypes() const { return hasTypesObject; }
+
+	private:
+		const rapidjson::MemoryStream &stream;
+		Index &functions;
+		Index &types;
+		/// Section (functions or types) whose items are being read.
+		Index *section = nullptr;
+		/// Name of the item being read.
+		std::string name;
+		/// Start of the item being read.
+		std::size_t start = 0;
+		/// Nesting level of the current value.
+		std::size_t depth = 0;
+		bool hasFunctionsObject = false;
+		bool hasTypesObject = false;
+};
+
 } // anonymous namespace
 
 namespace retdec {
@@ -225,6 +312,11 @@ void JSONCTypesParser::parseInto(
 	defaultCallConv = callConvention;
 	this->typeWidths = typeWidths;
 
+	indexedJson = nullptr;
+	functionsIndex.clear();
+	typesIndex.clear();
+	indexedValues.clear();
+
 	std::string buffer = loadJson(stream);
 	// The rapidjson library requires a null-terminated string.
 	buffer.push_back('\0');
@@ -232,6 +324,113 @@ void JSONCTypesParser::parseInto(
 	parseJsonIntoModule(root, module);
 }
 
+/**
+* @brief Indexes C-types in JSON representation for lazy parsing.
+*
+* @param[in] json C-types in JSON. It is not copied, so it has to outlive the
+*                 parser. It does not need to be null-terminated.
+* @param[in] size Size of @a json.
+* @param[in] context Container for functions and types parsed later.
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* @throw CTypesParseError when the input JSON is invalid.
+*
+* Only positions of functions and types are found in @a json. Functions are
+* then parsed one by one by getIndexedFunction(), together with the types
+* they need. This is much cheaper than parseInto() when only a small part of
+* a large JSON is used.
+*/
+void JSONCTypesParser::index(
+	const char *json,
+	std::size_t size,
+	const std::shared_ptr<retdec::ctypes::Context> &context,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	assert(context && "violated precondition - context cannot be null");
+
+	this->context = context;
+	defaultCallConv = callConvention;
+	this->typeWidths = typeWidths;
+
+	parserContext.clear();
+	typesMap.clear();
+	functionsIndex.clear();
+	typesIndex.clear();
+	indexedValues.clear();
+	indexedJson = json;
+
+	rapidjson::MemoryStream stream(json, size);
+	JSONIndexer indexer(stream, functionsIndex, typesIndex);
+	rapidjson::Reader reader;
+	rapidjson::ParseResult res = reader.Parse(stream, indexer);
+	if (!res)
+	{
+		handleParsingFailure(res);
+	}
+
+	if (!indexer.hasFunctions())
+	{
+		throw CTypesParseError(JSON_functions + " must be an object value");
+	}
+	if (!indexer.hasTypes())
+	{
+		throw CTypesParseError(JSON_types + " must be an object value");
+	}
+}
+
+/**
+* @brief Checks if the JSON indexed by index() contains function @a name.
+*/
+bool JSONCTypesParser::hasIndexedFunction(const std::string &name) const
+{
+	return functionsIndex.count(name) != 0;
+}
+
+/**
+* @brief Returns function @a name from the JSON indexed by index(), parsing it
+*        when it is requested for the first time.
+*
+* @return Parsed function, or @c nullptr if there is no such function.
+*
+* @throw CTypesParseError when the function or its types are invalid.
+*/
+std::shared_ptr<retdec::ctypes::Function> JSONCTypesParser::getIndexedFunction(
+	const std::string &name)
+{
+	auto it = functionsIndex.find(name);
+	if (it == functionsIndex.end())
+	{
+		return nullptr;
+	}
+
+	auto cachedFunc = context->getFunctionWithName(name);
+	return cachedFunc ? cachedFunc :
+		parseFunction(parseIndexedValue(it->second), name);
+}
+
+/**
+* @brief Parses one value from the JSON indexed by index().
+*
+* Parsed values are kept in the parser, so that types parsed from them can
+* refer to them.
+*
+* @throw CTypesParseError when the value is invalid.
+*/
+const rapidjson::Value &JSONCTypesParser::parseIndexedValue(
+	const JSONRange &range)
+{
+	auto value = std::make_unique<rapidjson::Document>();
+	rapidjson::ParseResult res = value->Parse(indexedJson + range.first, range.second);
+	if (!res)
+	{
+		handleParsingFailure(res);
+	}
+	indexedValues.push_back(std::move(value));
+	return *indexedValues.back();
+}
+
 /**
 * @brief Loads JSON from the input stream to a string.
 */
@@ -298,10 +497,37 @@ void JSONCTypesParser::addTypesToMap(const rapidjson::Value &types)
 	typesMap.clear();
 	for (auto i = types.MemberBegin(), e = types.MemberEnd(); i != e; ++i)
 	{
-		typesMap.emplace(i->name.GetString(), i);
+		typesMap.emplace(i->name.GetString(), &i->value);
 	}
 }
 
+/**
+* @brief Returns JSON representation of type with the given key.
+*
+* Types from the JSON indexed by index() are parsed when they are requested
+* for the first time.
+*
+* @throw CTypesParseError when there is no such type.
+*/
+const rapidjson::Value &JSONCTypesParser::getJsonType(const std::string &typeKey)
+{
+	auto it = typesMap.find(typeKey);
+	if (it != typesMap.end())
+	{
+		return *it->second;
+	}
+
+	auto rangeIt = typesIndex.find(typeKey);
+	if (rangeIt == typesIndex.end())
+	{
+		throw CTypesParseError("Unknown type " + typeKey);
+	}
+
+	const auto &jsonType = parseIndexedValue(rangeIt->second);
+	typesMap.emplace(typeKey, &jsonType);
+	return jsonType;
+}
+
 /**
 * @brief Returns function from context, if already stored, otherwise parse new one.
 *
@@ -504,7 +730,7 @@ std::shared_ptr<retdec::ctypes::Type> JSONCTypesParser::getOrParseType(
 std::shared_ptr<retdec::ctypes::Type> JSONCTypesParser::parseType(
 	const std::string &typeKey)
 {
-	const rapidjson::Value &jsonType = retdec::utils::mapGetValueOrDefault(typesMap, typeKey)->value;
+	const rapidjson::Value &jsonType = getJsonType(typeKey);
 	std::string typeOfType = safeGetString(jsonType, JSON_type);
 	std::shared_ptr<retdec::ctypes::Type> parsedType;
 
@@ -38,7 +38,7 @@ DebugFormat::DebugFormat(
 		_inFile(inFile),
 		_demangler(demangler)
 {
-	_pdbFile = new retdec::pdbparser::PDBFile();
+	_pdbFile = std::make_unique<retdec::pdbparser::PDBFile>();
 	auto s = _pdbFile->load_pdb_file(pdbFile.c_str());
 
 	if (s == retdec::pdbparser::PDB_STATE_OK)
@@ -47,6 +47,7 @@ DebugFormat::DebugFormat(
 		_pdbFile->initialize(imageBase);
 		loadPdb();
 	}
+	_pdbFile.reset();
 	// else if (_dwarfFile->hasDwarfInfo())
 	// {
 	// 	LOG << "\n*** DebugFormat::DebugFormat(): DWARF" << std::endl;
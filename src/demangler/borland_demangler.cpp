@@ -83,5 +83,24 @@ std::shared_ptr<ctypes::Function> BorlandDemangler::demangleFunctionToCtypes(
 	return func;
 }
 
+/**
+ * @brief Returns the number of nodes cached in the demangling context.
+ */
+std::size_t BorlandDemangler::getContextSize() const
+{
+	return _demangleContext.size();
+}
+
+/**
+ * @brief Drops all nodes cached in the demangling context.
+ *
+ * The context grows with every demangled name, so long-running users should
+ * clear it from time to time.
+ */
+void BorlandDemangler::clearContext()
+{
+	_demangleContext.clear();
+}
+
 } // demangler
 } // retdec
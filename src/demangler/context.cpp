@@ -241,6 +241,45 @@ void Context::addArrayType(const std::shared_ptr<ArrayNode> &array) {
 	arrayNodes.emplace(key, array);
 }
 
+/**
+ * @brief Returns the number of nodes stored in the context.
+ */
+std::size_t Context::size() const
+{
+	return builtInTypes.size()
+		+ charTypes.size()
+		+ integralTypes.size()
+		+ pointerTypes.size()
+		+ referenceTypes.size()
+		+ rReferenceTypes.size()
+		+ namedTypes.size()
+		+ functions.size()
+		+ nameNodes.size()
+		+ nestedNameNodes.size()
+		+ arrayNodes.size();
+}
+
+/**
+ * @brief Removes all nodes from the context.
+ *
+ * Nodes already returned to callers stay valid, they are just no longer
+ * reused for new names.
+ */
+void Context::clear()
+{
+	builtInTypes.clear();
+	charTypes.clear();
+	integralTypes.clear();
+	pointerTypes.clear();
+	referenceTypes.clear();
+	rReferenceTypes.clear();
+	namedTypes.clear();
+	functions.clear();
+	nameNodes.clear();
+	nestedNameNodes.clear();
+	arrayNodes.clear();
+}
+
 }    // borland
 }    // demangler
 }    // retdec
@@ -0,0 +1,237 @@
+/**
+ * @file src/demangler/stream_demangler.cpp
+ * @brief Demangling of streams of names.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "retdec/demangler/demangler.h"
+#include "retdec/demangler/stream_demangler.h"
+#include "retdec/utils/thread_pool.h"
+
+namespace retdec {
+namespace demangler {
+
+namespace {
+
+/**
+ * @brief Number of names demangled in one task of @c demangleStream().
+ */
+const std::size_t batchSize = 1024;
+
+/**
+ * @brief Maximal number of names kept in the cache shared by all tasks of
+ *        @c demangleStream().
+ */
+const std::size_t sharedCacheCapacity = 1 << 16;
+
+/**
+ * @brief Maximal number of nodes kept in the context of a per-thread Borland
+ *        demangler before it is cleared.
+ */
+const std::size_t borlandContextCapacity = 1 << 16;
+
+/**
+ * @brief Cache of demangled names shared by several threads.
+ *
+ * Names are spread over several independently locked shards, so threads
+ * rarely wait for each other. Every shard holds at most its share of the
+ * capacity. When it is full, an arbitrary name is dropped to make room.
+ */
+class DemangledNameCache
+{
+	public:
+		explicit DemangledNameCache(std::size_t capacity) :
+			shardCapacity(std::max<std::size_t>(capacity / numOfShards, 1)) {}
+
+		bool get(const std::string &mangled, std::string &demangled)
+		{
+			auto &shard = getShard(mangled);
+			std::lock_guard<std::mutex> lock(shard.mutex);
+			auto it = shard.names.find(mangled);
+			if (it == shard.names.end()) {
+				return false;
+			}
+			demangled = it->second;
+			return true;
+		}
+
+		void add(const std::string &mangled, const std::string &demangled)
+		{
+			auto &shard = getShard(mangled);
+			std::lock_guard<std::mutex> lock(shard.mutex);
+			if (shard.names.size() >= shardCapacity
+					&& shard.names.find(mangled) == shard.names.end()) {
+				shard.names.erase(shard.names.begin());
+			}
+			shard.names.emplace(mangled, demangled);
+		}
+
+	private:
+		struct Shard
+		{
+			std::mutex mutex;
+			std::unordered_map<std::string, std::string> names;
+		};
+
+		static const std::size_t numOfShards = 16;
+
+		Shard &getShard(const std::string &mangled)
+		{
+			return shards[std::hash<std::string>()(mangled) % numOfShards];
+		}
+
+		std::size_t shardCapacity;
+		std::array<Shard, numOfShards> shards;
+};
+
+/**
+ * @brief Demanglers used by one thread.
+ *
+ * Demanglers are not thread-safe, so every thread has its own ones. They live
+ * as long as the thread, so the Borland demangler keeps reusing nodes created
+ * for previous names in its context.
+ */
+struct ThreadDemanglers
+{
+	ItaniumDemangler gcc;
+	MicrosoftDemangler ms;
+	BorlandDemangler borland;
+};
+
+ThreadDemanglers &getThreadDemanglers()
+{
+	thread_local ThreadDemanglers demanglers;
+	return demanglers;
+}
+
+/**
+ * @brief Demangles the given names.
+ *
+ * Symbol dumps usually contain many copies of the same names. Names repeated
+ * within the batch are demangled once without any locking, other names are
+ * looked up in @a cache shared with the remaining batches.
+ */
+std::vector<std::string> demangleBatch(
+		const std::vector<std::string> &names,
+		DemangledNameCache &cache)
+{
+	std::unordered_map<std::string, std::size_t> demangledPositions;
+	std::vector<std::string> result;
+	result.reserve(names.size());
+	for (const auto &name : names) {
+		auto it = demangledPositions.find(name);
+		if (it != demangledPositions.end()) {
+			result.push_back(result[it->second]);
+			continue;
+		}
+
+		demangledPositions.emplace(name, result.size());
+		std::string demangled;
+		if (!cache.get(name, demangled)) {
+			demangled = demangleByScheme(name);
+			cache.add(name, demangled);
+		}
+		result.push_back(std::move(demangled));
+	}
+	return result;
+}
+
+} // anonymous namespace
+
+/**
+ * @brief Demangles @a mangled by the demangler matching its mangling scheme.
+ *
+ * The scheme is detected from the prefix of the name. Every thread uses its
+ * own demanglers. The context of the Borland demangler is cleared once it
+ * holds more than @c borlandContextCapacity nodes, so it cannot grow without
+ * bound in long-running threads.
+ *
+ * @return Demangled name or @a mangled when it cannot be demangled.
+ */
+std::string demangleByScheme(const std::string &mangled)
+{
+	auto &dem = getThreadDemanglers();
+
+	std::string demangled;
+	if (mangled.compare(0, 2, "_Z") == 0 || mangled.compare(0, 3, "__Z") == 0) {
+		demangled = dem.gcc.demangleToString(mangled);
+	} else if (mangled.compare(0, 1, "?") == 0) {
+		demangled = dem.ms.demangleToString(mangled);
+	} else if (mangled.compare(0, 1, "@") == 0) {
+		demangled = dem.borland.demangleToString(mangled);
+		if (dem.borland.getContextSize() > borlandContextCapacity) {
+			dem.borland.clearContext();
+		}
+	}
+
+	return demangled.empty() ? mangled : demangled;
+}
+
+/**
+ * @brief Demangles names from @a in (one per line) and prints them into
+ *        @a out in the same order.
+ *
+ * Names are read and demangled in batches by @a numOfThreads threads (zero
+ * means one per available CPU). Only a few batches per thread are kept in
+ * memory, so arbitrarily long inputs can be processed. Demangled names are
+ * cached across batches in a bounded cache shared by all threads.
+ */
+void demangleStream(std::istream &in, std::ostream &out, std::size_t numOfThreads)
+{
+	DemangledNameCache cache(sharedCacheCapacity);
+	retdec::utils::ThreadPool pool(numOfThreads);
+	std::deque<std::future<std::vector<std::string>>> pending;
+
+	auto printFirstPending = [&]() {
+		for (const auto &name : pending.front().get()) {
+			out << name << '\n';
+		}
+		pending.pop_front();
+	};
+
+	std::vector<std::string> names;
+	std::string line;
+	while (true) {
+		bool hasLine = static_cast<bool>(std::getline(in, line));
+		if (hasLine) {
+			if (!line.empty() && line.back() == '\r') {
+				line.pop_back();
+			}
+			names.push_back(std::move(line));
+		}
+
+		if (names.size() == batchSize || (!hasLine && !names.empty())) {
+			pending.push_back(pool.submit(
+				[batch = std::move(names), &cache]() {
+					return demangleBatch(batch, cache);
+				}
+			));
+			names.clear();
+
+			if (pending.size() > 2 * pool.getNumOfThreads()) {
+				printFirstPending();
+			}
+		}
+
+		if (!hasLine) {
+			break;
+		}
+	}
+
+	while (!pending.empty()) {
+		printFirstPending();
+	}
+	out.flush();
+}
+
+}
+}
@@ -4,10 +4,15 @@
  * @copyright (c) 2019 Avast Software, licensed under the MIT license
  */
 
-#include <string>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "retdec/demangler/demangler.h"
+#include "retdec/demangler/stream_demangler.h"
 
 using ItaniumDemangler = retdec::demangler::ItaniumDemangler;
 using MicrosoftDemangler = retdec::demangler::MicrosoftDemangler;
@@ -19,13 +24,74 @@ using BorlandDemangler = retdec::demangler::BorlandDemangler;
 const std::string helpmsg =
 	"Usage:\n"
 	"\t'retdec-demangler [-h, --help]   | Show this help.\n"
-	"\t'retdec-demangler <mangledname>  | Attempt to demangle <mangledname> using all available demanglers and print result if succeded.\n";
+	"\t'retdec-demangler <mangledname>  | Attempt to demangle <mangledname> using all available demanglers and print result if succeded.\n"
+	"\t'retdec-demangler -i, --input <file> [-j, --jobs <N>]\n"
+	"\t                                 | Demangle names from <file> (one per line, '-' for the standard input)\n"
+	"\t                                 | and print one line per name, in the same order. Mangling scheme is detected\n"
+	"\t                                 | from the prefix of the name. Names that cannot be demangled are printed unchanged.\n"
+	"\t                                 | Names are demangled by <N> threads (by default, one per available CPU).\n";
 
 /**
  * @brief Main function of the Demangler tool.
  */
 int main(int argc, char *argv[])
 {
+	if (argc <= 1 || strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0) {
+		std::cout << helpmsg;
+		return 0;
+	}
+
+	std::string input;
+	std::size_t numOfThreads = 0;
+	bool batchMode = false;
+	std::vector<std::string> names;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-i") == 0 || strcmp(argv[i], "--input") == 0) {
+			if (i + 1 >= argc) {
+				std::cerr << "Error: missing input file after " << argv[i] << std::endl;
+				return 1;
+			}
+			batchMode = true;
+			input = argv[++i];
+		} else if (strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--jobs") == 0) {
+			if (i + 1 >= argc) {
+				std::cerr << "Error: missing number of jobs after " << argv[i] << std::endl;
+				return 1;
+			}
+			std::string jobs = argv[++i];
+			long long value = 0;
+			std::size_t parsed = 0;
+			try {
+				value = std::stoll(jobs, &parsed);
+			} catch (const std::exception &) {
+				parsed = 0;
+			}
+			if (parsed != jobs.size() || value <= 0) {
+				std::cerr << "Error: invalid number of jobs: " << jobs << std::endl;
+				return 1;
+			}
+			numOfThreads = static_cast<std::size_t>(value);
+		} else {
+			names.push_back(argv[i]);
+		}
+	}
+
+	if (batchMode) {
+		if (input == "-") {
+			std::ios::sync_with_stdio(false);
+			retdec::demangler::demangleStream(std::cin, std::cout, numOfThreads);
+			return 0;
+		}
+
+		std::ifstream inputFile(input);
+		if (!inputFile) {
+			std::cerr << "Error: cannot open input file: " << input << std::endl;
+			return 1;
+		}
+		retdec::demangler::demangleStream(inputFile, std::cout, numOfThreads);
+		return 0;
+	}
+
 	auto dem_gcc = std::make_unique<ItaniumDemangler>();
 	auto dem_ms = std::make_unique<MicrosoftDemangler>();
 	auto dem_borland = std::make_unique<BorlandDemangler>();
@@ -34,17 +100,12 @@ int main(int argc, char *argv[])
 	std::string demangledMs;
 	std::string demangledBorland;
 
-	if (argc <= 1 || strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0) {
-		std::cout << helpmsg;
-		return 0;
-	}
-
 	//process all mangled arguments
-	for (unsigned int i = 1; i < static_cast<unsigned int>(argc); i++) {
+	for (const auto &name : names) {
 		//demangle using all available demanglers
-		demangledGcc = dem_gcc->demangleToString(argv[i]);
-		demangledMs = dem_ms->demangleToString(argv[i]);
-		demangledBorland = dem_borland->demangleToString(argv[i]);
+		demangledGcc = dem_gcc->demangleToString(name);
+		demangledMs = dem_ms->demangleToString(name);
+		demangledBorland = dem_borland->demangleToString(name);
 
 		if (!demangledGcc.empty()) {
 			std::cout << "gcc: " << demangledGcc << std::endl;
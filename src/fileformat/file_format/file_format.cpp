@@ -10,13 +10,16 @@
 #include <cstring>
 #include <functional>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 #include <sstream>
 
-#include "retdec/crypto/crypto.h"
+#include "retdec/crypto/multi_hash_context.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/file_io.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/system.h"
+#include "retdec/utils/thread_pool.h"
 #include "retdec/fileformat/file_format/file_format.h"
 #include "retdec/fileformat/utils/byte_array_buffer.h"
 #include "retdec/fileformat/file_format/intel_hex/intel_hex_format.h"
@@ -38,75 +41,230 @@ namespace
 
 const std::size_t DefaultMinStringLength = 4;
 
+/// Size of blocks of region data scanned for all types of strings at once
+const std::size_t StringScanBlockSize = 16 * 1024;
+
 /**
- * Decide whether @a offset is part of region (section or segment) @a newRegion
- * @param actualRegion Region to which is offset currently assigned (may be @c nullptr)
- * @param newRegion Currently examined region
- * @param offset Offset in file
- * @return @c true if @a offset is in range of @a newRegion and @a actualRegion is
- *    @c nullptr or @a newRegion is subset of @a actualRegion, @c false otherwise
+ * Scanner of strings of one type in data of region (section or segment)
+ *
+ * Data are scanned incrementally, so more scanners can scan the same data
+ * block by block while the block is in cache.
+ */
+class StringScanner
+{
+	private:
+		using CharIterator = llvm::StringRef::iterator;
+
+		StringType type;                 ///< type of detected strings
+		std::size_t charSize;            ///< size of one character
+		CharacterEndianness endian;      ///< endianness of characters
+		const SecSeg *secSeg;            ///< scanned region
+		CharIterator begin;              ///< start of region data
+		CharIterator end;                ///< end of region data
+		CharIterator itr;                ///< first byte which has not been scanned yet
+		std::vector<String> &strings;    ///< detected strings
+	public:
+		StringScanner(StringType sType, std::size_t sCharSize, CharacterEndianness sEndian,
+			const SecSeg *sSecSeg, std::vector<String> &sStrings) : type(sType), charSize(sCharSize),
+			endian(sEndian), secSeg(sSecSeg), begin(sSecSeg->getBytes().begin()),
+			end(sSecSeg->getBytes().end()), itr(begin), strings(sStrings)
+		{
+
+		}
+
+		/**
+		 * Detect strings which start before the given position
+		 * @param limit First position which is not scanned
+		 *
+		 * Strings are always detected whole, so the scanner may read data
+		 * after @a limit.
+		 */
+		void scanUntil(CharIterator limit)
+		{
+			while (itr < limit)
+			{
+				if (makeCharacterIterator(itr, begin, end, charSize).pointsToValidCharacter(endian))
+				{
+					auto stringBeginItr = makeCharacterIterator(itr, begin, end, charSize);
+					auto stringDataEndItr = makeCharacterIterator(end, begin, end, charSize);
+					auto stringEndItr = stringBeginItr + 1;
+					while (stringEndItr != stringDataEndItr && stringEndItr.pointsToValidCharacter(endian))
+						++stringEndItr;
+
+					if (static_cast<std::size_t>(stringEndItr - stringBeginItr) >= DefaultMinStringLength)
+						strings.emplace_back(type, secSeg->getOffset() + (itr - begin), secSeg->getName(), std::string{stringBeginItr, stringEndItr});
+
+					itr = stringEndItr.getUnderlyingIterator();
+				}
+				else
+					++itr;
+			}
+		}
+
+		/**
+		 * Detect all strings in region
+		 */
+		void scan()
+		{
+			scanUntil(end);
+		}
+};
+
+/**
+ * Detect ASCII and wide strings in data of region (section or segment)
+ * @param secSeg Region to scan
+ * @param endian Endianness of characters
+ * @return Detected strings
+ *
+ * Both types of strings are detected in one pass over data.
  */
-bool isOffsetFromRegion(const SecSeg *actualRegion, const SecSeg *newRegion, std::size_t offset)
+std::vector<String> detectStrings(const SecSeg *secSeg, CharacterEndianness endian)
 {
-	if(!newRegion)
+	std::vector<String> strings;
+	StringScanner asciiScanner(StringType::Ascii, 1, endian, secSeg, strings);
+	StringScanner wideScanner(StringType::Wide, 2, endian, secSeg, strings);
+
+	const auto data = secSeg->getBytes();
+	for (std::size_t offset = 0; offset < data.size(); offset += StringScanBlockSize)
 	{
-		return false;
+		const auto limit = data.begin() + std::min(data.size(), offset + StringScanBlockSize);
+		asciiScanner.scanUntil(limit);
+		wideScanner.scanUntil(limit);
 	}
 
-	const auto newRegionSize = newRegion->getSizeInFile();
-	const auto actualRegionSize = (actualRegion ? actualRegion->getSizeInFile() : 0);
-	if(offset >= newRegion->getOffset() && offset - newRegion->getOffset() < newRegionSize)
+	return strings;
+}
+
+/**
+ * Get size of region (section or segment) @a region in memory
+ * @param region Examined region
+ * @return Size in memory if it is valid, size in file otherwise
+ */
+unsigned long long getRegionSizeInMemory(const SecSeg *region)
+{
+	unsigned long long size;
+	if(!region->getSizeInMemory(size))
 	{
-		if(!actualRegion || (newRegion->getOffset() > actualRegion->getOffset() ||
-			(newRegion->getOffset() == actualRegion->getOffset() && newRegionSize < actualRegionSize)))
-		{
-			return true;
-		}
+		size = region->getSizeInFile();
 	}
 
-	return false;
+	return size;
 }
 
 /**
- * Decide whether @a address is part of region (section or segment) @a newRegion
- * @param actualRegion Region to which is address currently assigned (may be @c nullptr)
- * @param newRegion Currently examined region
- * @param address Address in memory
- * @return @c true if @a address is in range of @a newRegion and @a actualRegion is
- *    @c nullptr or @a newRegion is subset of @a actualRegion, @c false otherwise
+ * Check whether index of regions (sections or segments) is up to date
+ * @param regionIndex Checked index
+ * @param regions Indexed regions
+ * @param layoutVersion Current layout version of @a regions
+ */
+template<typename I, typename T>
+bool isRegionIndexUpToDate(const I &regionIndex, const std::vector<T*> &regions, std::uint64_t layoutVersion)
+{
+	return regionIndex.isValid && regionIndex.numberOfRegions == regions.size() &&
+		regionIndex.layoutVersion == layoutVersion;
+}
+
+/**
+ * Rebuild index of regions (sections or segments)
+ * @param regionIndex Index to rebuild
+ * @param regions Indexed regions
+ * @param byAddress If @c true, regions are indexed by address in memory,
+ *    otherwise they are indexed by offset in file
+ * @param layoutVersion Layout version of the file format, it is incremented
+ *    whenever any of @a regions changes its layout
+ *
+ * Where more regions overlap, the index prefers the most nested one -- the one
+ * with the greatest start, then the smallest one, then the first one in
+ * @a regions.
  */
-bool isAddressFromRegion(const SecSeg *actualRegion, const SecSeg *newRegion, std::size_t address)
+template<typename I, typename T>
+void rebuildRegionIndex(I &regionIndex, const std::vector<T*> &regions, bool byAddress,
+	std::atomic<std::uint64_t> &layoutVersion)
 {
-	if(!newRegion)
+	struct Region
 	{
-		return false;
-	}
+		unsigned long long start;
+		unsigned long long size;
+		std::size_t position;
+	};
 
-	unsigned long long newRegionSize;
-	if(!newRegion->getSizeInMemory(newRegionSize))
+	std::vector<Region> sorted;
+	sorted.reserve(regions.size());
+	for(std::size_t i = 0; i < regions.size(); ++i)
 	{
-		newRegionSize = newRegion->getSizeInFile();
+		auto *item = regions[i];
+		if(!item)
+		{
+			continue;
+		}
+
+		item->setLayoutVersion(&layoutVersion);
+		if(byAddress)
+		{
+			if(item->getMemory())
+			{
+				sorted.push_back({item->getAddress(), getRegionSizeInMemory(item), i});
+			}
+		}
+		else
+		{
+			sorted.push_back({item->getOffset(), item->getSizeInFile(), i});
+		}
 	}
 
-	unsigned long long actualRegionSize = 0;
-	if(actualRegion)
-	{
-		if(!actualRegion->getSizeInMemory(actualRegionSize))
+	std::sort(sorted.begin(), sorted.end(),
+		[] (const auto &a, const auto &b)
 		{
-			actualRegionSize = actualRegion->getSizeInFile();
+			if(a.start != b.start)
+			{
+				return a.start > b.start;
+			}
+			return a.size != b.size ? a.size < b.size : a.position < b.position;
 		}
+	);
+
+	regionIndex.index.clear();
+	for(const auto &region : sorted)
+	{
+		regionIndex.index.addSized(region.start, region.size, regions[region.position]);
 	}
+	regionIndex.index.build();
+	regionIndex.numberOfRegions = regions.size();
+	regionIndex.layoutVersion = layoutVersion.load(std::memory_order_relaxed);
+	regionIndex.isValid = true;
+}
 
-	if(newRegion->getMemory() && address >= newRegion->getAddress() && address - newRegion->getAddress() < newRegionSize)
+/**
+ * Find region (section or segment) containing @a point in index of regions
+ * @param regionIndex Index of regions, it is rebuilt if it is out of date
+ * @param regions Indexed regions
+ * @param byAddress If @c true, regions are indexed by address in memory,
+ *    otherwise they are indexed by offset in file
+ * @param layoutVersion Layout version of the file format
+ * @param mutex Mutex guarding all the region indexes of the file format
+ * @param point Address or offset to find
+ *
+ * Lookups may run in more threads at once. Only one of them rebuilds an out
+ * of date index, the other ones wait for it.
+ */
+template<typename I, typename T>
+const SecSeg* findRegion(I &regionIndex, const std::vector<T*> &regions, bool byAddress,
+	std::atomic<std::uint64_t> &layoutVersion, std::shared_mutex &mutex, unsigned long long point)
+{
 	{
-		if(!actualRegion || (newRegion->getAddress() > actualRegion->getAddress() ||
-			(newRegion->getAddress() == actualRegion->getAddress() && newRegionSize < actualRegionSize)))
+		std::shared_lock<std::shared_mutex> lock(mutex);
+		if(isRegionIndexUpToDate(regionIndex, regions, layoutVersion.load(std::memory_order_relaxed)))
 		{
-			return true;
+			return regionIndex.index.find(point);
 		}
 	}
 
-	return false;
+	std::unique_lock<std::shared_mutex> lock(mutex);
+	if(!isRegionIndexUpToDate(regionIndex, regions, layoutVersion.load(std::memory_order_relaxed)))
+	{
+		rebuildRegionIndex(regionIndex, regions, byAddress, layoutVersion);
+	}
+	return regionIndex.index.find(point);
 }
 
 } // anonymous namespace
@@ -117,16 +275,24 @@ bool isAddressFromRegion(const SecSeg *actualRegion, const SecSeg *newRegion, st
  * @param loadFlags Load flags
  */
 FileFormat::FileFormat(const std::string & pathToFile, LoadFlags loadFlags) :
-		auxBuff(nullptr, nullptr),
+		mappedFile(pathToFile),
+		auxBuff(mappedFile.getData(), mappedFile.getSize()),
 		auxIStream(&auxBuff),
-		loadedBytes(&bytes),
 		loadFlags(loadFlags),
 		filePath(pathToFile),
-		fileStream(auxFStream),
+		fileStream(mappedFile.isOpen() ? auxIStream : auxFStream),
 		_ldrErrInfo()
 {
-	auxFStream.open(filePath, std::ifstream::binary);
-	stateIsValid = auxFStream.is_open();
+	// Files which cannot be mapped (e.g. pipes) are read into memory.
+	if(mappedFile.isOpen())
+	{
+		stateIsValid = true;
+	}
+	else
+	{
+		auxFStream.open(filePath, std::ifstream::binary);
+		stateIsValid = auxFStream.is_open();
+	}
 	init();
 }
 
@@ -138,7 +304,6 @@ FileFormat::FileFormat(const std::string & pathToFile, LoadFlags loadFlags) :
 FileFormat::FileFormat(std::istream &inputStream, LoadFlags loadFlags) :
 		auxBuff(nullptr, nullptr),
 		auxIStream(&auxBuff),
-		loadedBytes(&bytes),
 		loadFlags(loadFlags),
 		fileStream(inputStream),
 		_ldrErrInfo()
@@ -156,7 +321,6 @@ FileFormat::FileFormat(std::istream &inputStream, LoadFlags loadFlags) :
 FileFormat::FileFormat(const std::uint8_t *data, std::size_t size, LoadFlags loadFlags) :
 		auxBuff(data, size),
 		auxIStream(&auxBuff),
-		loadedBytes(&bytes),
 		loadFlags(loadFlags),
 		fileStream(auxIStream),
 		_ldrErrInfo()
@@ -188,7 +352,16 @@ void FileFormat::init()
 	tlsInfo = nullptr;
 	elfCoreInfo = nullptr;
 	fileFormat = Format::UNDETECTABLE;
-	stateIsValid = readFile(fileStream, bytes) && stateIsValid;
+	if(mappedFile.isOpen())
+	{
+		bytes = llvm::ArrayRef<unsigned char>(mappedFile.getData(), mappedFile.getSize());
+	}
+	else
+	{
+		stateIsValid = readFile(fileStream, readBytes) && stateIsValid;
+		bytes = readBytes;
+	}
+	loadedBytes = bytes;
 	if (getLoadFlags() & LoadFlags::NO_FILE_HASHES)
 	{
 		crc32.clear();
@@ -197,9 +370,11 @@ void FileFormat::init()
 	}
 	else
 	{
-		crc32 = retdec::crypto::getCrc32(bytes.data(), bytes.size());
-		md5 = retdec::crypto::getMd5(bytes.data(), bytes.size());
-		sha256 = retdec::crypto::getSha256(bytes.data(), bytes.size());
+		retdec::crypto::MultiHashContext hashes;
+		hashes.addData(bytes.data(), bytes.size());
+		crc32 = hashes.getCrc32();
+		md5 = hashes.getMd5();
+		sha256 = hashes.getSha256();
 	}
 	initStream();
 }
@@ -224,6 +399,8 @@ void FileFormat::initStream()
  */
 void FileFormat::clear()
 {
+	invalidateRegionIndexes();
+
 	delete importTable;
 	delete exportTable;
 	delete resourceTable;
@@ -266,6 +443,22 @@ void FileFormat::clear()
 	dynamicTables.clear();
 }
 
+/**
+ * Invalidate indexes of sections and segments
+ *
+ * Indexes are rebuilt automatically when the number of sections or segments
+ * changes or when any section or segment changes its layout. This method has
+ * to be called when sections or segments are reordered or replaced.
+ */
+void FileFormat::invalidateRegionIndexes()
+{
+	std::unique_lock<std::shared_mutex> lock(regionIndexMutex);
+	sectionOffsetIndex.isValid = false;
+	segmentOffsetIndex.isValid = false;
+	sectionAddressIndex.isValid = false;
+	segmentAddressIndex.isValid = false;
+}
+
 /**
  * Compute hashes of section table. This method must be called after
  * sections are loaded.
@@ -314,9 +507,11 @@ void FileFormat::computeSectionTableHashes()
 
 	if(!data.empty())
 	{
-		sectionCrc32 = retdec::crypto::getCrc32(data.data(), data.size());
-		sectionMd5 = retdec::crypto::getMd5(data.data(), data.size());
-		sectionSha256 = retdec::crypto::getSha256(data.data(), data.size());
+		retdec::crypto::MultiHashContext hashes;
+		hashes.addData(data.data(), data.size());
+		sectionCrc32 = hashes.getCrc32();
+		sectionMd5 = hashes.getMd5();
+		sectionSha256 = hashes.getSha256();
 	}
 }
 
@@ -328,7 +523,31 @@ void FileFormat::computeSectionTableHashes()
  */
 void FileFormat::setLoadedBytes(std::vector<unsigned char> *lBytes)
 {
-	loadedBytes = lBytes;
+	loadedBytes = *lBytes;
+}
+
+/**
+ * Append bytes to content of input file. Content of input file mapped into
+ * memory is copied first.
+ * @param data Bytes to append
+ * @param size Number of bytes to append
+ *
+ * Pointers to the previous content of input file are not valid after this call.
+ */
+void FileFormat::appendBytes(const unsigned char *data, std::size_t size)
+{
+	const bool loadedAreBytes = loadedBytes.data() == bytes.data();
+	if(readBytes.data() != bytes.data())
+	{
+		readBytes.assign(bytes.begin(), bytes.end());
+	}
+
+	readBytes.insert(readBytes.end(), data, data + size);
+	bytes = readBytes;
+	if(loadedAreBytes)
+	{
+		loadedBytes = bytes;
+	}
 }
 
 /**
@@ -369,14 +588,47 @@ void FileFormat::initArchitecture(
 
 /**
  * Load strings from data sections
+ *
+ * Sections (or segments) are scanned in parallel.
  */
 void FileFormat::loadStrings()
 {
 	if (!(getLoadFlags() & LoadFlags::DETECT_STRINGS))
 		return;
 
-	loadStrings(StringType::Ascii, 1);
-	loadStrings(StringType::Wide, 2);
+	std::vector<const SecSeg*> regions;
+	if (!sections.empty())
+		regions.assign(sections.begin(), sections.end());
+	else
+		regions.assign(segments.begin(), segments.end());
+
+	regions.erase(std::remove_if(regions.begin(), regions.end(),
+		[](const auto* secSeg) { return !secSeg->isSomeData() && !secSeg->isDebug(); }),
+		regions.end());
+
+	CharacterEndianness endian = isLittleEndian() ? CharacterEndianness::Little : CharacterEndianness::Big;
+	if (regions.size() > 1)
+	{
+		ThreadPool pool(std::min(regions.size(), ThreadPool::getDefaultNumOfThreads()));
+		std::vector<std::future<std::vector<String>>> results;
+		results.reserve(regions.size());
+		for (const auto* secSeg : regions)
+			results.push_back(pool.submit([secSeg, endian]() { return detectStrings(secSeg, endian); }));
+
+		for (auto& result : results)
+		{
+			auto regionStrings = result.get();
+			std::move(regionStrings.begin(), regionStrings.end(), std::back_inserter(strings));
+		}
+	}
+	else
+	{
+		for (const auto* secSeg : regions)
+		{
+			auto regionStrings = detectStrings(secSeg, endian);
+			std::move(regionStrings.begin(), regionStrings.end(), std::back_inserter(strings));
+		}
+	}
 
 	// Sort and remove duplicates
 	std::sort(strings.begin(), strings.end());
@@ -416,25 +668,7 @@ void FileFormat::loadStrings(StringType type, std::size_t charSize)
 void FileFormat::loadStrings(StringType type, std::size_t charSize, const SecSeg* secSeg)
 {
 	CharacterEndianness endian = isLittleEndian() ? CharacterEndianness::Little : CharacterEndianness::Big;
-
-	for (auto begin = secSeg->getBytes().begin(), end = secSeg->getBytes().end(), itr = begin; itr != end;)
-	{
-		if (makeCharacterIterator(itr, begin, end, charSize).pointsToValidCharacter(endian))
-		{
-			auto stringBeginItr = makeCharacterIterator(itr, begin, end, charSize);
-			auto stringDataEndItr = makeCharacterIterator(end, begin, end, charSize);
-			auto stringEndItr = stringBeginItr + 1;
-			while (stringEndItr != stringDataEndItr && stringEndItr.pointsToValidCharacter(endian))
-				++stringEndItr;
-
-			if (static_cast<std::size_t>(stringEndItr - stringBeginItr) >= DefaultMinStringLength)
-				strings.emplace_back(type, secSeg->getOffset() + (itr - begin), secSeg->getName(), std::string{stringBeginItr, stringEndItr});
-
-			itr = stringEndItr.getUnderlyingIterator();
-		}
-		else
-			++itr;
-	}
+	StringScanner(type, charSize, endian, secSeg, strings).scan();
 }
 
 /**
@@ -502,17 +736,8 @@ LoadFlags FileFormat::getLoadFlags() const
  */
 const Section* FileFormat::getSectionFromOffset(unsigned long long offset) const
 {
-	const Section *actSec = nullptr;
-
-	for(const auto *item : sections)
-	{
-		if(isOffsetFromRegion(actSec, item, offset))
-		{
-			actSec = item;
-		}
-	}
-
-	return actSec;
+	return static_cast<const Section*>(findRegion(sectionOffsetIndex, sections, false,
+		layoutVersion, regionIndexMutex, offset));
 }
 
 /**
@@ -523,17 +748,8 @@ const Section* FileFormat::getSectionFromOffset(unsigned long long offset) const
  */
 const Segment* FileFormat::getSegmentFromOffset(unsigned long long offset) const
 {
-	const Segment *actSeg = nullptr;
-
-	for(const auto *item : segments)
-	{
-		if(isOffsetFromRegion(actSeg, item, offset))
-		{
-			actSeg = item;
-		}
-	}
-
-	return actSeg;
+	return static_cast<const Segment*>(findRegion(segmentOffsetIndex, segments, false,
+		layoutVersion, regionIndexMutex, offset));
 }
 
 /**
@@ -584,17 +800,8 @@ bool FileFormat::haveDataOnOffset(unsigned long long offset) const
  */
 const Section* FileFormat::getSectionFromAddress(unsigned long long address) const
 {
-	const Section *actSec = nullptr;
-
-	for(const auto *item : sections)
-	{
-		if(isAddressFromRegion(actSec, item, address))
-		{
-			actSec = item;
-		}
-	}
-
-	return actSec;
+	return static_cast<const Section*>(findRegion(sectionAddressIndex, sections, true,
+		layoutVersion, regionIndexMutex, address));
 }
 
 /**
@@ -605,17 +812,8 @@ const Section* FileFormat::getSectionFromAddress(unsigned long long address) con
  */
 const Segment* FileFormat::getSegmentFromAddress(unsigned long long address) const
 {
-	const Segment *actSeg = nullptr;
-
-	for(const auto *item : segments)
-	{
-		if(isAddressFromRegion(actSeg, item, address))
-		{
-			actSeg = item;
-		}
-	}
-
-	return actSeg;
+	return static_cast<const Segment*>(findRegion(segmentAddressIndex, segments, true,
+		layoutVersion, regionIndexMutex, address));
 }
 
 /**
@@ -1058,7 +1256,7 @@ std::size_t FileFormat::getFileLength() const
  */
 std::size_t FileFormat::getLoadedFileLength() const
 {
-	return loadedBytes->size();
+	return loadedBytes.size();
 }
 
 /**
@@ -1192,7 +1390,7 @@ bool FileFormat::getBytes(std::vector<std::uint8_t> &result, unsigned long long
 	numberOfBytes = offset + numberOfBytes > getLoadedFileLength() ? getLoadedFileLength() - offset : numberOfBytes;
 	result.clear();
 	result.reserve(numberOfBytes);
-	std::copy(loadedBytes->begin() + offset, loadedBytes->begin() + offset + numberOfBytes, std::back_inserter(result));
+	std::copy(loadedBytes.begin() + offset, loadedBytes.begin() + offset + numberOfBytes, std::back_inserter(result));
 	return true;
 }
 
@@ -1228,7 +1426,7 @@ bool FileFormat::getEpBytes(std::vector<std::uint8_t> &result, unsigned long lon
  */
 bool FileFormat::getHexBytes(std::string &result, unsigned long long offset, unsigned long long numberOfBytes) const
 {
-	bytesToHexString(*loadedBytes, result, offset, numberOfBytes);
+	bytesToHexString(loadedBytes.data(), loadedBytes.size(), result, offset, numberOfBytes);
 	return offset < getLoadedFileLength();
 }
 
@@ -1279,7 +1477,7 @@ bool FileFormat::getHexBytesFromEnd(std::string &result, unsigned long long numb
  */
 bool FileFormat::getString(std::string &result, unsigned long long offset, unsigned long long numberOfBytes) const
 {
-	bytesToString(*loadedBytes, result, offset, numberOfBytes);
+	bytesToString(loadedBytes.data(), loadedBytes.size(), result, offset, numberOfBytes);
 	return offset < getLoadedFileLength();
 }
 
@@ -1875,7 +2073,7 @@ const std::vector<DynamicTable*>& FileFormat::getDynamicTables() const
  * Get content of input file as bytes
  * @return Content of input file as bytes
  */
-const std::vector<unsigned char>& FileFormat::getBytes() const
+llvm::ArrayRef<unsigned char> FileFormat::getBytes() const
 {
 	return bytes;
 }
@@ -1884,9 +2082,9 @@ const std::vector<unsigned char>& FileFormat::getBytes() const
  * Get serialized loaded content of input file as bytes
  * @return Serialized content of input file as bytes
  */
-const std::vector<unsigned char>& FileFormat::getLoadedBytes() const
+llvm::ArrayRef<unsigned char> FileFormat::getLoadedBytes() const
 {
-	return *loadedBytes;
+	return loadedBytes;
 }
 
 /**
@@ -1904,7 +2102,7 @@ const unsigned char* FileFormat::getBytesData() const
  */
 const unsigned char* FileFormat::getLoadedBytesData() const
 {
-	return loadedBytes->data();
+	return loadedBytes.data();
 }
 
 /**
@@ -1963,7 +2161,7 @@ bool FileFormat::getXByte(std::uint64_t address, std::uint64_t x, std::uint64_t
 	const auto secOffset = address - secSeg->getAddress();
 	const auto offset = secSeg->getOffset() + secOffset;
 	return (secOffset + x > secSeg->getLoadedSize() || offset + x > getLoadedFileLength()) ?
-		false : createValueFromBytes(*loadedBytes, res, e, offset, x);
+		false : createValueFromBytes(loadedBytes.data(), loadedBytes.size(), res, e, offset, x);
 }
 
 /**
@@ -2103,7 +2301,7 @@ bool FileFormat::getXByteOffset(std::uint64_t offset, std::uint64_t x, std::uint
 		return true;
 	}
 
-	return createValueFromBytes(*loadedBytes, res, e, offset, x);
+	return createValueFromBytes(loadedBytes.data(), loadedBytes.size(), res, e, offset, x);
 }
 
 /**
@@ -2118,7 +2316,7 @@ bool FileFormat::getXBytesOffset(std::uint64_t offset, std::uint64_t x, std::vec
 	res.clear();
 	if(offset + x <= getLoadedFileLength())
 	{
-		res.assign(loadedBytes->begin() + offset, loadedBytes->begin() + offset + x);
+		res.assign(loadedBytes.begin() + offset, loadedBytes.begin() + offset + x);
 		return res.size() == x;
 	}
 
@@ -86,6 +86,7 @@ void IntelHexFormat::initializeSections()
 			return a->getAddress() < b->getAddress();
 		}
 	);
+	invalidateRegionIndexes();
 
 	unsigned long long EIP = 0;
 	if(parser.hasEntryPoint())
@@ -6,7 +6,9 @@
 
 #include <algorithm>
 #include <cassert>
+#include <fstream>
 #include <map>
+#include <mutex>
 #include <regex>
 #include <tuple>
 #include <unordered_map>
@@ -48,6 +50,47 @@ const std::size_t STANDARD_RICH_HEADER_OFFSET = 0x80;
 const std::size_t MINIMAL_PDB_NB10_INFO_LENGTH = 17;
 const std::size_t MINIMAL_PDB_RSDS_INFO_LENGTH = 25;
 
+/**
+ * DLL lists loaded in this process, keyed by their paths. They do not depend
+ * on the input file, so they are loaded only once.
+ */
+std::mutex dllListsMutex;
+std::map<std::string, std::shared_ptr<const std::unordered_set<std::string>>> dllLists;
+
+/**
+ * Load the DLL list from @a dllListFile, or get it from the process-wide
+ * cache if it was already loaded.
+ * @return Loaded list, or @c nullptr if the file cannot be read.
+ */
+std::shared_ptr<const std::unordered_set<std::string>> loadDllList(const std::string & dllListFile)
+{
+	std::lock_guard<std::mutex> lock(dllListsMutex);
+
+	auto it = dllLists.find(dllListFile);
+	if (it != dllLists.end())
+	{
+		return it->second;
+	}
+
+	std::ifstream stream(dllListFile, std::ifstream::in);
+	if (!stream)
+	{
+		return nullptr;
+	}
+
+	auto list = std::make_shared<std::unordered_set<std::string>>();
+	std::string oneLine;
+	while(stream)
+	{
+		std::getline(stream, oneLine);
+		std::transform(oneLine.begin(), oneLine.end(), oneLine.begin(), ::tolower);
+		list->insert(oneLine);
+	}
+
+	dllLists.emplace(dllListFile, list);
+	return list;
+}
+
 const std::vector<std::string> stubDatabase =
 {
 	"This program cannot be run in DOS mode",
@@ -769,7 +812,7 @@ void PeFormat::loadRichHeader()
 	}
 
 	std::string plainText;
-	bytesToString(bytes, plainText, getMzHeaderSize(), getPeHeaderOffset() - getMzHeaderSize());
+	bytesToString(bytes.data(), bytes.size(), plainText, getMzHeaderSize(), getPeHeaderOffset() - getMzHeaderSize());
 	auto offset = getRichHeaderOffset(plainText);
 	auto standardOffset = (offset == STANDARD_RICH_HEADER_OFFSET);
 	if(offset >= getPeHeaderOffset())
@@ -3379,7 +3422,7 @@ bool PeFormat::isMissingDependency(std::string dllName) const
 
 	// If we have overriden set, use that one.
 	// Otherwise, use the default DLL set
-	const std::unordered_set<std::string> & depsDllList = (dllList.size() != 0) ? dllList : defDllList;
+	const std::unordered_set<std::string> & depsDllList = (dllList && dllList->size() != 0) ? *dllList : defDllList;
 	return (depsDllList.count(dllName) == 0);
 }
 
@@ -3397,22 +3440,14 @@ bool PeFormat::initDllList(const std::string & dllListFile)
 	// Do nothing if the DLL list is empty
 	if (dllListFile.length())
 	{
-		std::ifstream stream(dllListFile, std::ifstream::in);
-		std::string oneLine;
+		dllList = loadDllList(dllListFile);
 
 		// Do nothing if the DLL list file cannot be open
-		if (!stream)
+		if (!dllList)
 		{
 			errorLoadingDllList = true;
 			return false;
 		}
-
-		while(stream)
-		{
-			std::getline(stream, oneLine);
-			std::transform(oneLine.begin(), oneLine.end(), oneLine.begin(), ::tolower);
-			dllList.insert(oneLine);
-		}
 	}
 
 	// Sanity check
@@ -3420,6 +3455,16 @@ bool PeFormat::initDllList(const std::string & dllListFile)
 	return true;
 }
 
+/**
+ * Load the DLL list from @a dllListFile into the process-wide cache, so that
+ * PE files created later with the same list do not read it again.
+ * @return @c true if the list was loaded, @c false otherwise.
+ */
+bool PeFormat::preloadDllList(const std::string & dllListFile)
+{
+	return loadDllList(dllListFile) != nullptr;
+}
+
 /**
  * Get class of PE file
  * @return PeLib::PEFILE32 if file is 32-bit PE file, PeLib::PEFILE64 if file is
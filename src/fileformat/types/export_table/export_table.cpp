@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/crypto/crypto.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/conversion.h"
@@ -14,6 +16,64 @@ using namespace retdec::utils;
 namespace retdec {
 namespace fileformat {
 
+/**
+ * Find position of export with name @a name
+ * @param name Name of export
+ * @return Position of the first export with name @a name in table or number
+ *    of exports in table if such export is not found
+ */
+std::size_t ExportTable::findExport(const std::string &name) const
+{
+	if(!nameIndexValid)
+	{
+		nameIndex.clear();
+		nameIndex.reserve(exports.size());
+		for(std::size_t i = 0, e = exports.size(); i < e; ++i)
+		{
+			nameIndex.emplace(exports[i].getName(), i);
+		}
+		nameIndexValid = true;
+	}
+
+	const auto it = nameIndex.find(name);
+	return it != nameIndex.end() ? it->second : exports.size();
+}
+
+/**
+ * Find position of export on address @a address
+ * @param address Address of export
+ * @return Position of the first export on address @a address in table or
+ *    number of exports in table if such export is not found
+ */
+std::size_t ExportTable::findExportOnAddress(unsigned long long address) const
+{
+	if(!addressIndexValid)
+	{
+		addressIndex.clear();
+		addressIndex.reserve(exports.size());
+		for(std::size_t i = 0, e = exports.size(); i < e; ++i)
+		{
+			addressIndex.emplace_back(exports[i].getAddress(), i);
+		}
+		// Pairs with the same address are ordered by positions, so the first
+		// one belongs to the first such export in table.
+		std::sort(addressIndex.begin(), addressIndex.end());
+		addressIndexValid = true;
+	}
+
+	const auto it = std::lower_bound(addressIndex.begin(), addressIndex.end(), std::make_pair(address, std::size_t(0)));
+	return (it != addressIndex.end() && it->first == address) ? it->second : exports.size();
+}
+
+/**
+ * Drop indexes of exports, they are built again by the next lookup
+ */
+void ExportTable::invalidateIndexes()
+{
+	nameIndexValid = false;
+	addressIndexValid = false;
+}
+
 /**
  * Get number of stored exports
  * @return Number of stored exports
@@ -67,15 +127,7 @@ const Export* ExportTable::getExport(std::size_t exportIndex) const
  */
 const Export* ExportTable::getExport(const std::string &name) const
 {
-	for(const auto &e : exports)
-	{
-		if(e.getName() == name)
-		{
-			return &e;
-		}
-	}
-
-	return nullptr;
+	return getExport(findExport(name));
 }
 
 /**
@@ -85,15 +137,7 @@ const Export* ExportTable::getExport(const std::string &name) const
  */
 const Export* ExportTable::getExportOnAddress(unsigned long long address) const
 {
-	for(const auto &e : exports)
-	{
-		if(e.getAddress() == address)
-		{
-			return &e;
-		}
-	}
-
-	return nullptr;
+	return getExport(findExportOnAddress(address));
 }
 
 /**
@@ -174,6 +218,7 @@ void ExportTable::computeHashes()
 void ExportTable::clear()
 {
 	exports.clear();
+	invalidateIndexes();
 }
 
 /**
@@ -183,6 +228,7 @@ void ExportTable::clear()
 void ExportTable::addExport(Export &newExport)
 {
 	exports.push_back(newExport);
+	invalidateIndexes();
 }
 
 /**
@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/crypto/crypto.h"
 #include "retdec/utils/container.h"
 #include "retdec/utils/conversion.h"
@@ -567,6 +569,64 @@ std::string ordLookUp(const std::string& libName, const std::size_t& ordNum)
 namespace retdec {
 namespace fileformat {
 
+/**
+ * Find position of import with name @a name
+ * @param name Name of import
+ * @return Position of the first import with name @a name in table or number
+ *    of imports in table if such import is not found
+ */
+std::size_t ImportTable::findImport(const std::string &name) const
+{
+	if(!nameIndexValid)
+	{
+		nameIndex.clear();
+		nameIndex.reserve(imports.size());
+		for(std::size_t i = 0, e = imports.size(); i < e; ++i)
+		{
+			nameIndex.emplace(imports[i]->getName(), i);
+		}
+		nameIndexValid = true;
+	}
+
+	const auto it = nameIndex.find(name);
+	return it != nameIndex.end() ? it->second : imports.size();
+}
+
+/**
+ * Find position of import on address @a address
+ * @param address Address of import
+ * @return Position of the first import on address @a address in table or
+ *    number of imports in table if such import is not found
+ */
+std::size_t ImportTable::findImportOnAddress(unsigned long long address) const
+{
+	if(!addressIndexValid)
+	{
+		addressIndex.clear();
+		addressIndex.reserve(imports.size());
+		for(std::size_t i = 0, e = imports.size(); i < e; ++i)
+		{
+			addressIndex.emplace_back(imports[i]->getAddress(), i);
+		}
+		// Pairs with the same address are ordered by positions, so the first
+		// one belongs to the first such import in table.
+		std::sort(addressIndex.begin(), addressIndex.end());
+		addressIndexValid = true;
+	}
+
+	const auto it = std::lower_bound(addressIndex.begin(), addressIndex.end(), std::make_pair(address, std::size_t(0)));
+	return (it != addressIndex.end() && it->first == address) ? it->second : imports.size();
+}
+
+/**
+ * Drop indexes of imports, they are built again by the next lookup
+ */
+void ImportTable::invalidateIndexes()
+{
+	nameIndexValid = false;
+	addressIndexValid = false;
+}
+
 /**
  * Get number of libraries which are imported
  * @return Number of libraries which are imported
@@ -710,15 +770,7 @@ const Import* ImportTable::getImport(std::size_t importIndex) const
  */
 const Import* ImportTable::getImport(const std::string &name) const
 {
-	for(const auto &i : imports)
-	{
-		if(i->getName() == name)
-		{
-			return i.get();
-		}
-	}
-
-	return nullptr;
+	return getImport(findImport(name));
 }
 
 /**
@@ -728,15 +780,7 @@ const Import* ImportTable::getImport(const std::string &name) const
  */
 const Import* ImportTable::getImportOnAddress(unsigned long long address) const
 {
-	for(const auto &i : imports)
-	{
-		if(i->getAddress() == address)
-		{
-			return i.get();
-		}
-	}
-
-	return nullptr;
+	return getImport(findImportOnAddress(address));
 }
 
 /**
@@ -828,6 +872,7 @@ void ImportTable::clear()
 	impHashCrc32.clear();
 	impHashMd5.clear();
 	impHashSha256.clear();
+	invalidateIndexes();
 }
 
 /**
@@ -851,6 +896,7 @@ void ImportTable::addLibrary(std::string name, bool isMissingDependency)
 void ImportTable::addImport(std::unique_ptr<Import>&& import)
 {
 	imports.push_back(std::move(import));
+	invalidateIndexes();
 }
 
 /**
@@ -4,9 +4,10 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <sstream>
 
-#include "retdec/crypto/crypto.h"
+#include "retdec/crypto/multi_hash_context.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/string.h"
 #include "retdec/fileformat/file_format/file_format.h"
@@ -21,15 +22,55 @@ using namespace llvm;
 namespace retdec {
 namespace fileformat {
 
+namespace
+{
+
+/// Size of blocks of data passed to all consumers at once
+constexpr std::size_t ScanBlockSize = 16 * 1024;
+
+} // anonymous namespace
+
+/**
+ * Note that offset, address or size of section or segment changed
+ */
+void SecSeg::layoutChanged()
+{
+	if(layoutVersion.version)
+	{
+		layoutVersion.version->fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
 /**
  * Compute all supported hashes
+ *
+ * Entropy of section or segment data is computed in the same pass over data.
  */
 void SecSeg::computeHashes()
 {
-	const auto *hashData = reinterpret_cast<const unsigned char*>(bytes.data());
-	crc32 = retdec::crypto::getCrc32(hashData, bytes.size());
-	md5 = retdec::crypto::getMd5(hashData, bytes.size());
-	sha256 = retdec::crypto::getSha256(hashData, bytes.size());
+	const auto *data = reinterpret_cast<const std::uint8_t*>(bytes.data());
+	const auto size = bytes.size();
+	retdec::crypto::MultiHashContext hashes;
+	ByteHistogram histogram{};
+
+	for(std::size_t offset = 0; offset < size; offset += ScanBlockSize)
+	{
+		const auto blockSize = std::min(size - offset, ScanBlockSize);
+		hashes.addData(data + offset, blockSize);
+		for(std::size_t i = offset, e = offset + blockSize; i < e; ++i)
+		{
+			histogram[data[i]]++;
+		}
+	}
+
+	crc32 = hashes.getCrc32();
+	md5 = hashes.getMd5();
+	sha256 = hashes.getSha256();
+	if(data && size)
+	{
+		entropy = computeHistogramEntropy(histogram, size);
+		isEntropyValid = true;
+	}
 }
 
 /**
@@ -469,6 +510,7 @@ void SecSeg::setIndex(unsigned long long sIndex)
 void SecSeg::setOffset(unsigned long long sOffset)
 {
 	offset = sOffset;
+	layoutChanged();
 }
 
 /**
@@ -478,6 +520,7 @@ void SecSeg::setOffset(unsigned long long sOffset)
 void SecSeg::setSizeInFile(unsigned long long sFileSize)
 {
 	fileSize = sFileSize;
+	layoutChanged();
 }
 
 /**
@@ -487,6 +530,7 @@ void SecSeg::setSizeInFile(unsigned long long sFileSize)
 void SecSeg::setAddress(unsigned long long sAddress)
 {
 	address = sAddress;
+	layoutChanged();
 }
 
 /**
@@ -497,6 +541,7 @@ void SecSeg::setSizeInMemory(unsigned long long sMemorySize)
 {
 	memorySize = sMemorySize;
 	memorySizeIsValid = true;
+	layoutChanged();
 }
 
 /**
@@ -516,14 +561,17 @@ void SecSeg::setSizeOfOneEntry(unsigned long long sEntrySize)
 void SecSeg::setMemory(bool sMemory)
 {
 	isInMemory = sMemory;
+	layoutChanged();
 }
 
 /**
  * Compute entropy of section data in <0,1>
+ *
+ * Entropy computed together with hashes of loaded data is not computed again.
  */
 void SecSeg::computeEntropy()
 {
-	if (!loaded)
+	if (!loaded || isEntropyValid)
 	{
 		return;
 	}
@@ -549,6 +597,7 @@ void SecSeg::computeEntropy()
 void SecSeg::invalidateMemorySize()
 {
 	memorySizeIsValid = false;
+	layoutChanged();
 }
 
 /**
@@ -571,6 +620,7 @@ void SecSeg::invalidateEntrySize()
  */
 void SecSeg::load(const FileFormat *sOwner)
 {
+	isEntropyValid = false;
 	if(!fileSize || !sOwner || offset >= sOwner->getLoadedFileLength())
 	{
 		bytes = "";
@@ -587,6 +637,16 @@ void SecSeg::load(const FileFormat *sOwner)
 	}
 }
 
+/**
+ * Set layout version of the file format which indexes this section or segment
+ * @param sVersion Version which is incremented whenever offset, address or
+ *    size of section or segment changes
+ */
+void SecSeg::setLayoutVersion(std::atomic<std::uint64_t> *sVersion)
+{
+	layoutVersion.version = sVersion;
+}
+
 /**
  * Dump information about instance
  * @param sDump Into this parameter is stored dump of instance in an LLVM style
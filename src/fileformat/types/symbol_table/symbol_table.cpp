@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/utils/conversion.h"
 #include "retdec/fileformat/types/symbol_table/symbol_table.h"
 
@@ -12,6 +14,91 @@ using namespace retdec::utils;
 namespace retdec {
 namespace fileformat {
 
+/**
+ * Find position of symbol with name @a name
+ * @param name Name of symbol
+ * @return Position of the first symbol with name @a name in table or number
+ *    of symbols in table if such symbol is not found
+ */
+std::size_t SymbolTable::findSymbol(const std::string &name) const
+{
+	if(!nameIndexValid)
+	{
+		nameIndex.clear();
+		nameIndex.reserve(table.size());
+		for(std::size_t i = 0, e = table.size(); i < e; ++i)
+		{
+			nameIndex.emplace(table[i]->getName(), i);
+		}
+		nameIndexValid = true;
+	}
+
+	const auto it = nameIndex.find(name);
+	return it != nameIndex.end() ? it->second : table.size();
+}
+
+/**
+ * Find position of symbol on address @a addr
+ * @param addr Address of symbol
+ * @return Position of the first symbol on address @a addr in table or number
+ *    of symbols in table if such symbol is not found
+ */
+std::size_t SymbolTable::findSymbolOnAddress(unsigned long long addr) const
+{
+	if(!addressIndexValid)
+	{
+		addressIndex.clear();
+		for(std::size_t i = 0, e = table.size(); i < e; ++i)
+		{
+			unsigned long long a;
+			if(table[i]->getAddress(a))
+			{
+				addressIndex.emplace_back(a, i);
+			}
+		}
+		// Pairs with the same address are ordered by positions, so the first
+		// one belongs to the first such symbol in table.
+		std::sort(addressIndex.begin(), addressIndex.end());
+		addressIndexValid = true;
+	}
+
+	const auto it = std::lower_bound(addressIndex.begin(), addressIndex.end(), std::make_pair(addr, std::size_t(0)));
+	return (it != addressIndex.end() && it->first == addr) ? it->second : table.size();
+}
+
+/**
+ * Find position of symbol with stored index @a symbolIndex
+ * @param symbolIndex Index stored in symbol
+ * @return Position of the first symbol with index @a symbolIndex in table or
+ *    number of symbols in table if such symbol is not found
+ */
+std::size_t SymbolTable::findSymbolWithIndex(std::size_t symbolIndex) const
+{
+	if(!symbolIndexIndexValid)
+	{
+		symbolIndexIndex.clear();
+		symbolIndexIndex.reserve(table.size());
+		for(std::size_t i = 0, e = table.size(); i < e; ++i)
+		{
+			symbolIndexIndex.emplace(table[i]->getIndex(), i);
+		}
+		symbolIndexIndexValid = true;
+	}
+
+	const auto it = symbolIndexIndex.find(symbolIndex);
+	return it != symbolIndexIndex.end() ? it->second : table.size();
+}
+
+/**
+ * Drop indexes of symbols, they are built again by the next lookup
+ */
+void SymbolTable::invalidateIndexes()
+{
+	nameIndexValid = false;
+	addressIndexValid = false;
+	symbolIndexIndexValid = false;
+}
+
 /**
  * Get number of symbols in table
  * @return Number of symbols in table
@@ -38,15 +125,7 @@ const Symbol* SymbolTable::getSymbol(std::size_t symbolIndex) const
  */
 const Symbol* SymbolTable::getSymbol(const std::string &name) const
 {
-	for(const auto &s : table)
-	{
-		if(s->getName() == name)
-		{
-			return s.get();
-		}
-	}
-
-	return nullptr;
+	return getSymbol(findSymbol(name));
 }
 
 /**
@@ -56,16 +135,7 @@ const Symbol* SymbolTable::getSymbol(const std::string &name) const
  */
 const Symbol* SymbolTable::getSymbolOnAddress(unsigned long long addr) const
 {
-	for(const auto &s : table)
-	{
-		unsigned long long a;
-		if(s->getAddress(a) && a == addr)
-		{
-			return s.get();
-		}
-	}
-
-	return nullptr;
+	return getSymbol(findSymbolOnAddress(addr));
 }
 
 /**
@@ -75,15 +145,7 @@ const Symbol* SymbolTable::getSymbolOnAddress(unsigned long long addr) const
  */
 const Symbol* SymbolTable::getSymbolWithIndex(std::size_t symbolIndex) const
 {
-	for(const auto &s : table)
-	{
-		if(s->getIndex() == symbolIndex)
-		{
-			return s.get();
-		}
-	}
-
-	return nullptr;
+	return getSymbol(findSymbolWithIndex(symbolIndex));
 }
 
 /**
@@ -102,6 +164,7 @@ const std::string& SymbolTable::getName() const
  */
 Symbol* SymbolTable::getSymbol(std::size_t symbolIndex)
 {
+	invalidateIndexes();
 	return (symbolIndex < getNumberOfSymbols()) ? table[symbolIndex].get() : nullptr;
 }
 
@@ -112,15 +175,8 @@ Symbol* SymbolTable::getSymbol(std::size_t symbolIndex)
  */
 Symbol* SymbolTable::getSymbol(const std::string &name)
 {
-	for(auto &s : table)
-	{
-		if(s->getName() == name)
-		{
-			return s.get();
-		}
-	}
-
-	return nullptr;
+	const auto pos = findSymbol(name);
+	return pos < table.size() ? table[pos].get() : nullptr;
 }
 
 /**
@@ -130,16 +186,8 @@ Symbol* SymbolTable::getSymbol(const std::string &name)
  */
 Symbol* SymbolTable::getSymbolOnAddress(unsigned long long addr)
 {
-	for(auto &s : table)
-	{
-		unsigned long long a;
-		if(s->getAddress(a) && a == addr)
-		{
-			return s.get();
-		}
-	}
-
-	return nullptr;
+	const auto pos = findSymbolOnAddress(addr);
+	return pos < table.size() ? table[pos].get() : nullptr;
 }
 
 /**
@@ -149,15 +197,8 @@ Symbol* SymbolTable::getSymbolOnAddress(unsigned long long addr)
  */
 Symbol* SymbolTable::getSymbolWithIndex(std::size_t symbolIndex)
 {
-	for(auto &s : table)
-	{
-		if(s->getIndex() == symbolIndex)
-		{
-			return s.get();
-		}
-	}
-
-	return nullptr;
+	const auto pos = findSymbolWithIndex(symbolIndex);
+	return pos < table.size() ? table[pos].get() : nullptr;
 }
 
 /**
@@ -175,6 +216,7 @@ SymbolTable::symbolsConstIterator SymbolTable::begin() const
  */
 SymbolTable::symbolsIterator SymbolTable::begin()
 {
+	invalidateIndexes();
 	return table.begin();
 }
 
@@ -193,6 +235,7 @@ SymbolTable::symbolsConstIterator SymbolTable::end() const
  */
 SymbolTable::symbolsIterator SymbolTable::end()
 {
+	invalidateIndexes();
 	return table.end();
 }
 
@@ -202,6 +245,7 @@ SymbolTable::symbolsIterator SymbolTable::end()
 void SymbolTable::clear()
 {
 	table.clear();
+	invalidateIndexes();
 }
 
 /**
@@ -211,6 +255,7 @@ void SymbolTable::clear()
 void SymbolTable::addSymbol(const std::shared_ptr<Symbol> &symbol)
 {
 	table.push_back(symbol);
+	invalidateIndexes();
 }
 
 /**
@@ -220,6 +265,7 @@ void SymbolTable::addSymbol(const std::shared_ptr<Symbol> &symbol)
 void SymbolTable::addSymbol(std::shared_ptr<Symbol> &&symbol)
 {
 	table.push_back(std::move(symbol));
+	invalidateIndexes();
 }
 
 /**
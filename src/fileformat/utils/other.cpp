@@ -488,8 +488,7 @@ std::string codePageToStr(std::size_t cpage)
  */
 double computeDataEntropy(const std::uint8_t *data, std::size_t dataLen)
 {
-	std::array<std::size_t, 256> histogram{};
-	double entropy = 0;
+	ByteHistogram histogram{};
 
 	if (!data)
 	{
@@ -501,6 +500,19 @@ double computeDataEntropy(const std::uint8_t *data, std::size_t dataLen)
 		histogram[data[i]]++;
 	}
 
+	return computeHistogramEntropy(histogram, dataLen);
+}
+
+/*
+ * Compute entropy of data from their histogram
+ * @param histogram Number of occurrences of every byte value in data
+ * @param dataLen Length of data
+ * @return entropy in <0,8>
+ */
+double computeHistogramEntropy(const ByteHistogram &histogram, std::size_t dataLen)
+{
+	double entropy = 0;
+
 	for (auto frequency : histogram)
 	{
 		if (frequency)
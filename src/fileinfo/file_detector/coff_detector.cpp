@@ -195,7 +195,7 @@ void CoffDetector::getCoffSymbols()
 		index += symbolRef.getNumberOfAuxSymbols() + 1;
 	}
 
-	fileInfo.addSymbolTable(symbolTable);
+	fileInfo.addSymbolTable(std::move(symbolTable));
 }
 
 /**
@@ -231,7 +231,7 @@ void CoffDetector::getCoffRelocations()
 			relTable.addRelocation(rel);
 		}
 
-		fileInfo.addRelocationTable(relTable);
+		fileInfo.addRelocationTable(std::move(relTable));
 	}
 }
 
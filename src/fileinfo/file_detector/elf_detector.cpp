@@ -915,7 +915,7 @@ void ElfDetector::getSymbolTable()
 		{
 			symbolTable.addSpecialInformation(specInfo);
 		}
-		fileInfo.addSymbolTable(symbolTable);
+		fileInfo.addSymbolTable(std::move(symbolTable));
 	}
 }
 
@@ -992,7 +992,7 @@ void ElfDetector::getRelocationTable(const ELFIO::section *sec)
 		}
 	}
 	relocationTable.setTableName(sec->get_name());
-	fileInfo.addRelocationTable(relocationTable);
+	fileInfo.addRelocationTable(std::move(relocationTable));
 	delete relocations;
 }
 
@@ -1040,7 +1040,7 @@ void ElfDetector::getDynamicSectionsSegments()
 			dynamicSection.addEntry(dynamicEntry);
 		}
 
-		fileInfo.addDynamicSection(dynamicSection);
+		fileInfo.addDynamicSection(std::move(dynamicSection));
 	}
 }
 
@@ -128,16 +128,15 @@ void MachODetector::getSections()
  */
 void MachODetector::getSymbols()
 {
-	SymbolTable symbolTable;
 	Symbol symbol;
 
-	/// @todo table offset, number of symbols
-	// symbolTable.setTableOffset();
-	// symbolTable.setNumberOfDeclaredSymbols();
-
 	for(auto tabPtr : machoParser->getSymbolTables())
 	{
-		symbolTable.clearSymbols();
+		SymbolTable symbolTable;
+
+		/// @todo table offset, number of symbols
+		// symbolTable.setTableOffset();
+		// symbolTable.setNumberOfDeclaredSymbols();
 
 		for(const auto& symPtr : *tabPtr)
 		{
@@ -170,7 +169,7 @@ void MachODetector::getSymbols()
 			symbolTable.addSymbol(symbol);
 		}
 
-		fileInfo.addSymbolTable(symbolTable);
+		fileInfo.addSymbolTable(std::move(symbolTable));
 	}
 }
 
@@ -235,7 +234,7 @@ void MachODetector::getRelocations()
 			relTable.addRelocation(relocation);
 		}
 
-		fileInfo.addRelocationTable(relTable);
+		fileInfo.addRelocationTable(std::move(relTable));
 	}
 }
 
@@ -175,7 +175,7 @@ void PeDetector::getCoffSymbols()
 		symbolTable.addSymbol(symbol);
 	}
 
-	fileInfo.addSymbolTable(symbolTable);
+	fileInfo.addSymbolTable(std::move(symbolTable));
 }
 
 /**
@@ -188,7 +188,7 @@ void PeDetector::getRelocationTableInfo()
 	{
 		RelocationTable relTable;
 		relTable.setNumberOfDeclaredRelocations(relocs);
-		fileInfo.addRelocationTable(relTable);
+		fileInfo.addRelocationTable(std::move(relTable));
 	}
 }
 
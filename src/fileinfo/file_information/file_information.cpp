@@ -4529,28 +4529,30 @@ void FileInformation::addSection(FileSection &fileSection)
 /**
  * Add symbol table
  * @param table Symbol table
+ *
+ * The table is moved, so large tables are not held in memory twice.
  */
-void FileInformation::addSymbolTable(SymbolTable &table)
+void FileInformation::addSymbolTable(SymbolTable &&table)
 {
-	symbolTables.push_back(table);
+	symbolTables.push_back(std::move(table));
 }
 
 /**
  * Add relocation table
  * @param table Relocation table
  */
-void FileInformation::addRelocationTable(RelocationTable &table)
+void FileInformation::addRelocationTable(RelocationTable &&table)
 {
-	relocationTables.push_back(table);
+	relocationTables.push_back(std::move(table));
 }
 
 /**
  * Add dynamic section
  * @param section Dynamic section
  */
-void FileInformation::addDynamicSection(DynamicSection &section)
+void FileInformation::addDynamicSection(DynamicSection &&section)
 {
-	dynamicSections.push_back(section);
+	dynamicSections.push_back(std::move(section));
 }
 
 /**
@@ -637,9 +637,9 @@ class FileInformation
 		void addDataDirectory(DataDirectory &dataDirectory);
 		void addSegment(FileSegment &fileSegment);
 		void addSection(FileSection &fileSection);
-		void addSymbolTable(SymbolTable &table);
-		void addRelocationTable(RelocationTable &table);
-		void addDynamicSection(DynamicSection &section);
+		void addSymbolTable(SymbolTable &&table);
+		void addRelocationTable(RelocationTable &&table);
+		void addDynamicSection(DynamicSection &&section);
 		void addElfNotes(ElfNotes &notes);
 		void addFileMapEntry(const FileMapEntry& entry);
 		void addAuxVectorEntry(const std::string& name, std::size_t value);
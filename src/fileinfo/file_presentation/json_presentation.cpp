@@ -4,7 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
-#include <iostream>
+#include <cstdio>
 
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/string.h"
@@ -1218,10 +1218,19 @@ void JsonPresentation::presentIterativeSubtitle(
 	}
 }
 
+/**
+ * Present all information on the standard output
+ *
+ * All information is collected before this is called. Only its serialized
+ * form is written through a fixed-size buffer, so the text of large tables
+ * (symbols, relocations, strings, ...) is not kept in memory in addition
+ * to the collected information.
+ */
 bool JsonPresentation::present()
 {
-	rapidjson::StringBuffer sb;
-	Writer writer(sb);
+	char buffer[64 * 1024];
+	rapidjson::FileWriteStream os(stdout, buffer, sizeof(buffer));
+	Writer writer(os);
 	writer.StartObject();
 
 	serializeString(writer, "inputFile", fileinfo.getPathToFile());
@@ -1284,9 +1293,10 @@ bool JsonPresentation::present()
 	presentIterativeSubtitle(writer, StringsJsonGetter(fileinfo));
 
 	writer.EndObject();
-	std::cout << sb.GetString() << std::endl;
+	os.Put('\n');
+	os.Flush();
 
-	return true;
+	return !std::ferror(stdout);
 }
 
 } // namespace fileinfo
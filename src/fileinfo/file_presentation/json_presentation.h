@@ -7,9 +7,9 @@
 #ifndef FILEINFO_FILE_PRESENTATION_JSON_PRESENTATION_H
 #define FILEINFO_FILE_PRESENTATION_JSON_PRESENTATION_H
 
-#include <rapidjson/prettywriter.h>
-#include <rapidjson/stringbuffer.h>
 #include <rapidjson/encodings.h>
+#include <rapidjson/filewritestream.h>
+#include <rapidjson/prettywriter.h>
 
 #include "fileinfo/file_presentation/file_presentation.h"
 #include "fileinfo/file_presentation/getters/iterative_getter/iterative_subtitle_getter/iterative_subtitle_getter.h"
@@ -23,7 +23,7 @@ class JsonPresentation : public FilePresentation
 {
 	public:
 		using Writer = rapidjson::PrettyWriter<
-				rapidjson::StringBuffer,
+				rapidjson::FileWriteStream,
 				rapidjson::ASCII<>>;
 
 	private:
@@ -51,6 +51,7 @@ struct ProgParams
 	std::set<std::string> yaraMalwarePaths; ///< paths to YARA malware rules
 	std::set<std::string> yaraCryptoPaths;  ///< paths to YARA crypto rules
 	std::set<std::string> yaraOtherPaths;   ///< paths to YARA other rules
+	std::string yaraCacheDirectory;         ///< directory with cached compiled YARA rules
 	std::size_t maxMemory;                  ///< maximal memory
 	bool maxMemoryHalfRAM;                  ///< limit maximal memory to half of system RAM
 	std::size_t epBytesCount;               ///< number of bytes to load from entry point
@@ -145,6 +146,10 @@ void printHelp()
 				<< "    --other=fileOrDir, -o=fileOrDir\n"
 				<< "                          Path to other YARA rules.\n"
 				<< "\n"
+				<< "Options for caching of compiled YARA rules:\n"
+				<< "    --yara-cache-dir=dir  Existing directory where compiled YARA rules are\n"
+				<< "                          cached between runs, so they are not compiled again.\n"
+				<< "\n"
 				<< "Options for specifying output format:\n"
 				<< "  From this group, only one option can be used. If no option is used, program\n"
 				<< "  works with option \"--plain\".\n"
@@ -216,7 +221,8 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 	std::vector<std::string> argv;
 
 	std::set<std::string> withArgs = {"malware", "m", "crypto", "C", "other",
-			"o", "config", "c", "no-hashes", "max-memory", "ep-bytes", "dlls"};
+			"o", "config", "c", "no-hashes", "max-memory", "ep-bytes", "dlls",
+			"yara-cache-dir"};
 	for (int i = 1; i < argc; ++i)
 	{
 		std::string a = _argv[i];
@@ -308,6 +314,10 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 		{
 			params.yaraOtherPaths.insert(getParamOrDie(argv, i));
 		}
+		else if (c == "--yara-cache-dir")
+		{
+			params.yaraCacheDirectory = getParamOrDie(argv, i);
+		}
 		else if (c == "--max-memory")
 		{
 			auto maxMemoryString = getParamOrDie(argv, i);
@@ -439,6 +449,7 @@ int main(int argc, char* argv[])
 	}
 
 	DetectParams searchPar(params.searchMode, params.internalDatabase, params.externalDatabase, params.epBytesCount);
+	searchPar.cacheDirectory = params.yaraCacheDirectory;
 	const auto fileFormat = detectFileFormat(params.filePath, useConfig && config.fileFormat.isRaw());
 	FileInformation fileinfo;
 	FileDetector *fileDetector = nullptr;
@@ -492,7 +503,7 @@ int main(int argc, char* argv[])
 					fileinfo.setStatus(ReturnCode::UNKNOWN_FORMAT);
 				}
 			}
-			PatternDetector patternDetector(fileDetector ? fileDetector->getFileParser() : nullptr, fileinfo);
+			PatternDetector patternDetector(fileDetector ? fileDetector->getFileParser() : nullptr, fileinfo, params.yaraCacheDirectory);
 			patternDetector.addFilePaths("malware", params.yaraMalwarePaths);
 			patternDetector.addFilePaths("crypto", params.yaraCryptoPaths);
 			patternDetector.addFilePaths("other", params.yaraOtherPaths);
@@ -501,17 +512,25 @@ int main(int argc, char* argv[])
 	}
 
 	// print results on standard output
+	auto res = fileinfo.getStatus();
 	if(params.plainText)
 	{
 		PlainPresentation(fileinfo, params.verbose, params.explanatory).present();
 	}
 	else
 	{
-		JsonPresentation(fileinfo, params.verbose).present();
+		// JSON is written to the output while it is serialized, so the error
+		// handler must not start another document in the middle of it.
+		llvm::remove_fatal_error_handler();
+		if(!JsonPresentation(fileinfo, params.verbose).present())
+		{
+			std::cerr << "Error: writing of JSON output failed\n";
+			res = ReturnCode::FILE_PROBLEM;
+		}
+		llvm::install_fatal_error_handler(fatalErrorHandler, &hInfo);
 	}
 
 	// generate configuration file
-	auto res = fileinfo.getStatus();
 	if(params.generateConfigFile)
 	{
 		auto config = ConfigPresentation(fileinfo, params.configFile);
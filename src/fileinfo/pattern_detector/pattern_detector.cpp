@@ -21,9 +21,11 @@ namespace fileinfo {
  * Constructor
  * @param fparser Pointer to file parser
  * @param finfo Reference to information about input file
+ * @param cacheDir Directory with cached compiled rules (may be empty)
  */
-PatternDetector::PatternDetector(const retdec::fileformat::FileFormat *fparser, FileInformation &finfo) :
-	fileParser(fparser), fileinfo(finfo)
+PatternDetector::PatternDetector(const retdec::fileformat::FileFormat *fparser, FileInformation &finfo,
+	const std::string &cacheDir) :
+	fileParser(fparser), fileinfo(finfo), cacheDirectory(cacheDir)
 {
 
 }
@@ -335,14 +337,26 @@ void PatternDetector::analyze()
 {
 	for(const auto &category : categories)
 	{
-		YaraDetector yara;
-
+		std::vector<std::pair<std::string, std::string>> ruleFiles;
 		for(const auto &item : category.second)
 		{
-			yara.addRuleFile(item);
+			ruleFiles.emplace_back(item, std::string());
 		}
 
-		yara.analyze(fileinfo.getPathToFile());
+		YaraDetector yara;
+		yara.addRuleFiles(ruleFiles, cacheDirectory);
+
+		// Scan the content already loaded by the parser instead of reading
+		// the input file again.
+		if(fileParser)
+		{
+			const auto bytes = fileParser->getBytes();
+			yara.analyze(bytes.data(), bytes.size());
+		}
+		else
+		{
+			yara.analyze(fileinfo.getPathToFile());
+		}
 
 		for(const auto &rule : yara.getDetectedRules())
 		{
@@ -29,6 +29,7 @@ class PatternDetector
 		const retdec::fileformat::FileFormat *fileParser;                             ///< parser of input file
 		FileInformation &fileinfo;                                             ///< information about input file
 		std::vector<std::pair<std::string, std::set<std::string>>> categories; ///< paths to YARA rules
+		std::string cacheDirectory;                                            ///< directory with cached compiled rules
 
 		/// @name Iterators
 		/// @{
@@ -44,7 +45,8 @@ class PatternDetector
 		void saveOtherRule(const yaracpp::YaraRule &rule);
 		/// @}
 	public:
-		PatternDetector(const retdec::fileformat::FileFormat *fparser, FileInformation &finfo);
+		PatternDetector(const retdec::fileformat::FileFormat *fparser, FileInformation &finfo,
+			const std::string &cacheDir = std::string());
 
 		/// @name Detection methods
 		/// @{
@@ -640,6 +640,16 @@ void ValueAnalysis::initAliasAnalysis(ShPtr<Module> module) {
 	aliasAnalysis->init(module);
 }
 
+/**
+* @brief Returns the underlying alias analysis.
+*
+* It can be used to create another analysis of values sharing the same alias
+* analysis (e.g. one for every thread when values are analyzed in parallel).
+*/
+ShPtr<AliasAnalysis> ValueAnalysis::getAliasAnalysis() const {
+	return aliasAnalysis;
+}
+
 /**
 * @brief Returns the set of variables to which @a var may point to.
 *
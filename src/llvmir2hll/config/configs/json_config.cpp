@@ -142,6 +142,19 @@ UPtr<JSONConfig> JSONConfig::fromString(const std::string &str) {
 	return config;
 }
 
+/**
+* @brief Returns a config wrapping a copy of the given decompiler config.
+*
+* Unlike fromString(), the config is not serialized to JSON and parsed back,
+* so this is the cheap way of passing a config that is already in memory.
+*/
+UPtr<JSONConfig> JSONConfig::fromConfig(const retdec::config::Config &config) {
+	// We cannot use std::make_unique() because JSONConfig() is private.
+	auto result = UPtr<JSONConfig>(new JSONConfig());
+	result->impl->config = config;
+	return result;
+}
+
 /**
 * @brief Returns an empty config.
 */
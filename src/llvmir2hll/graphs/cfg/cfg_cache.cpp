@@ -0,0 +1,81 @@
+/**
+* @file src/llvmir2hll/graphs/cfg/cfg_cache.cpp
+* @brief Implementation of CFGCache.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/graphs/cfg/cfg.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/support/debug.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Constructs a new cache.
+*
+* See create() for more details.
+*/
+CFGCache::CFGCache(ShPtr<CFGBuilder> cfgBuilder):
+	cfgBuilder(cfgBuilder), cfgs() {}
+
+/**
+* @brief Creates a new empty cache.
+*
+* @param[in] cfgBuilder Builder of CFGs that are not in the cache.
+*
+* @par Preconditions
+*  - @a cfgBuilder is non-null
+*/
+ShPtr<CFGCache> CFGCache::create(ShPtr<CFGBuilder> cfgBuilder) {
+	PRECONDITION_NON_NULL(cfgBuilder);
+
+	return ShPtr<CFGCache>(new CFGCache(cfgBuilder));
+}
+
+/**
+* @brief Returns a CFG of @a func.
+*
+* If there is no cached CFG of @a func, a new one is built and cached.
+*
+* @par Preconditions
+*  - @a func is non-null
+*/
+ShPtr<CFG> CFGCache::getCFG(ShPtr<Function> func) {
+	PRECONDITION_NON_NULL(func);
+
+	auto &cfg = cfgs[func];
+	if (!cfg) {
+		cfg = cfgBuilder->getCFG(func);
+	}
+	return cfg;
+}
+
+/**
+* @brief Returns @c true if there is a cached CFG of @a func, @c false
+*        otherwise.
+*/
+bool CFGCache::hasCFG(ShPtr<Function> func) const {
+	return cfgs.find(func) != cfgs.end();
+}
+
+/**
+* @brief Removes the cached CFG of @a func (if any).
+*
+* CFGs that have already been returned by getCFG() stay untouched.
+*/
+void CFGCache::invalidate(ShPtr<Function> func) {
+	cfgs.erase(func);
+}
+
+/**
+* @brief Removes all the cached CFGs.
+*/
+void CFGCache::invalidateAll() {
+	cfgs.clear();
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
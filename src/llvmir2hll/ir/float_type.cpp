@@ -69,6 +69,10 @@ bool FloatType::existsFloatType() const {
 ShPtr<FloatType> FloatType::create(unsigned size) {
 	PRECONDITION(size > 0, "invalid size " << size);
 
+	// Types may be created from several threads at once (e.g. by optimizers
+	// that run in parallel).
+	std::lock_guard<std::mutex> lock(createdTypesMutex);
+
 	// To reduce the amount of created types, we use a set of already created
 	// float types of the given size. If the wanted type has already been
 	// created, reuse it.
@@ -89,6 +93,7 @@ void FloatType::accept(Visitor *v) {
 
 // Static variables and constants definitions.
 std::map<unsigned, ShPtr<FloatType>> FloatType::createdTypes;
+std::mutex FloatType::createdTypesMutex;
 
 } // namespace llvmir2hll
 } // namespace retdec
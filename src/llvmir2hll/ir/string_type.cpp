@@ -49,6 +49,10 @@ std::size_t StringType::getCharSize() const {
 ShPtr<StringType> StringType::create(std::size_t charSize) {
 	PRECONDITION(charSize > 0, "invalid charSize " << charSize);
 
+	// Types may be created from several threads at once (e.g. by optimizers
+	// that run in parallel).
+	std::lock_guard<std::mutex> lock(createdTypesMutex);
+
 	auto it = createdTypes.find(charSize);
 	if (it != createdTypes.end()) {
 		return it->second;
@@ -64,6 +68,7 @@ void StringType::accept(Visitor *v) {
 
 // Static variables and constants definitions.
 std::map<std::size_t, ShPtr<StringType>> StringType::createdTypes;
+std::mutex StringType::createdTypesMutex;
 
 } // namespace llvmir2hll
 } // namespace retdec
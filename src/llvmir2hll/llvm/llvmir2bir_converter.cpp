@@ -33,7 +33,7 @@ namespace llvmir2hll {
 */
 LLVMIR2BIRConverter::LLVMIR2BIRConverter(llvm::Pass *basePass):
 	basePass(basePass), optionStrictFPUSemantics(false),
-	enableDebug(false), converter(),
+	optionMaxStructuringWork(0), enableDebug(false), converter(),
 	llvmModule(nullptr), resModule(), structConverter(), variablesManager() {}
 
 /**
@@ -58,6 +58,17 @@ void LLVMIR2BIRConverter::setOptionStrictFPUSemantics(bool strict) {
 	optionStrictFPUSemantics = strict;
 }
 
+/**
+* @brief Sets the maximal work spent on structuring of a single function.
+*
+* @param[in] maxWork Maximal number of visited CFG nodes. Functions exceeding
+*                    it are structured by goto statements. If @c 0, there is
+*                    no limit.
+*/
+void LLVMIR2BIRConverter::setOptionMaxStructuringWork(unsigned long long maxWork) {
+	optionMaxStructuringWork = maxWork;
+}
+
 /**
 * @brief Converts the given LLVM module into a module in BIR.
 *
@@ -85,6 +96,7 @@ ShPtr<Module> LLVMIR2BIRConverter::convert(llvm::Module *llvmModule,
 	structConverter = std::make_unique<StructureConverter>(basePass, converter, resModule);
 
 	converter->setOptionStrictFPUSemantics(optionStrictFPUSemantics);
+	structConverter->setOptionMaxWork(optionMaxStructuringWork);
 
 	convertAndAddFuncsDeclarations();
 	convertAndAddGlobalVariables();
@@ -13,6 +13,7 @@
 #include <llvm/IR/Instructions.h>
 #include <llvm/Pass.h>
 
+#include "retdec/llvm-support/diagnostics.h"
 #include "retdec/llvmir2hll/ir/assign_stmt.h"
 #include "retdec/llvmir2hll/ir/break_stmt.h"
 #include "retdec/llvmir2hll/ir/const_bool.h"
@@ -39,6 +40,7 @@
 
 using namespace std::placeholders;
 
+using retdec::llvm_support::printWarningMessage;
 using retdec::utils::hasItem;
 using retdec::utils::removeItem;
 
@@ -61,6 +63,216 @@ const unsigned MIN_GOTO_STATEMENTS = 3;
 
 } // anonymous namespace
 
+/**
+* @brief Reachability between nodes of a part of a control-flow graph.
+*
+* The index contains nodes reachable from the given roots. Paths are the same
+* as in BFS traversals of StructureConverter (successors and statement
+* successors, back edges are skipped). Nodes reachable from a node and nodes
+* from which a node is reachable are computed by a single traversal of the
+* index and cached, so many queries with the same source or target do not
+* traverse the graph again.
+*/
+class StructureConverter::ReachabilityIndex {
+public:
+	explicit ReachabilityIndex(unsigned long long &work): work(work) {}
+
+	void addRoot(const ShPtr<CFGNode> &root);
+	std::size_t getNodesNum() const;
+	const ShPtr<CFGNode> &getNode(std::size_t i) const;
+	bool existsPathFromSource(const ShPtr<CFGNode> &source,
+		const ShPtr<CFGNode> &node);
+	bool existsPathToTarget(const ShPtr<CFGNode> &node,
+		const ShPtr<CFGNode> &target);
+
+private:
+	using Edges = std::vector<std::vector<std::size_t>>;
+	using Reachability = std::unordered_map<std::size_t, std::vector<bool>>;
+
+	std::size_t addNode(const ShPtr<CFGNode> &node);
+	void addEdge(std::size_t from, const ShPtr<CFGNode> &to);
+	std::size_t getIndex(const ShPtr<CFGNode> &node) const;
+	const std::vector<bool> &getReachable(std::size_t i,
+		const Edges &edges, Reachability &cache);
+
+	/// Indexed nodes in the order of their discovery.
+	CFGNodeVector nodes;
+
+	/// Indexes of the nodes.
+	std::unordered_map<ShPtr<CFGNode>, std::size_t> indexes;
+
+	/// Successors of the nodes.
+	Edges succs;
+
+	/// Predecessors of the nodes.
+	Edges preds;
+
+	/// Nodes reachable from a node (source).
+	Reachability fromSource;
+
+	/// Nodes from which a node (target) is reachable.
+	Reachability toTarget;
+
+	/// Work counter of the structure converter.
+	unsigned long long &work;
+};
+
+/**
+* @brief Adds all nodes reachable from the given node @a root into the index.
+*
+* Nodes are indexed in the BFS order, so the nodes reachable from the first
+* root are in the same order as in StructureConverter::BFSTraverse().
+*
+* @par Preconditions
+*  - @a root is non-null
+*  - no reachability query has been done yet
+*/
+void StructureConverter::ReachabilityIndex::addRoot(const ShPtr<CFGNode> &root) {
+	PRECONDITION_NON_NULL(root);
+	PRECONDITION(fromSource.empty() && toTarget.empty(),
+		"nodes cannot be added after the first query");
+
+	if (hasItem(indexes, root)) {
+		return;
+	}
+
+	for (auto i = addNode(root); i < nodes.size(); ++i) {
+		++work;
+
+		auto node = nodes[i];
+		for (const auto &nextNode: node->getSuccessors()) {
+			if (!node->isBackEdge(nextNode)) {
+				addEdge(i, nextNode);
+			}
+		}
+
+		if (node->hasStatementSuccessor()) {
+			auto statementSucc = node->getStatementSuccessor();
+			if (!node->isBackEdge(statementSucc)) {
+				addEdge(i, statementSucc);
+			}
+		}
+	}
+}
+
+/**
+* @brief Returns the number of indexed nodes.
+*/
+std::size_t StructureConverter::ReachabilityIndex::getNodesNum() const {
+	return nodes.size();
+}
+
+/**
+* @brief Returns the indexed node with the given index @a i.
+*
+* @par Preconditions
+*  - @a i is less than getNodesNum()
+*/
+const ShPtr<CFGNode> &StructureConverter::ReachabilityIndex::getNode(
+		std::size_t i) const {
+	PRECONDITION(i < nodes.size(), "index is out of range");
+
+	return nodes[i];
+}
+
+/**
+* @brief Determines whether exists direct path (without loops) from the given
+*        node @a source to the given node @a node.
+*
+* Use this method when there are many queries with the same @a source.
+*
+* @par Preconditions
+*  - both @a source and @a node are indexed
+*/
+bool StructureConverter::ReachabilityIndex::existsPathFromSource(
+		const ShPtr<CFGNode> &source, const ShPtr<CFGNode> &node) {
+	return getReachable(getIndex(source), succs, fromSource)[getIndex(node)];
+}
+
+/**
+* @brief Determines whether exists direct path (without loops) from the given
+*        node @a node to the given node @a target.
+*
+* Use this method when there are many queries with the same @a target.
+*
+* @par Preconditions
+*  - both @a node and @a target are indexed
+*/
+bool StructureConverter::ReachabilityIndex::existsPathToTarget(
+		const ShPtr<CFGNode> &node, const ShPtr<CFGNode> &target) {
+	return getReachable(getIndex(target), preds, toTarget)[getIndex(node)];
+}
+
+/**
+* @brief Adds the given node @a node into the index and returns its index.
+*/
+std::size_t StructureConverter::ReachabilityIndex::addNode(
+		const ShPtr<CFGNode> &node) {
+	auto i = nodes.size();
+	nodes.push_back(node);
+	indexes.emplace(node, i);
+	succs.emplace_back();
+	preds.emplace_back();
+	return i;
+}
+
+/**
+* @brief Adds an edge from the node with index @a from to the given node @a to,
+*        which is indexed if it has not been indexed yet.
+*/
+void StructureConverter::ReachabilityIndex::addEdge(std::size_t from,
+		const ShPtr<CFGNode> &to) {
+	auto toIt = indexes.find(to);
+	auto toIndex = toIt != indexes.end() ? toIt->second : addNode(to);
+	succs[from].push_back(toIndex);
+	preds[toIndex].push_back(from);
+}
+
+/**
+* @brief Returns the index of the given node @a node.
+*
+* @par Preconditions
+*  - @a node is indexed
+*/
+std::size_t StructureConverter::ReachabilityIndex::getIndex(
+		const ShPtr<CFGNode> &node) const {
+	auto it = indexes.find(node);
+	PRECONDITION(it != indexes.end(), "node is not indexed");
+
+	return it->second;
+}
+
+/**
+* @brief Returns nodes reachable from the node with index @a i by the given
+*        edges @a edges. The result is cached in @a cache.
+*/
+const std::vector<bool> &StructureConverter::ReachabilityIndex::getReachable(
+		std::size_t i, const Edges &edges, Reachability &cache) {
+	auto cacheIt = cache.find(i);
+	if (cacheIt != cache.end()) {
+		return cacheIt->second;
+	}
+
+	auto &reachable = cache[i];
+	reachable.resize(nodes.size(), false);
+	reachable[i] = true;
+	std::vector<std::size_t> toBeVisited{i};
+	while (!toBeVisited.empty()) {
+		++work;
+
+		auto node = toBeVisited.back();
+		toBeVisited.pop_back();
+		for (auto next: edges[node]) {
+			if (!reachable[next]) {
+				reachable[next] = true;
+				toBeVisited.push_back(next);
+			}
+		}
+	}
+
+	return reachable;
+}
+
 /**
 * @brief Constructs a new structure converter.
 *
@@ -75,7 +287,20 @@ StructureConverter::StructureConverter(llvm::Pass *basePass,
 		labelsHandler(std::make_shared<LabelsHandler>()),
 		bbConverter(conv, labelsHandler),
 		converter(conv), loopHeaders(), generatedPHINodes(),
-		reducedLoops(), reducedSwitches(), resModule(module) {}
+		reducedLoops(), reducedSwitches(), resModule(module),
+		optionMaxWork(0), work(0) {}
+
+/**
+* @brief Sets the maximal work spent on structuring of a single function.
+*
+* Work is measured by the number of CFG nodes visited during structuring. When
+* it exceeds @a maxWork, the rest of the function is structured by @c goto
+* statements, so a single pathological function cannot stall the whole
+* decompilation. If @a maxWork is @c 0, there is no limit.
+*/
+void StructureConverter::setOptionMaxWork(unsigned long long maxWork) {
+	optionMaxWork = maxWork;
+}
 
 /**
 * @brief Converts body of the given LLVM function @a func into a sequence
@@ -95,6 +320,12 @@ ShPtr<Statement> StructureConverter::convertFuncBody(llvm::Function &func) {
 		// Keep looping until the CFG is reduced.
 	}
 
+	if (isWorkLimitExceeded()) {
+		printWarningMessage("[StructureConverter] Structuring of function ",
+			func.getName().str(), " exceeded the work limit,"
+			" the rest of it is structured by goto statements.");
+	}
+
 	if (cfg->getSuccNum() != 0) {
 		structureByGotos(cfg);
 	}
@@ -417,6 +648,11 @@ bool StructureConverter::reduceCFG(ShPtr<CFGNode> cfg) {
 bool StructureConverter::inspectCFGNode(ShPtr<CFGNode> node) {
 	PRECONDITION_NON_NULL(node);
 
+	if (isWorkLimitExceeded()) {
+		// Remaining nodes are structured by goto statements.
+		return false;
+	}
+
 	if (isLoopHeader(node) && !hasItem(statementsOnStack, node) &&
 			(statementsStack.empty() || statementsStack.top() != node)) {
 		loopHeaders.emplace(getLoopFor(node), node);
@@ -575,6 +811,8 @@ bool StructureConverter::BFSTraverse(ShPtr<CFGNode> cfg,
 	CFGNodeQueue toBeVisited({cfg});
 	CFGNode::CFGNodeSet visited{cfg};
 	while (!toBeVisited.empty()) {
+		++work;
+
 		auto node = popFromQueue(toBeVisited);
 		if (inspectFunc(node)) {
 			anyTrueResult = true;
@@ -604,6 +842,8 @@ bool StructureConverter::BFSTraverseLoop(ShPtr<CFGNode> cfg,
 	CFGNodeQueue toBeVisited({cfg});
 	CFGNode::CFGNodeSet visited{cfg};
 	while (!toBeVisited.empty()) {
+		++work;
+
 		auto node = popFromQueue(toBeVisited);
 		if (inspectFunc(node)) {
 			anyTrueResult = true;
@@ -629,6 +869,8 @@ ShPtr<CFGNode> StructureConverter::BFSFindFirst(ShPtr<CFGNode> cfg,
 	CFGNodeQueue toBeVisited({cfg});
 	CFGNode::CFGNodeSet visited{cfg};
 	while (!toBeVisited.empty()) {
+		++work;
+
 		auto node = popFromQueue(toBeVisited);
 		if (pred(node)) {
 			return node;
@@ -641,22 +883,11 @@ ShPtr<CFGNode> StructureConverter::BFSFindFirst(ShPtr<CFGNode> cfg,
 }
 
 /**
-* @brief Determines whether exists direct path (without loops) between two given
-*        nodes @a node1 and @a node2.
-*
-* @par Preconditions
-*  - both @a node1 and @a node2 are non-null
+* @brief Determines whether the work spent on structuring of the current
+*        function exceeded the limit set by setOptionMaxWork().
 */
-bool StructureConverter::existsPathWithoutLoopsBetween(const ShPtr<CFGNode> &node1,
-		const ShPtr<CFGNode> &node2) const {
-	PRECONDITION_NON_NULL(node1);
-	PRECONDITION_NON_NULL(node2);
-
-	auto predicate = [&node2](const auto &node) {
-		return node == node2;
-	};
-
-	return BFSFindFirst(node1, predicate) != nullptr;
+bool StructureConverter::isWorkLimitExceeded() const {
+	return optionMaxWork != 0 && work > optionMaxWork;
 }
 
 /**
@@ -1658,20 +1889,37 @@ ShPtr<CFGNode> StructureConverter::getSwitchSuccessor(
 		const ShPtr<CFGNode> &switchNode) const {
 	PRECONDITION_NON_NULL(switchNode);
 
-	return BFSFindFirst(switchNode, [this, &switchNode](const auto &node) {
-		return this->isNodeAfterAllSwitchClauses(node, switchNode);
-	});
+	// Candidates are all nodes reachable from the switch (in the BFS order).
+	// Clauses reachable only by back edges are indexed after them.
+	ReachabilityIndex index(work);
+	index.addRoot(switchNode);
+	auto candidatesNum = index.getNodesNum();
+	for (const auto &switchClause: switchNode->getSuccessors()) {
+		index.addRoot(switchClause);
+	}
+
+	for (std::size_t i = 0; i < candidatesNum; ++i) {
+		auto node = index.getNode(i);
+		if (isNodeAfterAllSwitchClauses(node, switchNode, index)) {
+			return node;
+		}
+	}
+
+	return nullptr;
 }
 
 /**
 * @brief Determines whether the given node @a node is after all clauses of the
 *        given switch @a switchNode.
 *
+* Paths between nodes are looked up in @a index, which has to contain both
+* the node and the switch clauses.
+*
 * @par Preconditions
 *  - both @a node and @a switchNode are non-null
 */
 bool StructureConverter::isNodeAfterAllSwitchClauses(const ShPtr<CFGNode> &node,
-		const ShPtr<CFGNode> &switchNode) const {
+		const ShPtr<CFGNode> &switchNode, ReachabilityIndex &index) const {
 	PRECONDITION_NON_NULL(node);
 	PRECONDITION_NON_NULL(switchNode);
 
@@ -1680,7 +1928,7 @@ bool StructureConverter::isNodeAfterAllSwitchClauses(const ShPtr<CFGNode> &node,
 	}
 
 	for (auto switchClause: switchNode->getSuccessors()) {
-		if (!isNodeAfterSwitchClause(node, switchClause)) {
+		if (!isNodeAfterSwitchClause(node, switchClause, index)) {
 			return false;
 		}
 	}
@@ -1692,23 +1940,26 @@ bool StructureConverter::isNodeAfterAllSwitchClauses(const ShPtr<CFGNode> &node,
 * @brief Determines whether the given node @a node is after the given switch
 *        clause @a clauseNode.
 *
+* Paths between nodes are looked up in @a index, which has to contain both
+* the node and the switch clauses.
+*
 * @par Preconditions
 *  - both @a node and @a clauseNode are non-null
 */
 bool StructureConverter::isNodeAfterSwitchClause(const ShPtr<CFGNode> &node,
-		const ShPtr<CFGNode> &clauseNode) const {
+		const ShPtr<CFGNode> &clauseNode, ReachabilityIndex &index) const {
 	PRECONDITION_NON_NULL(node);
 	PRECONDITION_NON_NULL(clauseNode);
 
 	if (node == clauseNode) {
 		return true;
-	} else if (existsPathWithoutLoopsBetween(node, clauseNode)) {
+	} else if (index.existsPathToTarget(node, clauseNode)) {
 		return false;
 	} else if (clauseNode->getSuccNum() == 0) {
 		return true;
 	}
 
-	return existsPathWithoutLoopsBetween(clauseNode, node);
+	return index.existsPathFromSource(clauseNode, node);
 }
 
 /**
@@ -2443,6 +2694,7 @@ void StructureConverter::cleanUp() {
 	gotoTargetsToCfgNodes.clear();
 	targetReferences.clear();
 	stmtClones.clear();
+	work = 0;
 }
 
 } // namespace llvmir2hll
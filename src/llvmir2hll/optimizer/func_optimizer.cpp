@@ -21,19 +21,41 @@ namespace llvmir2hll {
 *  - @a module is non-null
 */
 FuncOptimizer::FuncOptimizer(ShPtr<Module> module):
-	Optimizer(module), currFunc() {
+	Optimizer(module), currFunc(), optimizeOnlySelectedFuncs(false),
+	funcsToOptimize() {
 		PRECONDITION_NON_NULL(module);
 	}
 
+/**
+* @brief Restricts the optimization to the given functions.
+*
+* By default, all functions in the module are optimized.
+*
+* @par Preconditions
+*  - all functions in @a funcs belong to the optimized module
+*/
+void FuncOptimizer::setFuncsToOptimize(const FuncVector &funcs) {
+	optimizeOnlySelectedFuncs = true;
+	funcsToOptimize = funcs;
+}
+
 /**
 * @brief Performs the optimization on all functions in the module.
 *
-* This function calls runOnFunction() for each function in the module.
+* This function calls runOnFunction() for each function in the module (or for
+* each function set by setFuncsToOptimize()).
 *
 * Only redefine if you want to prescribe the order in which functions are
 * optimized; otherwise, just override runOnFunction().
 */
 void FuncOptimizer::doOptimization() {
+	if (optimizeOnlySelectedFuncs) {
+		for (const auto &func : funcsToOptimize) {
+			runOnFunction(func);
+		}
+		return;
+	}
+
 	// For each function in the module...
 	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
 		runOnFunction(*i);
@@ -4,10 +4,20 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <type_traits>
+
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
 #include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/hll/hll_writer.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/obtainer/call_info_obtainer.h"
+#include "retdec/llvmir2hll/optimizer/func_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizer_manager.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/aggressive_deref_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/aggressive_global_to_local_optimizer.h"
@@ -44,6 +54,7 @@
 #include "retdec/llvmir2hll/optimizer/optimizers/while_true_to_ufor_loop_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/while_true_to_while_cond_optimizer.h"
 #include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/subject.h"
 #include "retdec/utils/container.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/system.h"
@@ -65,6 +76,11 @@ const std::string OPT_SUFFIX = "Optimizer";
 /// Prefix of aggressive optimizations.
 const std::string AGGRESSIVE_OPTS_PREFIX = "Aggressive";
 
+/// Number of chunks of functions per thread when running optimizations in
+/// parallel. More chunks than threads balance the load when some functions
+/// are much larger than others.
+const std::size_t CHUNKS_PER_THREAD = 4;
+
 /**
 * @brief Trims the optional suffix "Optimizer" from all optimization names in
 *        @a opts.
@@ -100,6 +116,9 @@ StringSet trimOptimizerSuffix(const StringSet &opts) {
 * @param[in] arithmExprEvaluator Used evaluator of arithmetical expressions.
 * @param[in] enableAggressiveOpts Enables aggressive optimizations.
 * @param[in] enableDebug Enables emission of debug messages.
+* @param[in] numOfThreads Number of threads used to run function-local
+*                         optimizations. If it is @c 0, the number of threads
+*                         supported by the hardware is used.
 *
 * To perform the actual optimizations, call optimize(). To get a list of
 * available optimizations and their names, see our wiki.
@@ -123,17 +142,26 @@ OptimizerManager::OptimizerManager(const StringSet &enabledOpts,
 	const StringSet &disabledOpts, ShPtr<HLLWriter> hllWriter,
 	ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio,
 	ShPtr<ArithmExprEvaluator> arithmExprEvaluator,
-	bool enableAggressiveOpts, bool enableDebug):
+	bool enableAggressiveOpts, bool enableDebug, std::size_t numOfThreads):
 		enabledOpts(trimOptimizerSuffix(enabledOpts)),
 		disabledOpts(trimOptimizerSuffix(disabledOpts)),
 		hllWriter(hllWriter), va(va), cio(cio),
 		arithmExprEvaluator(arithmExprEvaluator),
+		cfgCache(CFGCache::create(NonRecursiveCFGBuilder::create())),
 		enableAggressiveOpts(enableAggressiveOpts), enableDebug(enableDebug),
-		recoverFromOutOfMemory(true), backendRunOpts() {
+		recoverFromOutOfMemory(true), backendRunOpts(), threadPool() {
 			PRECONDITION_NON_NULL(hllWriter);
 			PRECONDITION_NON_NULL(va);
 			PRECONDITION_NON_NULL(cio);
 			PRECONDITION_NON_NULL(arithmExprEvaluator);
+
+			if (numOfThreads == 0) {
+				numOfThreads = retdec::utils::ThreadPool::getDefaultNumOfThreads();
+			}
+			if (numOfThreads > 1) {
+				threadPool = std::make_unique<retdec::utils::ThreadPool>(
+					numOfThreads);
+			}
 		}
 
 /**
@@ -146,13 +174,18 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	//
 	// Of course, if some optimization depend on another one, the order is
 	// clear.
+	//
+	// Optimizations run by runPerFunc() may be run in parallel over disjoint
+	// sets of functions, so they have to be function-local and must not use
+	// any shared state except for the module structure itself. Optimizations
+	// run by run() are always run over the whole module.
 
 	//
 	// Perform initial, HLL-dependent optimizations.
 	//
 	if (hllWriter->getId() == "py") {
 		// Optimizations for Python'.
-		run<RemoveAllCastsOptimizer>(m);
+		runPerFunc<RemoveAllCastsOptimizer>(m);
 	}
 
 	//
@@ -161,16 +194,16 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	if (!enableDebug) {
 		// Since we will not emit debug comments, empty statements are useless,
 		// so we can remove them.
-		run<EmptyStmtOptimizer>(m);
+		runPerFunc<EmptyStmtOptimizer>(m);
 	}
 
-	run<GotoStmtOptimizer>(m);
-	run<RemoveUselessCastsOptimizer>(m);
+	runPerFunc<GotoStmtOptimizer>(m);
+	runPerFunc<RemoveUselessCastsOptimizer>(m);
 
 	// The first part of removal of non-compound statements. The other part
 	// should be run after structure optimizations because they may introduce
 	// constructs that can be optimized.
-	run<AggressiveDerefOptimizer>(m);
+	runPerFunc<AggressiveDerefOptimizer>(m);
 	run<AggressiveGlobalToLocalOptimizer>(m);
 
 	// Data-flow optimizations.
@@ -178,8 +211,8 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// speed it up.
 	run<UnusedGlobalVarOptimizer>(m);
 	run<DeadLocalAssignOptimizer>(m, va);
-	run<SimpleCopyPropagationOptimizer>(m, va, cio);
-	run<CopyPropagationOptimizer>(m, va, cio);
+	run<SimpleCopyPropagationOptimizer>(m, va, cio, cfgCache);
+	run<CopyPropagationOptimizer>(m, va, cio, cfgCache);
 
 	// SimplifyArithmExprOptimizer should be run before loop optimizations.
 	run<SimplifyArithmExprOptimizer>(m, arithmExprEvaluator);
@@ -187,11 +220,11 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// Structure optimizations.
 	// IfStructureOptimizer should be run before loop optimizations because
 	// it may make induction variables easier to find.
-	run<IfStructureOptimizer>(m);
+	runPerFunc<IfStructureOptimizer>(m);
 	// LoopLastContinueOptimizer should be run after IfStructureOptimizer
 	// because IfBeforeLoopOptimizer may introduce continue statements to the
 	// end of loops.
-	run<LoopLastContinueOptimizer>(m);
+	runPerFunc<LoopLastContinueOptimizer>(m);
 	// PreWhileTrueLoopConvOptimizer should be run before other `while True`
 	// loop optimizers.
 	run<PreWhileTrueLoopConvOptimizer>(m, va);
@@ -209,19 +242,19 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 		run<WhileTrueToUForLoopOptimizer>(m, va);
 	}
 	#endif
-	run<WhileTrueToWhileCondOptimizer>(m);
-	run<IfBeforeLoopOptimizer>(m, va);
+	runPerFunc<WhileTrueToWhileCondOptimizer>(m);
+	runPerFunc<IfBeforeLoopOptimizer>(m, va);
 
 	// The second part of removal of non-compound statements.
 	run<LLVMIntrinsicsOptimizer>(m);
-	run<VoidReturnOptimizer>(m);
-	run<BreakContinueReturnOptimizer>(m);
+	runPerFunc<VoidReturnOptimizer>(m);
+	runPerFunc<BreakContinueReturnOptimizer>(m);
 
 	// Expression optimizations.
 	run<BitShiftOptimizer>(m);
-	run<DerefAddressOptimizer>(m);
+	runPerFunc<DerefAddressOptimizer>(m);
 	run<EmptyArrayToStringOptimizer>(m);
-	run<BitOpToLogOpOptimizer>(m, va);
+	runPerFunc<BitOpToLogOpOptimizer>(m, va);
 	run<SimplifyArithmExprOptimizer>(m, arithmExprEvaluator);
 
 	// Data-flow optimizations.
@@ -231,14 +264,14 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	if (shouldSecondCopyPropagationBeRun()) {
 		run<UnusedGlobalVarOptimizer>(m);
 		run<DeadLocalAssignOptimizer>(m, va);
-		run<SimpleCopyPropagationOptimizer>(m, va, cio);
-		run<CopyPropagationOptimizer>(m, va, cio);
+		run<SimpleCopyPropagationOptimizer>(m, va, cio, cfgCache);
+		run<CopyPropagationOptimizer>(m, va, cio, cfgCache);
 	}
 
 	// This is best to be run after DeadLocalAssignOptimizer and
 	// CopyPropagationOptimizer because it can get rid of statements like `v =
 	// v`, where v is a variable.
-	run<SelfAssignOptimizer>(m);
+	runPerFunc<SelfAssignOptimizer>(m);
 
 	// VarDefForLoopOptimizer and VarDefStmtOptimizer are utilized also if the
 	// output is Python because in this way, we may emit addresses of
@@ -246,11 +279,11 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// Indeed, recall that in Python, we do not emit definitions without an
 	// initializer, so if we didn't move the definitions to the usages, there
 	// wouldn't be initializers.
-	run<VarDefForLoopOptimizer>(m);
-	run<VarDefStmtOptimizer>(m, va);
+	runPerFunc<VarDefForLoopOptimizer>(m);
+	runPerFunc<VarDefStmtOptimizer>(m, va);
 
-	run<EmptyStmtOptimizer>(m);
-	run<GotoStmtOptimizer>(m);
+	runPerFunc<EmptyStmtOptimizer>(m);
+	runPerFunc<GotoStmtOptimizer>(m);
 
 	// SimplifyArithmExprOptimizer should be run at the end to produce the most
 	// readable output.
@@ -262,18 +295,18 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// DerefToArrayIndexOptimizer and IfToSwitchOptimizer.
 	run<DeadCodeOptimizer>(m, arithmExprEvaluator);
 	run<DerefToArrayIndexOptimizer>(m);
-	run<IfToSwitchOptimizer>(m, va);
+	runPerFunc<IfToSwitchOptimizer>(m, va);
 
 	//
 	// Perform final, HLL-dependent optimizations.
 	//
 	if (hllWriter->getId() == "c") {
 		// Optimizations for C.
-		run<CCastOptimizer>(m);
-		run<CArrayArgOptimizer>(m);
+		runPerFunc<CCastOptimizer>(m);
+		runPerFunc<CArrayArgOptimizer>(m);
 	} else if (hllWriter->getId() == "py") {
 		// Optimizations for Python'.
-		run<NoInitVarDefOptimizer>(m);
+		runPerFunc<NoInitVarDefOptimizer>(m);
 	}
 }
 
@@ -321,6 +354,9 @@ void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimi
 		try {
 			optimizer->optimize();
 		} catch (const std::bad_alloc &) {
+			// The optimizer may have been interrupted in the middle of
+			// changing the code.
+			cfgCache->invalidateAll();
 			printWarningMessage("out of memory; trying to recover");
 			sleep(1);
 		}
@@ -329,6 +365,73 @@ void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimi
 		optimizer->optimize();
 	}
 
+	if (!optimizer->keepsCFGCacheValid()) {
+		cfgCache->invalidateAll();
+	}
+
+	backendRunOpts.insert(OPT_ID);
+}
+
+/**
+* @brief Runs the given optimizers in parallel provided that they should be
+*        run.
+*
+* All the optimizers have to be instances of the same optimization, each of
+* them restricted to a different set of functions.
+*/
+void OptimizerManager::runOptimizersInParallelProvidedTheyShouldBeRun(
+		const std::vector<ShPtr<Optimizer>> &optimizers) {
+	if (optimizers.empty()) {
+		return;
+	}
+
+	const std::string OPT_ID = optimizers.front()->getId();
+	if (!optShouldBeRun(OPT_ID)) {
+		return;
+	}
+
+	printOptimization(OPT_ID);
+
+	// The workers modify the IR at once, so shared values have to guard their
+	// lists of observers until all of them finish.
+	ParallelIRModification parallelIRModification;
+
+	std::vector<std::future<ShPtr<Module>>> results;
+	results.reserve(optimizers.size());
+	for (const auto &optimizer : optimizers) {
+		results.push_back(threadPool->submit(
+			[optimizer]() { return optimizer->optimize(); }
+		));
+	}
+
+	// Wait for all the optimizers, even if some of them fail, because the
+	// remaining ones still work with the module.
+	bool outOfMemory = false;
+	std::exception_ptr error;
+	for (auto &result : results) {
+		try {
+			result.get();
+		} catch (const std::bad_alloc &) {
+			if (!recoverFromOutOfMemory) {
+				error = std::current_exception();
+			}
+			outOfMemory = true;
+		} catch (...) {
+			error = std::current_exception();
+		}
+	}
+	if (error) {
+		std::rethrow_exception(error);
+	}
+	// Function optimizations are run in parallel only when they do not use
+	// any shared state, including the cache of CFGs.
+	cfgCache->invalidateAll();
+	if (outOfMemory) {
+		// See runOptimizerProvidedItShouldBeRun().
+		printWarningMessage("out of memory; trying to recover");
+		sleep(1);
+	}
+
 	backendRunOpts.insert(OPT_ID);
 }
 
@@ -367,6 +470,39 @@ bool OptimizerManager::shouldSecondCopyPropagationBeRun() const {
 	return true;
 }
 
+/**
+* @brief Splits functions of @a m into chunks that are optimized in parallel.
+*
+* Every chunk contains at least one function.
+*/
+std::vector<FuncVector> OptimizerManager::splitFuncsIntoChunks(
+		ShPtr<Module> m) const {
+	FuncVector funcs(m->func_begin(), m->func_end());
+	std::size_t numOfChunks = std::min(funcs.size(),
+		threadPool->getNumOfThreads() * CHUNKS_PER_THREAD);
+
+	// Functions are distributed in a round-robin fashion so that large
+	// functions that are next to each other end up in different chunks.
+	std::vector<FuncVector> chunks(numOfChunks);
+	for (std::size_t i = 0; i < funcs.size(); ++i) {
+		chunks[i % numOfChunks].push_back(funcs[i]);
+	}
+	return chunks;
+}
+
+/**
+* @brief Returns an analysis of values for an optimizer run in a worker
+*        thread.
+*
+* The analysis caches its results, so every worker needs its own instance.
+* The alias analysis is shared because it is not modified during function
+* optimizations.
+*/
+ShPtr<ValueAnalysis> OptimizerManager::getArgForWorker(
+		const ShPtr<ValueAnalysis> &va) const {
+	return ValueAnalysis::create(va->getAliasAnalysis(), va->isCachingEnabled());
+}
+
 /**
 * @brief Runs the given optimization (specified in the template parameter) over
 *        @a m with the given arguments.
@@ -388,5 +524,48 @@ void OptimizerManager::run(ShPtr<Module> m, Args &&... args) {
 	runOptimizerProvidedItShouldBeRun(optimizer);
 }
 
+/**
+* @brief Runs the given function optimization (specified in the template
+*        parameter) over @a m with the given arguments, in parallel if
+*        possible.
+*
+* @tparam Optimization Optimization to be performed. It has to be a subclass
+*                      of FuncOptimizer that does not modify anything outside
+*                      of the optimized function.
+*
+* @param[in] m Module to be optimized.
+* @param[in] args Arguments to be passed to the optimization.
+*
+* If no thread pool is used, this function behaves like run(). Otherwise, the
+* functions in @a m are split into chunks and every chunk is optimized by a
+* separate instance of the optimization in a worker thread. Arguments that
+* cannot be shared between threads are replaced by getArgForWorker().
+*/
+template<typename Optimization, typename... Args>
+void OptimizerManager::runPerFunc(ShPtr<Module> m, Args &&... args) {
+	static_assert(std::is_base_of<FuncOptimizer, Optimization>::value,
+		"only function optimizations can be run in parallel");
+
+	if (!threadPool) {
+		run<Optimization>(m, std::forward<Args>(args)...);
+		return;
+	}
+
+	std::vector<ShPtr<Optimizer>> optimizers;
+	for (const auto &chunk : splitFuncsIntoChunks(m)) {
+		auto optimizer = std::make_shared<Optimization>(m,
+			getArgForWorker(args)...);
+		optimizer->setFuncsToOptimize(chunk);
+		optimizers.push_back(optimizer);
+	}
+	runOptimizersInParallelProvidedTheyShouldBeRun(optimizers);
+
+	// The workers have used their own analyses of values, so the shared one
+	// has not been updated to reflect the changes in the module.
+	if ((std::is_same<std::decay_t<Args>, ShPtr<ValueAnalysis>>::value || ...)) {
+		va->invalidateState();
+	}
+}
+
 } // namespace llvmir2hll
 } // namespace retdec
@@ -13,6 +13,7 @@
 #include "retdec/llvmir2hll/analysis/var_uses_visitor.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversals/no_var_def_cfg_traversal.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversals/var_def_cfg_traversal.h"
 #include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
@@ -200,13 +201,17 @@ auto ordered(const DefUseChains::DefUseChain &du) {
 * @param[in] module Module to be optimized.
 * @param[in] va Analysis of values.
 * @param[in] cio Obtainer of information about function calls.
+* @param[in] cfgCache Cache of CFGs shared with other optimizations. If it is
+*                     the null pointer, a private cache is used.
 *
 * @par Preconditions
 *  - @a module, @a va, and @a cio are non-null
 */
 CopyPropagationOptimizer::CopyPropagationOptimizer(ShPtr<Module> module,
-	ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio):
-		FuncOptimizer(module), cfgBuilder(NonRecursiveCFGBuilder::create()),
+	ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio,
+	ShPtr<CFGCache> cfgCache):
+		FuncOptimizer(module), cfgCache(cfgCache ? cfgCache :
+			CFGCache::create(NonRecursiveCFGBuilder::create())),
 		va(va), cio(cio), vuv(), dua(), uda(),
 		ducs(), udcs(), globalVars(module->getGlobalVars()),
 		toEntirelyRemoveStmts(), toRemoveStmtsPreserveCalls(), modifiedStmts(),
@@ -230,9 +235,10 @@ void CopyPropagationOptimizer::doOptimization() {
 }
 
 void CopyPropagationOptimizer::runOnFunction(ShPtr<Function> func) {
-	auto currCFG = cfgBuilder->getCFG(func);
+	auto currCFG = cfgCache->getCFG(func);
 
 	// Keep optimizing until there are no changes.
+	bool funcChanged = false;
 	do {
 		ducs = dua->getDefUseChains(
 			func,
@@ -252,7 +258,15 @@ void CopyPropagationOptimizer::runOnFunction(ShPtr<Function> func) {
 		}
 
 		performOptimization();
+		funcChanged |= codeChanged;
 	} while (codeChanged);
+
+	// The CFG has been kept up to date during the optimization, but it may
+	// differ from a freshly built one (e.g. it lacks empty statements
+	// introduced to keep debug comments), so do not let others use it.
+	if (funcChanged) {
+		cfgCache->invalidate(func);
+	}
 }
 
 /**
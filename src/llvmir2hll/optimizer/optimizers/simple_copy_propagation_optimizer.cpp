@@ -8,6 +8,7 @@
 #include "retdec/llvmir2hll/analysis/var_uses_visitor.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversals/lhs_rhs_uses_cfg_traversal.h"
 #include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/ir/assign_stmt.h"
@@ -42,13 +43,17 @@ namespace llvmir2hll {
 * @param[in] module Module to be optimized.
 * @param[in] va Analysis of values.
 * @param[in] cio Obtainer of information about function calls.
+* @param[in] cfgCache Cache of CFGs shared with other optimizations. If it is
+*                     the null pointer, a private cache is used.
 *
 * @par Preconditions
 *  - @a module, @a va, and @a cio are non-null
 */
 SimpleCopyPropagationOptimizer::SimpleCopyPropagationOptimizer(ShPtr<Module> module,
-	ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio):
-		FuncOptimizer(module), cfgBuilder(NonRecursiveCFGBuilder::create()),
+	ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio,
+	ShPtr<CFGCache> cfgCache):
+		FuncOptimizer(module), cfgCache(cfgCache ? cfgCache :
+			CFGCache::create(NonRecursiveCFGBuilder::create())),
 		va(va), cio(cio), vuv(),
 		globalVars(module->getGlobalVars()), currCFG(), triedVars() {
 			PRECONDITION_NON_NULL(module);
@@ -68,7 +73,7 @@ void SimpleCopyPropagationOptimizer::doOptimization() {
 }
 
 void SimpleCopyPropagationOptimizer::runOnFunction(ShPtr<Function> func) {
-	currCFG = cfgBuilder->getCFG(func);
+	currCFG = cfgCache->getCFG(func);
 	triedVars.clear();
 
 	FuncOptimizer::runOnFunction(func);
@@ -345,6 +350,11 @@ void SimpleCopyPropagationOptimizer::tryOptimizationCase1(
 		removeVarDefOrAssignStatement(lhsDefStmt, currFunc);
 		currCFG->removeStmt(lhsDefStmt);
 	}
+
+	// The CFG is good enough for the rest of this optimization, but it may
+	// differ from a freshly built one (e.g. it lacks empty statements
+	// introduced to keep debug comments), so do not let others use it.
+	cfgCache->invalidate(currFunc);
 }
 
 } // namespace llvmir2hll
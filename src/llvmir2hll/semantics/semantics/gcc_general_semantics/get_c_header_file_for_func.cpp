@@ -16,11 +16,11 @@ namespace gcc_general {
 namespace {
 
 /**
-* @brief This function is used to initialize FUNC_C_HEADER_MAP later in the
-*        file.
+* @brief This function is used to initialize the map returned by
+*        getFuncCHeaderMap().
 */
-const StringStringUMap &initFuncCHeaderMap() {
-	static StringStringUMap m;
+FuncCHeaderMap initFuncCHeaderMap() {
+	FuncCHeaderMap m;
 
 	//
 	// The following list was automatically generated by
@@ -1959,8 +1959,16 @@ const StringStringUMap &initFuncCHeaderMap() {
 	return m;
 }
 
-/// Mapping of function names to their corresponding header files.
-const StringStringUMap &FUNC_C_HEADER_MAP(initFuncCHeaderMap());
+/**
+* @brief Returns the mapping of function names to their corresponding header
+*        files.
+*
+* The mapping is created upon the first call.
+*/
+const FuncCHeaderMap &getFuncCHeaderMap() {
+	static const FuncCHeaderMap funcCHeaderMap(initFuncCHeaderMap());
+	return funcCHeaderMap;
+}
 
 } // anonymous namespace
 
@@ -1970,7 +1978,7 @@ const StringStringUMap &FUNC_C_HEADER_MAP(initFuncCHeaderMap());
 * See its description for more details.
 */
 std::optional<std::string> getCHeaderFileForFunc(const std::string &funcName) {
-	return getCHeaderFileForFuncFromMap(funcName, FUNC_C_HEADER_MAP);
+	return getCHeaderFileForFuncFromMap(funcName, getFuncCHeaderMap());
 }
 
 } // namespace gcc_general
@@ -953,7 +953,8 @@ DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForPathConfs)
 DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
 
 /**
-* @brief This function is used to initialize FUNC_PARAMS_MAP later in the file.
+* @brief This function is used to initialize the map returned by
+*        getFuncParamsMap().
 */
 const FuncParamsMap &initFuncParamsMap() {
 	static FuncParamsMap funcParamsMap;
@@ -2617,8 +2618,16 @@ const FuncParamsMap &initFuncParamsMap() {
 	return funcParamsMap;
 }
 
-/// Mapping of function names into symbolic names of their parameters.
-const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
+/**
+* @brief Returns the mapping of function names into symbolic names of their
+*        parameters.
+*
+* The mapping is created upon the first call.
+*/
+const FuncParamsMap &getFuncParamsMap() {
+	static const FuncParamsMap &funcParamsMap(initFuncParamsMap());
+	return funcParamsMap;
+}
 
 } // anonymous namespace
 
@@ -2629,7 +2638,7 @@ const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
 */
 std::optional<IntStringMap> getSymbolicNamesForParam(const std::string &funcName,
 		unsigned paramPos) {
-	return getSymbolicNamesForParamFromMap(funcName, paramPos, FUNC_PARAMS_MAP);
+	return getSymbolicNamesForParamFromMap(funcName, paramPos, getFuncParamsMap());
 }
 
 } // namespace gcc_general
@@ -15,7 +15,7 @@ namespace semantics {
 */
 std::optional<std::string> getCHeaderFileForFuncFromMap(
 		const std::string &funcName,
-		const StringStringUMap &map) {
+		const FuncCHeaderMap &map) {
 	auto i = map.find(funcName);
 	return i != map.end() ? std::optional<std::string>(i->second) : std::nullopt;
 }
@@ -4,20 +4,84 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+#include <tuple>
+
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
+namespace {
+
+/**
+* @brief Orders names by the function name and parameter position.
+*/
+struct FuncParamNameLess {
+	bool operator()(const FuncParamName *n1, const FuncParamName *n2) const {
+		return std::tie(n1->funcName, n1->paramPos) <
+			std::tie(n2->funcName, n2->paramPos);
+	}
+};
+
+} // anonymous namespace
+
+/**
+* @brief Constructs a database composed of the given parts.
+*/
+FuncParamNamesMap::FuncParamNamesMap(std::initializer_list<FuncParamNames> parts):
+	parts(parts) {}
+
+/**
+* @brief Returns the name of the given parameter of the given function (if
+*        any).
+*/
+std::optional<std::string> FuncParamNamesMap::find(const std::string &funcName,
+		unsigned paramPos) const {
+	std::call_once(indexBuilt, [this]() { buildIndex(); });
+
+	FuncParamName key{funcName, paramPos, {}};
+	auto it = std::upper_bound(index.begin(), index.end(), &key,
+		FuncParamNameLess());
+	if (it == index.begin()) {
+		return std::nullopt;
+	}
+
+	// upper_bound() returns the first name after the (last) searched one.
+	--it;
+	if ((*it)->funcName != key.funcName || (*it)->paramPos != paramPos) {
+		return std::nullopt;
+	}
+	return std::string((*it)->paramName);
+}
+
+/**
+* @brief Sorts pointers to all the names in the database.
+*/
+void FuncParamNamesMap::buildIndex() const {
+	std::size_t size = 0;
+	for (const auto &part : parts) {
+		size += part.size();
+	}
+
+	index.reserve(size);
+	for (const auto &part : parts) {
+		for (const auto &name : part) {
+			index.push_back(&name);
+		}
+	}
+
+	// The sort has to be stable because the last name of a parameter wins.
+	std::stable_sort(index.begin(), index.end(), FuncParamNameLess());
+}
+
 /**
 * @brief Returns the name of the given parameter from the given map.
 */
 std::optional<std::string> getNameOfParamFromMap(const std::string &funcName,
 		unsigned paramPos, const FuncParamNamesMap &map) {
-	auto funcParamIter = map.find(FuncParamPosPair(funcName, paramPos));
-	return funcParamIter != map.end() ?
-		std::optional<std::string>(funcParamIter->second) : std::nullopt;
+	return map.find(funcName, paramPos);
 }
 
 } // namespace semantics
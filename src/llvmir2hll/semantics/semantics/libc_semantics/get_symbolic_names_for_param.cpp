@@ -16,7 +16,8 @@ namespace libc {
 namespace {
 
 /**
-* @brief This function is used to initialize FUNC_PARAMS_MAP later in the file.
+* @brief This function is used to initialize the map returned by
+*        getFuncParamsMap().
 */
 const FuncParamsMap &initFuncParamsMap() {
 	static FuncParamsMap funcParamsMap;
@@ -46,8 +47,16 @@ const FuncParamsMap &initFuncParamsMap() {
 	return funcParamsMap;
 }
 
-/// Mapping of function names into symbolic names of their parameters.
-const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
+/**
+* @brief Returns the mapping of function names into symbolic names of their
+*        parameters.
+*
+* The mapping is created upon the first call.
+*/
+const FuncParamsMap &getFuncParamsMap() {
+	static const FuncParamsMap &funcParamsMap(initFuncParamsMap());
+	return funcParamsMap;
+}
 
 } // anonymous namespace
 
@@ -58,7 +67,7 @@ const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
 */
 std::optional<IntStringMap> getSymbolicNamesForParam(const std::string &funcName,
 		unsigned paramPos) {
-	return getSymbolicNamesForParamFromMap(funcName, paramPos, FUNC_PARAMS_MAP);
+	return getSymbolicNamesForParamFromMap(funcName, paramPos, getFuncParamsMap());
 }
 
 } // namespace libc
@@ -43,60 +43,50 @@ namespace win_api {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_PARAM_NAMES_MAP later in the
-*        file.
-*/
-const FuncParamNamesMap &initFuncParamNamesMap() {
-	static FuncParamNamesMap funcParamNamesMap;
-
-	//
-	// The base of the information for this type of semantics has been obtained
-	// by using the
-	// scripts/backend/semantics/func_var_names/gen_winapi_semantics_from_includes.py
-	// script with includes mingw32-x86-pe/i686-w64-mingw32/includes/win*.h.
-	// The resulting semantics has been updated manually. Useless mappings have
-	// been commented out.
-	//
-
-	// Since having 10 000 lines in a single file was found impossible to
-	// compile by using gcc in a reasonable amount of time and memory (even
-	// using -fno-var-tracking), we had to split the initialization into
-	// several modules.
-	initFuncParamNamesMap_A(funcParamNamesMap);
-	initFuncParamNamesMap_B(funcParamNamesMap);
-	initFuncParamNamesMap_C1(funcParamNamesMap);
-	initFuncParamNamesMap_C2(funcParamNamesMap);
-	initFuncParamNamesMap_D(funcParamNamesMap);
-	initFuncParamNamesMap_E(funcParamNamesMap);
-	initFuncParamNamesMap_F(funcParamNamesMap);
-	initFuncParamNamesMap_G1(funcParamNamesMap);
-	initFuncParamNamesMap_G2(funcParamNamesMap);
-	initFuncParamNamesMap_H(funcParamNamesMap);
-	initFuncParamNamesMap_I(funcParamNamesMap);
-	initFuncParamNamesMap_J(funcParamNamesMap);
-	initFuncParamNamesMap_K(funcParamNamesMap);
-	initFuncParamNamesMap_L(funcParamNamesMap);
-	initFuncParamNamesMap_M(funcParamNamesMap);
-	initFuncParamNamesMap_N(funcParamNamesMap);
-	initFuncParamNamesMap_O(funcParamNamesMap);
-	initFuncParamNamesMap_P(funcParamNamesMap);
-	initFuncParamNamesMap_Q(funcParamNamesMap);
-	initFuncParamNamesMap_R(funcParamNamesMap);
-	initFuncParamNamesMap_S(funcParamNamesMap);
-	initFuncParamNamesMap_T(funcParamNamesMap);
-	initFuncParamNamesMap_U(funcParamNamesMap);
-	initFuncParamNamesMap_V(funcParamNamesMap);
-	initFuncParamNamesMap_W(funcParamNamesMap);
-	initFuncParamNamesMap_X(funcParamNamesMap);
-	initFuncParamNamesMap_Y(funcParamNamesMap);
-	initFuncParamNamesMap_Z(funcParamNamesMap);
-
-	return funcParamNamesMap;
-}
+//
+// The base of the information for this type of semantics has been obtained by
+// using the
+// scripts/backend/semantics/func_var_names/gen_winapi_semantics_from_includes.py
+// script with includes mingw32-x86-pe/i686-w64-mingw32/includes/win*.h. The
+// resulting semantics has been updated manually. Useless mappings have been
+// commented out.
+//
+// Since having 10 000 lines in a single file was found impossible to compile
+// by using gcc in a reasonable amount of time and memory (even using
+// -fno-var-tracking), we had to split the names into several modules.
+//
 
 /// Mapping of function parameter positions into the names of parameters.
-const FuncParamNamesMap &FUNC_PARAM_NAMES_MAP(initFuncParamNamesMap());
+const FuncParamNamesMap FUNC_PARAM_NAMES_MAP({
+	getFuncParamNames_A(),
+	getFuncParamNames_B(),
+	getFuncParamNames_C1(),
+	getFuncParamNames_C2(),
+	getFuncParamNames_D(),
+	getFuncParamNames_E(),
+	getFuncParamNames_F(),
+	getFuncParamNames_G1(),
+	getFuncParamNames_G2(),
+	getFuncParamNames_H(),
+	getFuncParamNames_I(),
+	getFuncParamNames_J(),
+	getFuncParamNames_K(),
+	getFuncParamNames_L(),
+	getFuncParamNames_M(),
+	getFuncParamNames_N(),
+	getFuncParamNames_O(),
+	getFuncParamNames_P(),
+	getFuncParamNames_Q(),
+	getFuncParamNames_R(),
+	getFuncParamNames_S(),
+	getFuncParamNames_T(),
+	getFuncParamNames_U(),
+	getFuncParamNames_V(),
+	getFuncParamNames_W(),
+	getFuncParamNames_X(),
+	getFuncParamNames_Y(),
+	getFuncParamNames_Z(),
+});
 
 } // anonymous namespace
 
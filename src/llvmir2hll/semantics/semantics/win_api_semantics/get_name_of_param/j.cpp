@@ -12,12 +12,13 @@ namespace semantics {
 namespace win_api {
 
 /**
-* @brief Initializes the given map with info about functions starting with J.
+* @brief Returns names of parameters of functions starting with J.
 */
-void initFuncParamNamesMap_J(FuncParamNamesMap &funcParamNamesMap) {
+FuncParamNames getFuncParamNames_J() {
 	//
 	// windows.h
 	//
+	return {};
 }
 
 } // namespace win_api
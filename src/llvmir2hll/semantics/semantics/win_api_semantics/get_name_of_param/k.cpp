@@ -11,20 +11,31 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
 /**
-* @brief Initializes the given map with info about functions starting with K.
+* @brief Names of parameters of functions starting with K.
 */
-void initFuncParamNamesMap_K(FuncParamNamesMap &funcParamNamesMap) {
+constexpr FuncParamName FUNC_PARAM_NAMES_K[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("KillTimer", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("KillTimer", 2, "uIDEvent"); // UINT_PTR
+	ADD_PARAM_NAME("KillTimer", 1, "hWnd") // HWND
+	ADD_PARAM_NAME("KillTimer", 2, "uIDEvent") // UINT_PTR
+
+	ADD_PARAM_NAME("keybd_event", 1, "bVk") // BYTE
+	ADD_PARAM_NAME("keybd_event", 2, "bScan") // BYTE
+	ADD_PARAM_NAME("keybd_event", 3, "dwFlags") // DWORD
+	ADD_PARAM_NAME("keybd_event", 4, "dwExtraInfo") // ULONG_PTR
+};
+
+} // anonymous namespace
 
-	ADD_PARAM_NAME("keybd_event", 1, "bVk"); // BYTE
-	ADD_PARAM_NAME("keybd_event", 2, "bScan"); // BYTE
-	ADD_PARAM_NAME("keybd_event", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("keybd_event", 4, "dwExtraInfo"); // ULONG_PTR
+/**
+* @brief Returns names of parameters of functions starting with K.
+*/
+FuncParamNames getFuncParamNames_K() {
+	return FUNC_PARAM_NAMES_K;
 }
 
 } // namespace win_api
@@ -11,33 +11,44 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
 /**
-* @brief Initializes the given map with info about functions starting with N.
+* @brief Names of parameters of functions starting with N.
 */
-void initFuncParamNamesMap_N(FuncParamNamesMap &funcParamNamesMap) {
+constexpr FuncParamName FUNC_PARAM_NAMES_N[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("NeedCurrentDirectoryForExePathA", 1, "ExeName"); // LPCSTR
-	ADD_PARAM_NAME("NeedCurrentDirectoryForExePathW", 1, "ExeName"); // LPCWSTR
-	ADD_PARAM_NAME("NormalizeString", 1, "NormForm"); // NORM_FORM
-	ADD_PARAM_NAME("NormalizeString", 2, "lpSrcString"); // LPCWSTR
-	ADD_PARAM_NAME("NormalizeString", 3, "cwSrcLength"); // int
-	ADD_PARAM_NAME("NormalizeString", 4, "lpDstString"); // LPWSTR
-	ADD_PARAM_NAME("NormalizeString", 5, "cwDstLength"); // int
-	ADD_PARAM_NAME("NotifyBootConfigStatus", 1, "BootAcceptable"); // WINBOOL
-	ADD_PARAM_NAME("NotifyChangeEventLog", 1, "hEventLog"); // HANDLE
-	ADD_PARAM_NAME("NotifyChangeEventLog", 2, "hEvent"); // HANDLE
-	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 2, "dwNotifyMask"); // DWORD
-	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 3, "pNotifyBuffer"); // PSERVICE_NOTIFYA
-	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 2, "dwNotifyMask"); // DWORD
-	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 3, "pNotifyBuffer"); // PSERVICE_NOTIFYW
-	ADD_PARAM_NAME("NotifyWinEvent", 1, "event"); // DWORD
-	ADD_PARAM_NAME("NotifyWinEvent", 2, "hWnd"); // HWND
-	ADD_PARAM_NAME("NotifyWinEvent", 3, "idObject"); // LONG
-	ADD_PARAM_NAME("NotifyWinEvent", 4, "idChild"); // LONG
+	ADD_PARAM_NAME("NeedCurrentDirectoryForExePathA", 1, "ExeName") // LPCSTR
+	ADD_PARAM_NAME("NeedCurrentDirectoryForExePathW", 1, "ExeName") // LPCWSTR
+	ADD_PARAM_NAME("NormalizeString", 1, "NormForm") // NORM_FORM
+	ADD_PARAM_NAME("NormalizeString", 2, "lpSrcString") // LPCWSTR
+	ADD_PARAM_NAME("NormalizeString", 3, "cwSrcLength") // int
+	ADD_PARAM_NAME("NormalizeString", 4, "lpDstString") // LPWSTR
+	ADD_PARAM_NAME("NormalizeString", 5, "cwDstLength") // int
+	ADD_PARAM_NAME("NotifyBootConfigStatus", 1, "BootAcceptable") // WINBOOL
+	ADD_PARAM_NAME("NotifyChangeEventLog", 1, "hEventLog") // HANDLE
+	ADD_PARAM_NAME("NotifyChangeEventLog", 2, "hEvent") // HANDLE
+	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 1, "hService") // SC_HANDLE
+	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 2, "dwNotifyMask") // DWORD
+	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 3, "pNotifyBuffer") // PSERVICE_NOTIFYA
+	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 1, "hService") // SC_HANDLE
+	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 2, "dwNotifyMask") // DWORD
+	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 3, "pNotifyBuffer") // PSERVICE_NOTIFYW
+	ADD_PARAM_NAME("NotifyWinEvent", 1, "event") // DWORD
+	ADD_PARAM_NAME("NotifyWinEvent", 2, "hWnd") // HWND
+	ADD_PARAM_NAME("NotifyWinEvent", 3, "idObject") // LONG
+	ADD_PARAM_NAME("NotifyWinEvent", 4, "idChild") // LONG
+};
+
+} // anonymous namespace
+
+/**
+* @brief Returns names of parameters of functions starting with N.
+*/
+FuncParamNames getFuncParamNames_N() {
+	return FUNC_PARAM_NAMES_N;
 }
 
 } // namespace win_api
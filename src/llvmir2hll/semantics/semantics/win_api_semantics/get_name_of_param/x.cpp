@@ -11,21 +11,32 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
 /**
-* @brief Initializes the given map with info about functions starting with X.
+* @brief Names of parameters of functions starting with X.
 */
-void initFuncParamNamesMap_X(FuncParamNamesMap &funcParamNamesMap) {
+constexpr FuncParamName FUNC_PARAM_NAMES_X[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("XcvDataW", 1, "hXcv"); // HANDLE
-	ADD_PARAM_NAME("XcvDataW", 2, "pszDataName"); // PCWSTR
-	ADD_PARAM_NAME("XcvDataW", 3, "pInputData"); // PBYTE
-	ADD_PARAM_NAME("XcvDataW", 4, "cbInputData"); // DWORD
-	ADD_PARAM_NAME("XcvDataW", 5, "pOutputData"); // PBYTE
-	ADD_PARAM_NAME("XcvDataW", 6, "cbOutputData"); // DWORD
-	ADD_PARAM_NAME("XcvDataW", 7, "pcbOutputNeeded"); // PDWORD
-	ADD_PARAM_NAME("XcvDataW", 8, "pdwStatus"); // PDWORD
+	ADD_PARAM_NAME("XcvDataW", 1, "hXcv") // HANDLE
+	ADD_PARAM_NAME("XcvDataW", 2, "pszDataName") // PCWSTR
+	ADD_PARAM_NAME("XcvDataW", 3, "pInputData") // PBYTE
+	ADD_PARAM_NAME("XcvDataW", 4, "cbInputData") // DWORD
+	ADD_PARAM_NAME("XcvDataW", 5, "pOutputData") // PBYTE
+	ADD_PARAM_NAME("XcvDataW", 6, "cbOutputData") // DWORD
+	ADD_PARAM_NAME("XcvDataW", 7, "pcbOutputNeeded") // PDWORD
+	ADD_PARAM_NAME("XcvDataW", 8, "pdwStatus") // PDWORD
+};
+
+} // anonymous namespace
+
+/**
+* @brief Returns names of parameters of functions starting with X.
+*/
+FuncParamNames getFuncParamNames_X() {
+	return FUNC_PARAM_NAMES_X;
 }
 
 } // namespace win_api
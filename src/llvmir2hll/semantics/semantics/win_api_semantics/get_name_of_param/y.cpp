@@ -12,12 +12,13 @@ namespace semantics {
 namespace win_api {
 
 /**
-* @brief Initializes the given map with info about functions starting with Y.
+* @brief Returns names of parameters of functions starting with Y.
 */
-void initFuncParamNamesMap_Y(FuncParamNamesMap &funcParamNamesMap) {
+FuncParamNames getFuncParamNames_Y() {
 	//
 	// windows.h
 	//
+	return {};
 }
 
 } // namespace win_api
@@ -11,14 +11,25 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
 /**
-* @brief Initializes the given map with info about functions starting with Z.
+* @brief Names of parameters of functions starting with Z.
 */
-void initFuncParamNamesMap_Z(FuncParamNamesMap &funcParamNamesMap) {
+constexpr FuncParamName FUNC_PARAM_NAMES_Z[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("ZombifyActCtx", 1, "hActCtx"); // HANDLE
+	ADD_PARAM_NAME("ZombifyActCtx", 1, "hActCtx") // HANDLE
+};
+
+} // anonymous namespace
+
+/**
+* @brief Returns names of parameters of functions starting with Z.
+*/
+FuncParamNames getFuncParamNames_Z() {
+	return FUNC_PARAM_NAMES_Z;
 }
 
 } // namespace win_api
@@ -0,0 +1,254 @@
+/**
+* @file src/llvmir2hll/support/node_pool.cpp
+* @brief Implementation of NodePool.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <array>
+#include <mutex>
+#include <new>
+
+#include "retdec/llvmir2hll/support/node_pool.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/// Alignment and granularity of blocks.
+constexpr std::size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
+
+/// Number of size classes (the largest pooled block has 512 bytes).
+constexpr std::size_t NUM_OF_SIZE_CLASSES = 32;
+
+/// Size of the largest block provided by the pool.
+constexpr std::size_t MAX_POOLED_SIZE = BLOCK_ALIGNMENT * NUM_OF_SIZE_CLASSES;
+
+/// Size of chunks the blocks are carved from.
+constexpr std::size_t CHUNK_SIZE = 64 * 1024;
+
+/// Number of blocks moved between a thread cache and the shared pool at once.
+constexpr std::size_t BATCH_SIZE = 64;
+
+/**
+* @brief A free block (the link is stored in the block itself).
+*/
+struct FreeBlock {
+	FreeBlock *next;
+};
+
+/**
+* @brief A singly-linked list of free blocks of the same size.
+*/
+struct FreeList {
+	bool empty() const {
+		return head == nullptr;
+	}
+
+	void push(void *ptr) {
+		auto block = static_cast<FreeBlock *>(ptr);
+		block->next = head;
+		head = block;
+		++length;
+	}
+
+	void *pop() {
+		FreeBlock *block = head;
+		head = block->next;
+		--length;
+		return block;
+	}
+
+	FreeBlock *head;
+	std::size_t length;
+};
+
+/**
+* @brief Returns the size class of blocks for the given size.
+*
+* @par Preconditions
+*  - <tt>0 < size <= MAX_POOLED_SIZE</tt>
+*/
+std::size_t getSizeClass(std::size_t size) {
+	return (size + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT - 1;
+}
+
+/**
+* @brief Returns the size of blocks of the given size class.
+*/
+std::size_t getBlockSize(std::size_t sizeClass) {
+	return (sizeClass + 1) * BLOCK_ALIGNMENT;
+}
+
+/**
+* @brief Free blocks and unused parts of chunks shared by all threads.
+*/
+class SharedPool {
+public:
+	/**
+	* @brief Moves up to @c BATCH_SIZE free blocks of the given size class
+	*        into @a list.
+	*/
+	void refill(std::size_t sizeClass, FreeList &list) {
+		std::lock_guard<std::mutex> lock(mutex);
+		for (std::size_t i = 0; i < BATCH_SIZE; ++i) {
+			list.push(allocateUnlocked(sizeClass));
+		}
+	}
+
+	/**
+	* @brief Moves @a count blocks from @a list into the pool.
+	*/
+	void release(std::size_t sizeClass, FreeList &list, std::size_t count) {
+		std::lock_guard<std::mutex> lock(mutex);
+		for (std::size_t i = 0; i < count && !list.empty(); ++i) {
+			freeBlocks[sizeClass].push(list.pop());
+		}
+	}
+
+	/**
+	* @brief Returns a single block of the given size class.
+	*/
+	void *allocate(std::size_t sizeClass) {
+		std::lock_guard<std::mutex> lock(mutex);
+		return allocateUnlocked(sizeClass);
+	}
+
+	/**
+	* @brief Returns a single block of the given size class into the pool.
+	*/
+	void deallocate(std::size_t sizeClass, void *ptr) {
+		std::lock_guard<std::mutex> lock(mutex);
+		freeBlocks[sizeClass].push(ptr);
+	}
+
+private:
+	void *allocateUnlocked(std::size_t sizeClass) {
+		if (!freeBlocks[sizeClass].empty()) {
+			return freeBlocks[sizeClass].pop();
+		}
+
+		std::size_t blockSize = getBlockSize(sizeClass);
+		if (chunkSizeLeft[sizeClass] < blockSize) {
+			chunkPos[sizeClass] = static_cast<char *>(::operator new(CHUNK_SIZE));
+			chunkSizeLeft[sizeClass] = CHUNK_SIZE;
+		}
+		void *block = chunkPos[sizeClass];
+		chunkPos[sizeClass] += blockSize;
+		chunkSizeLeft[sizeClass] -= blockSize;
+		return block;
+	}
+
+private:
+	/// Mutex guarding the pool.
+	std::mutex mutex;
+
+	/// Free blocks for every size class.
+	std::array<FreeList, NUM_OF_SIZE_CLASSES> freeBlocks{};
+
+	/// Unused part of the current chunk for every size class.
+	std::array<char *, NUM_OF_SIZE_CLASSES> chunkPos{};
+
+	/// Size of the unused part of the current chunk for every size class.
+	std::array<std::size_t, NUM_OF_SIZE_CLASSES> chunkSizeLeft{};
+};
+
+/**
+* @brief Returns the pool shared by all threads.
+*/
+SharedPool &getSharedPool() {
+	// The pool is intentionally never destroyed because nodes may be
+	// destroyed during the destruction of static objects.
+	static SharedPool *pool = new SharedPool();
+	return *pool;
+}
+
+/// Free blocks cached by the current thread.
+// The cache is trivially destructible, so it can be safely accessed even
+// after it has been flushed when the thread exits.
+thread_local std::array<FreeList, NUM_OF_SIZE_CLASSES> threadCache{};
+
+/// Has the cache of the current thread been flushed on thread exit?
+thread_local bool threadCacheFlushed = false;
+
+/**
+* @brief Returns blocks cached by the current thread into the shared pool when
+*        the thread exits.
+*/
+class ThreadCacheFlusher {
+public:
+	~ThreadCacheFlusher() {
+		for (std::size_t i = 0; i < NUM_OF_SIZE_CLASSES; ++i) {
+			getSharedPool().release(i, threadCache[i], threadCache[i].length);
+		}
+		threadCacheFlushed = true;
+	}
+};
+
+/**
+* @brief Makes sure that the cache of the current thread is flushed when the
+*        thread exits.
+*/
+void flushThreadCacheOnExit() {
+	thread_local ThreadCacheFlusher flusher;
+	static_cast<void>(flusher);
+}
+
+} // anonymous namespace
+
+/**
+* @brief Allocates a block of at least @a size bytes.
+*
+* The block is suitably aligned for any object of that size.
+*/
+void *NodePool::allocate(std::size_t size) {
+	if (size == 0 || size > MAX_POOLED_SIZE) {
+		return ::operator new(size);
+	}
+
+	std::size_t sizeClass = getSizeClass(size);
+	if (threadCacheFlushed) {
+		return getSharedPool().allocate(sizeClass);
+	}
+
+	FreeList &list = threadCache[sizeClass];
+	if (list.empty()) {
+		flushThreadCacheOnExit();
+		getSharedPool().refill(sizeClass, list);
+	}
+	return list.pop();
+}
+
+/**
+* @brief Deallocates a block obtained from allocate().
+*
+* @param[in] ptr Pointer to the block (may be the null pointer).
+* @param[in] size The same size that was passed to allocate().
+*/
+void NodePool::deallocate(void *ptr, std::size_t size) {
+	if (!ptr) {
+		return;
+	}
+
+	if (size == 0 || size > MAX_POOLED_SIZE) {
+		::operator delete(ptr);
+		return;
+	}
+
+	std::size_t sizeClass = getSizeClass(size);
+	if (threadCacheFlushed) {
+		getSharedPool().deallocate(sizeClass, ptr);
+		return;
+	}
+
+	// Do not let a thread that mostly frees nodes created by other threads
+	// hoard free blocks.
+	FreeList &list = threadCache[sizeClass];
+	list.push(ptr);
+	if (list.length > 2 * BATCH_SIZE) {
+		getSharedPool().release(sizeClass, list, BATCH_SIZE);
+	}
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -6,6 +6,7 @@
 
 #include <climits>
 #include <cstring>
+#include <mutex>
 
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/string.h"
@@ -437,7 +438,9 @@ const retdec::fileformat::LoaderErrorInfo & Image::getLoaderErrorInfo() const
 
 Segment* Image::insertSegment(std::unique_ptr<Segment> segment)
 {
+	segment->_layoutVersion = &_segmentLayoutVersion;
 	_segments.push_back(std::move(segment));
+	invalidateSegmentIndex();
 
 	// We have used move constructor, segment is no longer valid pointer
 	// Now give segment name
@@ -453,6 +456,7 @@ void Image::removeSegment(Segment* segment)
 		if (itr->get() == segment)
 		{
 			_segments.erase(itr);
+			invalidateSegmentIndex();
 			return;
 		}
 	}
@@ -472,6 +476,7 @@ void Image::sortSegments()
 			{
 				return seg1->getAddress() < seg2->getAddress();
 			});
+	invalidateSegmentIndex();
 }
 
 const Segment* Image::_getSegment(std::size_t index) const
@@ -506,13 +511,31 @@ const Segment* Image::_getSegmentWithIndex(std::size_t index) const
 
 const Segment* Image::_getSegmentFromAddress(std::uint64_t address) const
 {
-	for (const auto& segment : getSegments())
 	{
-		if (segment->containsAddress(address))
-			return segment.get();
+		std::shared_lock<std::shared_mutex> lock(_segmentIndexMutex);
+		if (_segmentIndexValid && _segmentIndexVersion == _segmentLayoutVersion.load(std::memory_order_relaxed))
+			return _segmentIndex.find(address);
 	}
 
-	return nullptr;
+	std::unique_lock<std::shared_mutex> lock(_segmentIndexMutex);
+	const auto layoutVersion = _segmentLayoutVersion.load(std::memory_order_relaxed);
+	if (!_segmentIndexValid || _segmentIndexVersion != layoutVersion)
+	{
+		_segmentIndex.clear();
+		for (const auto& segment : getSegments())
+			_segmentIndex.add(segment->getAddress(), segment->getEndAddress(), segment.get());
+		_segmentIndex.build();
+
+		_segmentIndexVersion = layoutVersion;
+		_segmentIndexValid = true;
+	}
+
+	return _segmentIndex.find(address);
+}
+
+void Image::invalidateSegmentIndex()
+{
+	_segmentLayoutVersion.fetch_add(1, std::memory_order_relaxed);
 }
 
 } // namespace loader
@@ -258,6 +258,7 @@ bool Segment::setBytes(const std::vector<unsigned char>& value, std::uint64_t ad
 void Segment::resize(std::uint64_t newSize)
 {
 	_size = newSize;
+	layoutChanged();
 
 	if (_dataSource != nullptr)
 		_dataSource->resize(newSize);
@@ -287,6 +288,7 @@ void Segment::shrink(std::uint64_t newAddress, std::uint64_t newSize)
 
 	_address = newAddress;
 	_size = newSize;
+	layoutChanged();
 
 	if (_dataSource != nullptr)
 		_dataSource->shrink(shrinkOffset, newSize);
@@ -310,5 +312,15 @@ void Segment::addNonDecodableRange(retdec::common::Range<std::uint64_t> range)
 	_nonDecodableRanges.insert(std::move(range));
 }
 
+/**
+ * Notes that address range of the segment changed, so that the index of segments
+ * of the image containing it is rebuilt.
+ */
+void Segment::layoutChanged()
+{
+	if (_layoutVersion)
+		_layoutVersion->fetch_add(1, std::memory_order_relaxed);
+}
+
 } // namespace loader
 } // namespace retdec
@@ -0,0 +1,252 @@
+/**
+ * @file src/loader/utils/pointer_scanner.cpp
+ * @brief Definition of scanner of pointers stored in segments.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <iterator>
+
+#include "retdec/loader/loader/image.h"
+#include "retdec/loader/utils/pointer_scanner.h"
+
+using namespace retdec::utils;
+
+namespace retdec {
+namespace loader {
+
+namespace {
+
+/**
+ * Number of words decoded and classified at once.
+ */
+const std::size_t chunkWords = 4096;
+
+/**
+ * Maximal number of ranges which are compared with all words one by one.
+ * Words are looked up in more ranges by a binary search.
+ */
+const std::size_t linearRangesLimit = 32;
+
+} // anonymous namespace
+
+/**
+ * Constructor.
+ *
+ * @param image Image whose segments are scanned.
+ */
+PointerScanner::PointerScanner(const Image* image) : _image(image)
+{
+	_wordSize = _image->getBytesPerWord();
+	_littleEndian = _image->isLittleEndian();
+
+	std::vector<std::pair<std::uint64_t, std::uint64_t>> all;
+	std::vector<std::pair<std::uint64_t, std::uint64_t>> targets;
+	for (const auto& segment : _image->getSegments())
+	{
+		all.emplace_back(segment->getAddress(), segment->getEndAddress());
+
+		// Same condition as in Image::hasDataOnAddress().
+		if (segment->getSecSeg() && !segment->getSecSeg()->isDebug())
+			targets.emplace_back(segment->getAddress(), segment->getEndAddress());
+	}
+
+	// Overlapping segments hide each other in the segment lookup of the image,
+	// so their words and ranges are left to the image.
+	std::sort(all.begin(), all.end());
+	bool overlap = false;
+	for (std::size_t i = 1; i < all.size(); ++i)
+		overlap |= all[i].first < all[i - 1].second;
+
+	_fast = !overlap
+			&& _image->getByteLength() == 8
+			&& _wordSize > 0 && _wordSize <= sizeof(std::uint64_t)
+			&& (_image->isLittleEndian() || _image->isBigEndian());
+	if (!_fast)
+		return;
+
+	std::sort(targets.begin(), targets.end());
+	for (const auto& range : targets)
+	{
+		if (!_ranges.empty() && _ranges.back().second == range.first)
+			_ranges.back().second = range.second;
+		else
+			_ranges.push_back(range);
+	}
+}
+
+/**
+ * Returns the size of scanned words in bytes.
+ *
+ * @return Size of words.
+ */
+std::uint64_t PointerScanner::getWordSize() const
+{
+	return _wordSize;
+}
+
+/**
+ * Classifies all words of the segment.
+ *
+ * @param segment Segment of the scanned image.
+ * @param kinds Into this parameter is stored a bit mask of kinds (see Kind)
+ *   of every word of the segment, the i-th one describes the word on address
+ *   <tt>segment start + i * word size</tt>. There is one item for every such
+ *   address inside the segment, including the last words which do not fit
+ *   into the segment and so they are not readable.
+ */
+void PointerScanner::classify(const Segment* segment, std::vector<std::uint8_t>& kinds) const
+{
+	kinds.clear();
+	if (_wordSize == 0)
+		return;
+
+	if (!_fast)
+	{
+		classifyByImage(segment, kinds);
+		return;
+	}
+
+	const auto span = segment->getEndAddress() - segment->getAddress();
+	const auto size = segment->getSize();
+	const auto rawData = segment->getRawData();
+	const auto* raw = rawData.first;
+	const auto rawSize = raw ? rawData.second : 0;
+
+	kinds.assign((span + _wordSize - 1) / _wordSize, 0);
+
+	// The data source may be longer than the segment, so the word crossing the
+	// end of the segment can contain bytes after the raw data. Such a word is
+	// read by the image.
+	std::size_t crossing = kinds.size();
+	if (rawSize == size && size % _wordSize != 0)
+		crossing = size / _wordSize;
+
+	std::vector<std::uint64_t> values;
+	values.reserve(chunkWords);
+	for (std::size_t first = 0; first < kinds.size(); first += chunkWords)
+	{
+		const auto last = std::min(kinds.size(), first + chunkWords);
+
+		// Read the words as Segment::getBytes() does, bytes after the raw
+		// data are zeroes.
+		values.clear();
+		for (std::size_t i = first; i < last; ++i)
+		{
+			const std::uint64_t offset = i * _wordSize;
+			std::uint64_t value = 0;
+			if (offset <= size && size - offset >= _wordSize)
+			{
+				kinds[i] = READABLE;
+				for (std::uint64_t b = 0; b < _wordSize && offset + b < rawSize; ++b)
+				{
+					const auto shift = 8 * (_littleEndian ? b : _wordSize - b - 1);
+					value |= static_cast<std::uint64_t>(raw[offset + b]) << shift;
+				}
+				if (value == 0)
+					kinds[i] |= ZERO;
+			}
+			values.push_back(value);
+		}
+
+		classifyByRanges(values, kinds.data() + first);
+	}
+
+	if (crossing < kinds.size())
+		kinds[crossing] = classifyByImage(segment->getAddress() + crossing * _wordSize);
+}
+
+/**
+ * Finds all words of the segment which are pointers.
+ *
+ * @param segment Segment of the scanned image.
+ *
+ * @return Sorted addresses of words which are pointers.
+ */
+std::vector<std::uint64_t> PointerScanner::findPointers(const Segment* segment) const
+{
+	std::vector<std::uint8_t> kinds;
+	classify(segment, kinds);
+
+	std::vector<std::uint64_t> pointers;
+	for (std::size_t i = 0; i < kinds.size(); ++i)
+	{
+		if (kinds[i] & POINTER)
+			pointers.push_back(segment->getAddress() + i * _wordSize);
+	}
+	return pointers;
+}
+
+/**
+ * Returns whether the value points into some of the ranges.
+ */
+bool PointerScanner::isPointerValue(std::uint64_t value) const
+{
+	auto it = std::upper_bound(_ranges.begin(), _ranges.end(), value,
+			[](std::uint64_t v, const std::pair<std::uint64_t, std::uint64_t>& range)
+			{
+				return v < range.first;
+			});
+	return it != _ranges.begin() && value < std::prev(it)->second;
+}
+
+/**
+ * Classifies words of the segment one by one through the image.
+ */
+void PointerScanner::classifyByImage(const Segment* segment, std::vector<std::uint8_t>& kinds) const
+{
+	for (std::uint64_t address = segment->getAddress(); address < segment->getEndAddress(); address += _wordSize)
+		kinds.push_back(classifyByImage(address));
+}
+
+/**
+ * Classifies the word on the address through the image.
+ */
+std::uint8_t PointerScanner::classifyByImage(std::uint64_t address) const
+{
+	std::uint8_t kind = 0;
+	std::uint64_t value = 0;
+	if (_image->getWord(address, value))
+	{
+		kind |= READABLE;
+		kind |= value == 0 ? ZERO : 0;
+		kind |= _image->hasDataOnAddress(value) ? POINTER : 0;
+	}
+	return kind;
+}
+
+/**
+ * Marks readable words whose values point into some of the ranges as pointers.
+ *
+ * @param values Values of words.
+ * @param kinds Kinds of the same words.
+ */
+void PointerScanner::classifyByRanges(const std::vector<std::uint64_t>& values, std::uint8_t* kinds) const
+{
+	const auto n = values.size();
+	if (_ranges.size() > linearRangesLimit)
+	{
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			if ((kinds[i] & READABLE) && isPointerValue(values[i]))
+				kinds[i] |= POINTER;
+		}
+		return;
+	}
+
+	// Branch-free comparisons of all the words with one range after another,
+	// which compilers turn into vector instructions.
+	std::uint8_t hits[chunkWords] = {};
+	for (const auto& range : _ranges)
+	{
+		const auto start = range.first;
+		const auto length = range.second - range.first;
+		for (std::size_t i = 0; i < n; ++i)
+			hits[i] |= static_cast<std::uint8_t>(values[i] - start < length);
+	}
+	for (std::size_t i = 0; i < n; ++i)
+		kinds[i] |= (kinds[i] & READABLE) * hits[i] * POINTER;
+}
+
+} // namespace loader
+} // namespace retdec
@@ -20,7 +20,8 @@ namespace pdbparser {
 // =================================================================
 
 /**
- * Loads PDB file into memory and separates all streams.
+ * Maps PDB file into memory and finds pages of all streams.
+ * Streams are extracted from their pages on first access, see get_stream().
  * Must be called before using of any method.
  * Can be called only once.
  * @param filename Name of PDB file to load.
@@ -31,22 +32,17 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 	if (pdb_loaded)
 		return PDB_STATE_ALREADY_LOADED;
 
-	// Load PDB file into memory
+	// Map PDB file into memory, only the pages which are used are read
 	pdb_filename = filename;
-	FILE *fp = fopen(filename,"rb");
-	if (fp == nullptr)
+	if (!pdb_file.open(filename))
 	{
 		return PDB_STATE_ERR_FILE_OPEN;
 	}
-	fseek(fp, 0, SEEK_END);  // Determine file size
-	pdb_file_size = ftell(fp);
-	fseek(fp, 0, SEEK_SET);
-	pdb_file_data = new char[pdb_file_size]; // Allocate memory
-	size_t result = fread(pdb_file_data,1,pdb_file_size,fp); // Read the file
-	fclose(fp);
-	if (result != pdb_file_size)
+	pdb_file_size = pdb_file.getSize();
+	pdb_file_data = reinterpret_cast<char *>(pdb_file.getData());
+	if (pdb_file_size < sizeof(PDB_HEADER))
 	{
-		return PDB_STATE_ERR_FILE_OPEN;
+		return PDB_STATE_INVALID_FILE;
 	}
 
 	// Get the version of PDB file and parse it
@@ -64,13 +60,16 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 		pdb_version = PDB_VERSION_700;
 		state = load_pdb_v700();
 		// Get pointer to PDB info header
-		if (streams.size() > PDB_STREAM_PDB)
-		{
-			pdb_info_v700 = reinterpret_cast<PDBInfo70 *>(streams[PDB_STREAM_PDB].data);
-		}
-		else
+		if (state == PDB_STATE_OK)
 		{
-			return PDB_STATE_INVALID_FILE;
+			if (streams.size() > PDB_STREAM_PDB)
+			{
+				pdb_info_v700 = reinterpret_cast<PDBInfo70 *>(get_stream(PDB_STREAM_PDB)->data);
+			}
+			else
+			{
+				return PDB_STATE_INVALID_FILE;
+			}
 		}
 	}
 	else // Invalid file
@@ -83,7 +82,9 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 }
 
 /**
- * Processes all PDB file streams and fills data containers.
+ * Processes DBI stream and fills lists of modules and sections.
+ * Types and symbols are parsed later when they are asked for,
+ * see get_types_container() and get_symbols_container().
  * Must be called after load_pdb_file() and before any getting and printing or dumping method.
  * Can be called only once.
  * @param image_base Base address of program's virtual memory.
@@ -95,18 +96,15 @@ void PDBFile::initialize(int image_base)
 		return;
 	}
 
-	// Initialize types
-	pdb_types = new PDBTypes(&streams[PDB_STREAM_TPI]);
-	pdb_types->parse_types();
-
 	// Check if DBI stream is present
 	bool dbi_present = (num_streams > PDB_STREAM_DBI && streams[PDB_STREAM_DBI].unused == false);
 
 	if (dbi_present)
 	{
 		// Get DBI stream
-		unsigned int pdb_dbi_size = streams[PDB_STREAM_DBI].size;
-		char * pdb_dbi_data = streams[PDB_STREAM_DBI].data;
+		PDBStream * pdb_dbi_stream = get_stream(PDB_STREAM_DBI);
+		unsigned int pdb_dbi_size = pdb_dbi_stream->size;
+		char * pdb_dbi_data = pdb_dbi_stream->data;
 
 		// Get pointer to DBI header
 		dbi_header_v700 = reinterpret_cast<NewDBIHdr *>(pdb_dbi_data);
@@ -124,15 +122,72 @@ void PDBFile::initialize(int image_base)
 		if (image_base == 0)
 			image_base = 0x400000; // Default image base
 		parse_sections(image_base);
+	}
+	pdb_initialized = true;
+}
+
+/**
+ * Returns stream with the given number, extracts it from PDB file on first access.
+ * Can be called after load_pdb_file() was executed.
+ * @param num Number of stream
+ * @return Stream or nullptr if there is no such stream
+ */
+PDBStream * PDBFile::get_stream(unsigned int num)
+{
+	if (num >= num_streams)
+		return nullptr;
+
+	PDBStream *stream = &streams[num];
+	if (!stream->unused && stream->data == nullptr)
+	{
+		// Stream is linear in pdb file, we just get a pointer to it
+		if (stream->linear)
+			stream->data = pdb_file_data + stream->pages[0] * page_size;
+		// Stream is not linear in pdb file, we must copy it to linear memory
+		else
+			stream->data = extract_stream(stream->pages, stream->num_pages);
+	}
+	return stream;
+}
+
+/**
+ * Returns types container, TPI stream is parsed on first call.
+ * Can be called after initialize() was executed.
+ * @return Types or nullptr if PDB file was not initialized
+ */
+PDBTypes * PDBFile::get_types_container(void)
+{
+	if (pdb_types == nullptr && pdb_initialized)
+	{
+		pdb_types = new PDBTypes(get_stream(PDB_STREAM_TPI));
+		pdb_types->parse_types();
+	}
+	return pdb_types;
+}
+
+/**
+ * Returns symbols container, symbol streams of all modules are parsed on first call.
+ * Can be called after initialize() was executed.
+ * @return Symbols or nullptr if PDB file was not initialized or DBI stream is not present
+ */
+PDBSymbols * PDBFile::get_symbols_container(void)
+{
+	if (pdb_symbols == nullptr && pdb_initialized && dbi_header_v700 != nullptr)
+	{
+		PDBTypes *types = get_types_container();
+
+		// Module streams are read directly by the symbols container
+		for (unsigned int i = 0; i < modules.size(); i++)
+			if (modules[i].stream != nullptr)
+				get_stream(modules[i].stream_num);
 
-		// Initialize symbols
 		int pdb_gsi_num = dbi_header_v700->snGSSyms;
 		int pdb_psi_num = dbi_header_v700->snPSSyms;
 		int pdb_sym_num = dbi_header_v700->snSymRecs;
-		pdb_symbols = new PDBSymbols(&streams[pdb_gsi_num],&streams[pdb_psi_num],&streams[pdb_sym_num],modules,sections,pdb_types);
+		pdb_symbols = new PDBSymbols(get_stream(pdb_gsi_num),get_stream(pdb_psi_num),get_stream(pdb_sym_num),modules,sections,types);
 		pdb_symbols->parse_symbols();
 	}
-	pdb_initialized = true;
+	return pdb_symbols;
 }
 
 /**
@@ -153,8 +208,9 @@ bool PDBFile::save_streams_to_files(void)
 		FILE *fs = fopen(stream_filename,"wb");
 		if (fs == nullptr)
 			return false;
-		if (!streams[i].unused)
-			fwrite(streams[i].data,1,streams[i].size,fs);
+		PDBStream *stream = get_stream(i);
+		if (!stream->unused)
+			fwrite(stream->data,1,stream->size,fs);
 		fclose(fs);
 	}
 	return true;
@@ -240,7 +296,7 @@ void PDBFile::dump_FPO(void)
 		return;
 	}
 
-	PDBStream *pdb_fpo_stream = &streams[pdb_fpo_num];
+	PDBStream *pdb_fpo_stream = get_stream(pdb_fpo_num);
 	int fpoSize = pdb_fpo_stream->size;
 	PDB_FPO_DATA *fpo = reinterpret_cast<PDB_FPO_DATA *>(pdb_fpo_stream->data);
 
@@ -282,7 +338,7 @@ void PDBFile::dump_PE_sections(void)
 		return;
 	}
 
-	PDBStream *pdb_sect_stream = &streams[pdb_sec_num];
+	PDBStream *pdb_sect_stream = get_stream(pdb_sec_num);
 	PDB_PVOID pSect = pdb_sect_stream->data;
 	unsigned long sectSize = pdb_sect_stream->size;
 
@@ -305,11 +361,9 @@ void PDBFile::dump_PE_sections(void)
  */
 PDBFile::~PDBFile()
 {
-	if (pdb_file_data)
-		delete [] pdb_file_data;
-	// Delete all non-linear (copied) streams
+	// Delete all non-linear (copied) streams, linear ones point into mapped file
 	for (unsigned int i = 0; i < num_streams;i++)
-		if (!streams[i].unused && !streams[i].linear)
+		if (!streams[i].linear)
 			delete [] streams[i].data;
 	if (pdb_types)
 		delete pdb_types;
@@ -336,6 +390,21 @@ bool PDBFile::stream_is_linear(PDB_DWORD *pages, int num_pages)
 	return true;
 }
 
+/**
+ * Determines whether all pages of stream are inside PDB file
+ * @param pages Index of pages used by stream
+ * @param num_pages Number of pages used by stream
+ * @return Stream is inside PDB file
+ */
+bool PDBFile::stream_is_in_file(PDB_DWORD *pages, int num_pages)
+{
+	PDB_DWORD file_pages = pdb_file_size / page_size;
+	for (int i = 0;i < num_pages;i++)
+		if (pages[i] >= file_pages)
+			return false;
+	return true;
+}
+
 /**
  * Extracts non-linear stream into linear memory.
  * @param pages Index of pages used by stream
@@ -365,8 +434,8 @@ PDBFileState PDBFile::load_pdb_v200(void)
 }
 
 /**
- * Separates all streams from PDB file version 7.00.
- * Vector "streams" is filled here.
+ * Finds pages of all streams from PDB file version 7.00.
+ * Vector "streams" is filled here, stream data are extracted later by get_stream().
  * @return State (OK or Invalid file)
  */
 PDBFileState PDBFile::load_pdb_v700(void)
@@ -382,13 +451,21 @@ PDBFileState PDBFile::load_pdb_v700(void)
 
 	// Get root directory
 	int pages_per_root = (pdb_header->V700.dRootSize + page_size - 1) / page_size;
+	if (pages_per_root <= 0 || unsigned(pages_per_root) > page_size / sizeof(PDB_DWORD)
+			|| !stream_is_in_file(&pdb_header->V700.dRootIndexesPage, 1))
+		return PDB_STATE_INVALID_FILE;
 	PDB_DWORD *root_dir_indexes = reinterpret_cast<PDB_DWORD *>(pdb_file_data + (pdb_header->V700.dRootIndexesPage) * page_size);
+	if (!stream_is_in_file(root_dir_indexes, pages_per_root))
+		return PDB_STATE_INVALID_FILE;
 	if (stream_is_linear(root_dir_indexes, pages_per_root))
 		pdb_root_dir = reinterpret_cast<PDB_ROOT *>(pdb_file_data + root_dir_indexes[0] * page_size);
 	else
 		pdb_root_dir = reinterpret_cast<PDB_ROOT *>(extract_stream(root_dir_indexes, pages_per_root));
 
-	// Get streams
+	// Get streams, root directory must contain sizes of all streams
+	unsigned long long root_dwords = pdb_header->V700.dRootSize / sizeof(PDB_DWORD);
+	if (1ULL + pdb_root_dir->V700.dNumStreams > root_dwords)
+		return PDB_STATE_INVALID_FILE;
 	num_streams = pdb_root_dir->V700.dNumStreams;
 	// Allocate memory for streams. We need to use resize() instead of
 	// reserve() because reserve() does not increases the size of the
@@ -396,34 +473,31 @@ PDBFileState PDBFile::load_pdb_v700(void)
 	streams.resize(num_streams);
 	int cur_pagedir_index = num_streams + 0;  // Skip dwords with stream sizes
 
-	// Extract each stream
+	// Find pages of each stream
 	for (unsigned int i = 0; i < num_streams;i++)
 	{
 		streams[i].size = pdb_root_dir->V700.adStreamSizes[i];
+		streams[i].data = nullptr;
 		// Stream is empty
 		if (streams[i].size <= 0)
 		{
 			streams[i].unused = true;
 			streams[i].linear = false;
-			streams[i].data = nullptr;
+			streams[i].pages = nullptr;
+			streams[i].num_pages = 0;
 		}
 		// Stream is not empty
 		else
 		{
 			streams[i].unused = false;
 			int pages_per_stream = (streams[i].size + page_size - 1) / page_size;
-			// Stream is linear in pdb file, we just get a pointer to it
-			if (stream_is_linear(&pdb_root_dir->V700.adStreamSizes[cur_pagedir_index], pages_per_stream))
-			{
-				streams[i].data = pdb_file_data + pdb_root_dir->V700.adStreamSizes[cur_pagedir_index] * page_size;
-				streams[i].linear = true;
-			}
-			// Stream is not linear in pdb file, we must copy it to linear memory
-			else
-			{
-				streams[i].data = extract_stream(&pdb_root_dir->V700.adStreamSizes[cur_pagedir_index], pages_per_stream);
-				streams[i].linear = false;
-			}
+			if (1ULL + cur_pagedir_index + pages_per_stream > root_dwords)
+				return PDB_STATE_INVALID_FILE;
+			streams[i].pages = &pdb_root_dir->V700.adStreamSizes[cur_pagedir_index];
+			streams[i].num_pages = pages_per_stream;
+			if (!stream_is_in_file(streams[i].pages, pages_per_stream))
+				return PDB_STATE_INVALID_FILE;
+			streams[i].linear = stream_is_linear(streams[i].pages, pages_per_stream);
 			cur_pagedir_index += pages_per_stream;  // Increase index to next stream
 		}
 	}
@@ -437,7 +511,7 @@ PDBFileState PDBFile::load_pdb_v700(void)
 void PDBFile::parse_modules(void)
 {
 	// Get DBI stream size and data
-	PDBStream * pdb_dbi_stream = &streams[PDB_STREAM_DBI];
+	PDBStream * pdb_dbi_stream = get_stream(PDB_STREAM_DBI);
 	unsigned int pdb_dbi_size = pdb_dbi_stream->size;
 	char * pdb_dbi_data = pdb_dbi_stream->data;
 
@@ -497,7 +571,7 @@ void PDBFile::parse_sections(int image_base)
 		return;
 
 	// Get stream with section info
-	PDBStream * pdb_sect_stream = &streams[pdb_sec_num];
+	PDBStream * pdb_sect_stream = get_stream(pdb_sec_num);
 	unsigned int pdb_sect_size = pdb_sect_stream->size;
 	char * pdb_sect_data = pdb_sect_stream->data;
 
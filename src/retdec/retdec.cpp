@@ -5,12 +5,17 @@
  */
 
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <llvm/ADT/Triple.h>
 #include <llvm/Analysis/CallGraph.h>
 #include <llvm/Analysis/CallGraphSCCPass.h>
+#include <llvm/Analysis/LoopInfo.h>
 #include <llvm/Analysis/LoopPass.h>
 #include <llvm/Analysis/RegionPass.h>
+#include <llvm/Analysis/ScalarEvolution.h>
 #include <llvm/Analysis/TargetLibraryInfo.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeWriterPass.h>
@@ -46,12 +51,25 @@
 
 #include "retdec/bin2llvmir/optimizations/decoder/decoder.h"
 #include "retdec/bin2llvmir/optimizations/provider_init/provider_init.h"
+#include "retdec/bin2llvmir/providers/abi/abi.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/debugformat.h"
+#include "retdec/bin2llvmir/providers/demangler.h"
+#include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/names.h"
 
 #include "retdec/config/config.h"
+#include "retdec/cpdetect/compiler_detector/compiler_detector.h"
+#include "retdec/ctypesparser/type_config.h"
+#include "retdec/fileformat/file_format/pe/pe_format.h"
 #include "retdec/llvm-support/diagnostics.h"
+#include "retdec/llvmir2hll/config/configs/json_config.h"
+#include "retdec/llvmir2hll/llvmir2hll.h"
 #include "retdec/retdec/retdec.h"
+#include "retdec/stacofin/stacofin.h"
+#include "retdec/utils/scope_exit.h"
 
 /**
  * Create an empty input module.
@@ -85,6 +103,169 @@ std::unique_ptr<llvm::Module> createLlvmModule(llvm::LLVMContext& Context)
 
 namespace retdec {
 
+/**
+ * LLVM passes run (twice) in the middle of the bin2llvmir pipeline.
+ * This mirrors BIN2LLVMIR_LLVM_PASSES_ONLY from scripts/retdec-config.py.
+ */
+const std::vector<std::string> bin2llvmirLlvmPasses =
+{
+		"instcombine",
+		"tbaa",
+		"basicaa",
+		"simplifycfg",
+		"early-cse",
+		"tbaa",
+		"basicaa",
+		"globalopt",
+		"mem2reg",
+		"instcombine",
+		"simplifycfg",
+		"early-cse",
+		"lazy-value-info",
+		"jump-threading",
+		"correlated-propagation",
+		"simplifycfg",
+		"instcombine",
+		"simplifycfg",
+		"reassociate",
+		"loops",
+		"loop-simplify",
+		"lcssa",
+		"loop-rotate",
+		"licm",
+		"lcssa",
+		"instcombine",
+		"loop-simplifycfg",
+		"loop-simplify",
+		"aa",
+		"loop-accesses",
+		"loop-load-elim",
+		"lcssa",
+		"indvars",
+		"loop-idiom",
+		"loop-deletion",
+		"gvn",
+		"sccp",
+		"instcombine",
+		"lazy-value-info",
+		"jump-threading",
+		"correlated-propagation",
+		"dse",
+		"bdce",
+		"adce",
+		"simplifycfg",
+		"instcombine",
+		"strip-dead-prototypes",
+		"globaldce",
+		"constmerge",
+		"constprop",
+		"instcombine",
+};
+
+/**
+ * Passes run by bin2llvmir in the full decompilation, in this order.
+ * This mirrors BIN2LLVMIR_PARAMS from scripts/retdec-config.py, keep them in
+ * sync. Provider initialization is not listed here -- it is always run first
+ * with the given config.
+ */
+std::vector<std::string> getBin2llvmirPasses()
+{
+	std::vector<std::string> ret =
+	{
+		"decoder",
+		"verify",
+		"x87-fpu",
+		"main-detection",
+		"idioms-libgcc",
+		"inst-opt",
+		"cond-branch-opt",
+		"syscalls",
+		"stack",
+		"constants",
+		"param-return",
+		"local-vars",
+		"inst-opt",
+		"simple-types",
+		"generate-dsm",
+		"remove-asm-instrs",
+		"class-hierarchy",
+		"select-fncs",
+		"unreachable-funcs",
+		"inst-opt",
+		"x86-addr-spaces",
+		"register-localization",
+		"value-protect",
+	};
+
+	ret.insert(ret.end(), bin2llvmirLlvmPasses.begin(), bin2llvmirLlvmPasses.end());
+	ret.insert(ret.end(), bin2llvmirLlvmPasses.begin(), bin2llvmirLlvmPasses.end());
+
+	ret.insert(ret.end(),
+	{
+		"inst-opt",
+		"simple-types",
+		"stack-ptr-op-remove",
+		"idioms",
+		"instcombine",
+		"inst-opt",
+		"idioms",
+		"remove-phi",
+		"value-protect",
+		"sink",
+	});
+
+	return ret;
+}
+
+/**
+ * Call a bunch of LLVM initialization functions, same as the original opt.
+ * LLVM passes are looked up by their names in the pass registry, so it has to
+ * be done before any of them is created.
+ */
+void initializeLlvmPasses()
+{
+	static std::once_flag initialized;
+	std::call_once(initialized, []()
+	{
+		llvm::PassRegistry& registry = *llvm::PassRegistry::getPassRegistry();
+		llvm::initializeCore(registry);
+		llvm::initializeScalarOpts(registry);
+		llvm::initializeIPO(registry);
+		llvm::initializeAnalysis(registry);
+		llvm::initializeTransformUtils(registry);
+		llvm::initializeInstCombine(registry);
+		llvm::initializeTarget(registry);
+	});
+}
+
+/**
+ * Create a pass registered under the given name (e.g. \c "decoder").
+ */
+llvm::Pass* createPass(const std::string& name)
+{
+	auto* pi = llvm::PassRegistry::getPassRegistry()->getPassInfo(name);
+	if (pi == nullptr || pi->getNormalCtor() == nullptr)
+	{
+		throw std::runtime_error("cannot create pass: " + name);
+	}
+	return pi->getNormalCtor()();
+}
+
+/**
+ * Remove all the per-module data held by bin2llvmir providers.
+ */
+void clearProviders()
+{
+	bin2llvmir::AsmInstruction::clear();
+	bin2llvmir::NamesProvider::clear();
+	bin2llvmir::LtiProvider::clear();
+	bin2llvmir::DebugFormatProvider::clear();
+	bin2llvmir::DemanglerProvider::clear();
+	bin2llvmir::AbiProvider::clear();
+	bin2llvmir::FileImageProvider::clear();
+	bin2llvmir::ConfigProvider::clear();
+}
+
 common::BasicBlock fillBasicBlock(
 		bin2llvmir::Config* config,
 		llvm::BasicBlock& bb,
@@ -316,4 +497,107 @@ LlvmModuleContextPair disassemble(
 	return LlvmModuleContextPair{std::move(module), std::move(context)};
 }
 
+bool decompile(
+		retdec::config::Config& config,
+		const retdec::llvmir2hll::LlvmIr2HllParams& params,
+		std::string* outString)
+{
+	initializeLlvmPasses();
+
+	auto context = std::make_unique<llvm::LLVMContext>();
+	auto module = createLlvmModule(*context);
+
+	// Providers are keyed by module -- the module is destroyed at the end of
+	// this function (also when a pass throws), so its data must not outlive
+	// it. Otherwise, a later module allocated at the same address would see
+	// them.
+	SCOPE_EXIT {
+		clearProviders();
+	};
+
+	// bin2llvmir: binary -> LLVM IR.
+	//
+	{
+		llvm::legacy::PassManager pm;
+
+		llvm::TargetLibraryInfoImpl tlii(
+				llvm::Triple(module->getTargetTriple()));
+		tlii.disableAllFunctions();
+		pm.add(new llvm::TargetLibraryInfoWrapperPass(tlii));
+		pm.add(llvm::createTargetTransformInfoWrapperPass(
+				llvm::TargetIRAnalysis()));
+
+		pm.add(new bin2llvmir::ProviderInitialization(&config));
+		for (auto& p : getBin2llvmirPasses())
+		{
+			pm.add(createPass(p));
+		}
+		pm.add(llvm::createVerifierPass());
+
+		pm.run(*module);
+	}
+
+	auto* c = bin2llvmir::ConfigProvider::getConfig(module.get());
+	if (c == nullptr)
+	{
+		return false;
+	}
+	config = c->getConfig();
+
+	// llvmir2hll: LLVM IR -> HLL, on the very same module. The config is
+	// handed over in memory, without a round trip through JSON.
+	//
+	llvm::SmallString<0> buffer;
+	{
+		llvm::raw_svector_ostream os(buffer);
+		std::shared_ptr<llvmir2hll::Config> hllConfig =
+				llvmir2hll::JSONConfig::fromConfig(config);
+
+		llvm::legacy::PassManager pm;
+
+		llvm::TargetLibraryInfoImpl tlii(
+				llvm::Triple(module->getTargetTriple()));
+		pm.add(new llvm::TargetLibraryInfoWrapperPass(tlii));
+		pm.add(new llvm::LoopInfoWrapperPass());
+		pm.add(new llvm::ScalarEvolutionWrapperPass());
+		pm.add(new llvmir2hll::LlvmIr2Hll(os, params, hllConfig));
+
+		pm.run(*module);
+	}
+
+	if (outString)
+	{
+		*outString = buffer.str().str();
+	}
+
+	return true;
+}
+
+bool preloadStaticData(
+		const retdec::config::Config& config,
+		const std::string& dllListFile)
+{
+	// LTI files are parsed with the architecture's bit size. We do not know
+	// what will be decompiled, so prepare both the common variants.
+	ctypesparser::TypeConfig typeConfig;
+	for (unsigned bitSize : {32, 64})
+	{
+		bin2llvmir::Lti::preloadLtiFiles(
+				config.parameters.libraryTypeInfoPaths,
+				bitSize,
+				typeConfig.typeWidths());
+	}
+
+	auto sigPaths = config.parameters.staticSignaturePaths;
+	sigPaths.insert(
+			config.parameters.userStaticSignaturePaths.begin(),
+			config.parameters.userStaticSignaturePaths.end());
+	stacofin::Finder::preloadSignatures(sigPaths);
+
+	cpdetect::CompilerDetector::preloadSignatures();
+
+	return dllListFile.empty()
+			|| fileformat::PeFormat::preloadDllList(dllListFile);
+}
+
 } // namespace retdec
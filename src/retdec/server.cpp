@@ -0,0 +1,286 @@
+/**
+ * @file src/retdec/server.cpp
+ * @brief Decompilation server.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ *
+ * The server loads the data shared by all decompilations only once and then
+ * decompiles inputs on request. Requests are accepted over a local (Unix
+ * domain) socket. Each request is a single line containing a path to the
+ * config of the decompilation (the same config as bin2llvmir gets in
+ * -config-path). The input is taken from the config's input file, the
+ * generated code is written into its output file, and the updated config is
+ * written back. The server answers with "OK" or "ERROR <message>".
+ *
+ * Every decompilation runs in its own forked worker process -- it starts with
+ * the already loaded data, and a crash or a memory blow-up of a single
+ * decompilation does not take down the server.
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "retdec/config/config.h"
+#include "retdec/retdec/retdec.h"
+#include "retdec/retdec/server.h"
+#include "retdec/utils/os.h"
+
+#ifdef OS_POSIX
+	#include <csignal>
+	#include <sys/socket.h>
+	#include <sys/stat.h>
+	#include <sys/types.h>
+	#include <sys/un.h>
+	#include <sys/wait.h>
+	#include <unistd.h>
+#endif
+
+namespace retdec {
+
+namespace {
+
+#ifdef OS_POSIX
+
+/**
+ * Maximal length of a request line.
+ */
+const std::size_t MAX_REQUEST_LENGTH = 4096;
+
+/**
+ * Read a single line from the given socket.
+ * @return @c true if a whole line was read, @c false otherwise.
+ */
+bool readLine(int fd, std::string& line)
+{
+	line.clear();
+
+	char c = 0;
+	while (line.size() < MAX_REQUEST_LENGTH)
+	{
+		auto n = read(fd, &c, 1);
+		if (n <= 0)
+		{
+			return !line.empty();
+		}
+		if (c == '\n')
+		{
+			return true;
+		}
+		line.push_back(c);
+	}
+
+	return false;
+}
+
+/**
+ * Write the whole string into the given socket.
+ */
+void writeString(int fd, const std::string& str)
+{
+	std::size_t written = 0;
+	while (written < str.size())
+	{
+		auto n = write(fd, str.data() + written, str.size() - written);
+		if (n <= 0)
+		{
+			return;
+		}
+		written += n;
+	}
+}
+
+/**
+ * Decompile the input described by the config in @p configPath.
+ * Runs in the worker process.
+ * @return Process exit code.
+ */
+int decompileJob(const std::string& configPath)
+{
+	try
+	{
+		auto config = retdec::config::Config::fromFile(configPath);
+
+		auto outputFile = config.parameters.getOutputFile();
+		if (outputFile.empty())
+		{
+			std::cerr << "Error: no output file in " << configPath << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		// The generated code is only returned, it is written into the output
+		// file here, exactly once.
+		retdec::llvmir2hll::LlvmIr2HllParams params;
+
+		std::string code;
+		if (!retdec::decompile(config, params, &code))
+		{
+			return EXIT_FAILURE;
+		}
+
+		std::ofstream out(outputFile, std::ofstream::out);
+		if (!out)
+		{
+			std::cerr << "Error: cannot open " << outputFile << std::endl;
+			return EXIT_FAILURE;
+		}
+		out << code;
+
+		config.generateJsonFile(configPath);
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "Error: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/**
+ * Handle a single connection. Runs in a process forked for the connection.
+ */
+void handleConnection(int fd)
+{
+	std::string configPath;
+	if (!readLine(fd, configPath) || configPath.empty())
+	{
+		writeString(fd, "ERROR invalid request\n");
+		return;
+	}
+
+	auto pid = fork();
+	if (pid < 0)
+	{
+		writeString(fd, "ERROR fork failed\n");
+		return;
+	}
+	else if (pid == 0)
+	{
+		close(fd);
+		_exit(decompileJob(configPath));
+	}
+
+	int status = 0;
+	if (waitpid(pid, &status, 0) < 0)
+	{
+		writeString(fd, "ERROR waitpid failed\n");
+	}
+	else if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS)
+	{
+		writeString(fd, "OK\n");
+	}
+	else if (WIFSIGNALED(status))
+	{
+		writeString(fd, "ERROR worker killed by signal "
+				+ std::to_string(WTERMSIG(status)) + "\n");
+	}
+	else
+	{
+		writeString(fd, "ERROR decompilation failed\n");
+	}
+}
+
+#endif
+
+} // anonymous namespace
+
+int runServer(
+		const std::string& socketPath,
+		const retdec::config::Config& baseConfig,
+		const std::string& dllListFile)
+{
+#ifdef OS_POSIX
+	if (!retdec::preloadStaticData(baseConfig, dllListFile))
+	{
+		std::cerr << "Error: cannot load DLL list " << dllListFile
+				<< std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Connection handlers are never waited for -- let the kernel reap them.
+	signal(SIGCHLD, SIG_IGN);
+
+	sockaddr_un addr = {};
+	if (socketPath.size() >= sizeof(addr.sun_path))
+	{
+		std::cerr << "Error: socket path is too long" << std::endl;
+		return EXIT_FAILURE;
+	}
+	addr.sun_family = AF_UNIX;
+	socketPath.copy(addr.sun_path, socketPath.size());
+
+	int sfd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sfd < 0)
+	{
+		std::cerr << "Error: cannot create socket" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Only a stale socket (e.g. from a killed server) may be replaced, never
+	// a regular file given by mistake.
+	struct stat st;
+	if (lstat(socketPath.c_str(), &st) == 0)
+	{
+		if (!S_ISSOCK(st.st_mode))
+		{
+			std::cerr << "Error: " << socketPath << " exists and is not a socket"
+					<< std::endl;
+			close(sfd);
+			return EXIT_FAILURE;
+		}
+		unlink(socketPath.c_str());
+	}
+
+	// Whoever can connect makes the server read and write files with its
+	// permissions, so only the owner may connect.
+	auto oldMask = umask(077);
+	int bound = bind(sfd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+	umask(oldMask);
+	if (bound < 0
+			|| chmod(socketPath.c_str(), S_IRUSR | S_IWUSR) < 0
+			|| listen(sfd, SOMAXCONN) < 0)
+	{
+		std::cerr << "Error: cannot listen on " << socketPath << std::endl;
+		close(sfd);
+		return EXIT_FAILURE;
+	}
+
+	while (true)
+	{
+		int cfd = accept(sfd, nullptr, nullptr);
+		if (cfd < 0)
+		{
+			continue;
+		}
+
+		auto pid = fork();
+		if (pid == 0)
+		{
+			close(sfd);
+			// The handler waits for its own worker.
+			signal(SIGCHLD, SIG_DFL);
+			handleConnection(cfd);
+			close(cfd);
+			_exit(EXIT_SUCCESS);
+		}
+		else if (pid < 0)
+		{
+			writeString(cfd, "ERROR fork failed\n");
+		}
+
+		close(cfd);
+	}
+
+	return EXIT_SUCCESS;
+#else
+	(void) socketPath;
+	(void) baseConfig;
+	(void) dllListFile;
+	std::cerr << "Error: server mode is not supported on this platform"
+			<< std::endl;
+	return EXIT_FAILURE;
+#endif
+}
+
+} // namespace retdec
@@ -7,7 +7,9 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "retdec/config/config.h"
 #include "retdec/retdec/retdec.h"
+#include "retdec/retdec/server.h"
 
 class ProgramOptions
 {
@@ -27,6 +29,18 @@ class ProgramOptions
 				{
 					inputFile = getParamOrDie(argc, argv, i);
 				}
+				else if (c == "-s")
+				{
+					socketPath = getParamOrDie(argc, argv, i);
+				}
+				else if (c == "-c")
+				{
+					configPath = getParamOrDie(argc, argv, i);
+				}
+				else if (c == "-d")
+				{
+					dllListFile = getParamOrDie(argc, argv, i);
+				}
 				else if (c == "-h")
 				{
 					printHelpAndDie();
@@ -56,18 +70,30 @@ class ProgramOptions
 			std::cout << std::endl;
 			std::cout << "Program Options:" << std::endl;
 			std::cout << "\t" << "input file : " << inputFile << std::endl;
+			std::cout << "\t" << "socket     : " << socketPath << std::endl;
+			std::cout << "\t" << "config     : " << configPath << std::endl;
+			std::cout << "\t" << "DLL list   : " << dllListFile << std::endl;
 		}
 
 		void printHelpAndDie()
 		{
 			std::cout << _programName << ":\n"
-					<< "\t-i inputFile\n";
+					<< "\t-i inputFile\n"
+					<< "\t-s socketPath  Run as a decompilation server "
+						"listening on the given socket.\n"
+					<< "\t-c configPath  Config with data to preload in "
+						"the server mode (e.g. LTI files).\n"
+					<< "\t-d dllListFile List of present DLLs to preload in "
+						"the server mode.\n";
 
 			exit(EXIT_SUCCESS);
 		}
 
 	public:
 		std::string inputFile;
+		std::string socketPath;
+		std::string configPath;
+		std::string dllListFile;
 
 	private:
 		std::string _programName;
@@ -78,6 +104,24 @@ int main(int argc, char **argv)
 	ProgramOptions po(argc, argv);
 	po.dump();
 
+	if (!po.socketPath.empty())
+	{
+		retdec::config::Config config;
+		if (!po.configPath.empty())
+		{
+			try
+			{
+				config = retdec::config::Config::fromFile(po.configPath);
+			}
+			catch (const std::exception& e)
+			{
+				std::cerr << "Error: " << e.what() << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		return retdec::runServer(po.socketPath, config, po.dllListFile);
+	}
+
 	retdec::common::FunctionSet fs;
 	retdec::disassemble(po.inputFile, &fs);
 
@@ -4,9 +4,12 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 #include "retdec/loader/loader/image.h"
+#include "retdec/loader/utils/pointer_scanner.h"
 #include "retdec/rtti-finder/rtti/rtti_gcc_parser.h"
 #include "retdec/rtti-finder/rtti/rtti_msvc_parser.h"
 #include "retdec/rtti-finder/vtable/vtable_finder.h"
@@ -20,13 +23,30 @@ using namespace retdec::common;
 using namespace retdec::utils;
 using namespace retdec::rtti_finder;
 
+/**
+ * Finds addresses of possible vtables, i.e. of words following two pointers.
+ * The word before the pointers must be zero in @c gcc vtables.
+ *
+ * @param img Scanned image.
+ * @param possibleVtables Into this parameter are stored sorted addresses of
+ *    possible vtables.
+ * @param gcc Whether @c gcc vtables are searched.
+ */
 void findPossibleVtables(
 		const retdec::loader::Image* img,
-		std::set<retdec::common::Address>& possibleVtables,
+		std::vector<retdec::common::Address>& possibleVtables,
 		bool gcc)
 {
-	auto wordSz = img->getBytesPerWord();
+	using retdec::loader::PointerScanner;
+
+	PointerScanner scanner(img);
+	auto wordSz = scanner.getWordSize();
+	if (wordSz == 0)
+	{
+		return;
+	}
 
+	std::vector<std::uint8_t> kinds;
 	for (auto& seg : img->getSegments())
 	{
 		if (seg->getSecSeg() && !seg->getSecSeg()->isSomeData())
@@ -34,37 +54,41 @@ void findPossibleVtables(
 			continue;
 		}
 
-		auto addr = seg->getAddress();
-		auto end = seg->getEndAddress();
-		while (addr + wordSz < end)
-		{
-			std::uint64_t val = 0;
-			if (!img->getWord(addr, val))
-			{
-				addr += wordSz;
-				continue;
-			}
+		scanner.classify(seg.get(), kinds);
 
-			if (gcc && val != 0)
-			{
-				addr += wordSz;
-				continue;
-			}
+		auto start = seg->getAddress();
+		auto end = seg->getEndAddress();
 
-			Address item1 = addr + wordSz;
-			Address item2 = item1 + wordSz;
+		// Words behind the end of the segment are not classified, they may be
+		// in the following segment.
+		auto isPointer = [&](std::size_t i)
+		{
+			return i < kinds.size()
+					? (kinds[i] & PointerScanner::POINTER) != 0
+					: img->isPointer(start + i * wordSz);
+		};
 
-			if (!img->isPointer(item1)
-					|| !img->isPointer(item2))
+		std::size_t i = 0;
+		while (start + i * wordSz + wordSz < end)
+		{
+			if (!(kinds[i] & PointerScanner::READABLE)
+					|| (gcc && !(kinds[i] & PointerScanner::ZERO))
+					|| !isPointer(i + 1)
+					|| !isPointer(i + 2))
 			{
-				addr += wordSz;
+				++i;
 				continue;
 			}
 
-			possibleVtables.insert(item2);
-			addr = item2;
+			possibleVtables.push_back(start + (i + 2) * wordSz);
+			i += 2;
 		}
 	}
+
+	std::sort(possibleVtables.begin(), possibleVtables.end());
+	possibleVtables.erase(
+			std::unique(possibleVtables.begin(), possibleVtables.end()),
+			possibleVtables.end());
 }
 
 /**
@@ -147,7 +171,7 @@ void retdec::rtti_finder::findGccVtables(
 		retdec::rtti_finder::VtablesGcc& vtables,
 		retdec::rtti_finder::RttiGcc& rttis)
 {
-	std::set<retdec::common::Address> possibleVtables;
+	std::vector<retdec::common::Address> possibleVtables;
 	findPossibleVtables(img, possibleVtables, true);
 
 	std::set<retdec::common::Address> processedAddresses;
@@ -197,7 +221,7 @@ void retdec::rtti_finder::findMsvcVtables(
 		retdec::rtti_finder::VtablesMsvc& vtables,
 		retdec::rtti_finder::RttiMsvc& rttis)
 {
-	std::set<retdec::common::Address> possibleVtables;
+	std::vector<retdec::common::Address> possibleVtables;
 	findPossibleVtables(img, possibleVtables, false);
 
 	std::set<retdec::common::Address> processedAddresses;
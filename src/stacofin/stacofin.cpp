@@ -595,18 +595,119 @@ void Finder::search(
 	const Image& image,
 	const std::string& yaraFile)
 {
-	// Get FileFormat instance.
+	search(image, std::set<std::string>{yaraFile});
+}
+
+/**
+ * Search for static code in input file.
+ *
+ * Precompiled signature files are scanned one by one. All the other signature
+ * files are compiled into a single rule set (each file into its own
+ * namespace), so the input is scanned only once for all of them. If
+ * @a cacheDirectory is not empty, the compiled rule set is stored there and
+ * it is loaded instead of compiling the same signature files again.
+ *
+ * @param image input file image
+ * @param yaraFiles static code signature files
+ * @param cacheDirectory existing directory with cached compiled signatures
+ */
+void Finder::search(
+	const retdec::loader::Image& image,
+	const std::set<std::string>& yaraFiles,
+	const std::string& cacheDirectory)
+{
 	const auto* fileFormat = image.getFileFormat();
 	if (!fileFormat)
 	{
 		return;
 	}
 
-	// Start Yara detector.
+	// Rules in precompiled signature files do not carry the path of the file
+	// in their namespace, so these files are scanned one by one.
+	//
+	std::vector<std::pair<std::string, std::string>> textFiles;
+	for (const auto& f : yaraFiles)
+	{
+		if (YaraDetector::isPrecompiledRuleFile(f))
+		{
+			YaraDetector detector;
+			if (detector.addRuleFiles({{f, f}}))
+			{
+				search(fileFormat, detector, f);
+			}
+		}
+		else
+		{
+			textFiles.emplace_back(f, f);
+		}
+	}
+	if (textFiles.empty())
+	{
+		return;
+	}
+
 	YaraDetector detector;
-	detector.addRuleFile(yaraFile);
-	auto inputBytes = fileFormat->getLoadedBytes();
-	detector.analyze(inputBytes);
+	detector.addRuleFiles(textFiles, cacheDirectory);
+	search(fileFormat, detector);
+}
+
+/**
+ * Search for static code in input file based on information in config file.
+ *
+ * @param image input file image
+ * @param config config file
+ */
+void Finder::search(
+	const retdec::loader::Image& image,
+	const retdec::config::Config& config)
+{
+	auto sigPaths = selectSignaturePaths(image, config);
+	search(
+			image,
+			sigPaths,
+			config.parameters.getStaticSignaturesCacheDirectory());
+}
+
+/**
+ * Load precompiled signature files into the process-wide cache of compiled
+ * rules, so that searches run later in this process (or in processes forked
+ * from it) do not load them again.
+ *
+ * Text signature files are not compiled here. They are compiled into one rule
+ * set per selection of files made for the input file, which is not known in
+ * advance. Such rule sets are cached by the search itself.
+ *
+ * @param yaraFiles static code signature files
+ */
+void Finder::preloadSignatures(const std::set<std::string>& yaraFiles)
+{
+	for (const auto& f : yaraFiles)
+	{
+		if (YaraDetector::isPrecompiledRuleFile(f))
+		{
+			YaraDetector detector;
+			detector.addRuleFiles({{f, f}});
+		}
+	}
+}
+
+/**
+ * Scan loaded bytes of input file with the given detector and collect
+ * detected functions.
+ *
+ * @param fileFormat input file
+ * @param detector detector with added signatures
+ * @param signaturePath path of the signature file of all the rules, if empty,
+ *                      namespace of each rule is used
+ */
+void Finder::search(
+	const retdec::fileformat::FileFormat* fileFormat,
+	YaraDetector& detector,
+	const std::string& signaturePath)
+{
+	// Scan bytes of the file in place.
+	const auto inputBytes = fileFormat->getLoadedBytes();
+	detector.analyze(inputBytes.data(), inputBytes.size());
 	if (!detector.isInValidState())
 	{
 		return;
@@ -616,7 +717,9 @@ void Finder::search(
 	for (const YaraRule &detectedRule : detector.getDetectedRules())
 	{
 		DetectedFunction detectedFunction;
-		detectedFunction.signaturePath = yaraFile;
+		detectedFunction.signaturePath = signaturePath.empty()
+				? detectedRule.getNamespace()
+				: signaturePath;
 
 		for (const YaraMeta &ruleMeta : detectedRule.getMetas())
 		{
@@ -669,36 +772,6 @@ void Finder::search(
 	}
 }
 
-/**
- * Search for static code in input file.
- *
- * @param image input file image
- * @param yaraFiles static code signature files
- */
-void Finder::search(
-	const retdec::loader::Image& image,
-	const std::set<std::string>& yaraFiles)
-{
-	for (const auto& f : yaraFiles)
-	{
-		search(image, f);
-	}
-}
-
-/**
- * Search for static code in input file based on information in config file.
- *
- * @param image input file image
- * @param config config file
- */
-void Finder::search(
-	const retdec::loader::Image& image,
-	const retdec::config::Config& config)
-{
-	auto sigPaths = selectSignaturePaths(image, config);
-	search(image, sigPaths);
-}
-
 void Finder::searchAndConfirm(
 		const retdec::loader::Image& image,
 		const retdec::config::Config& config)
@@ -73,6 +73,16 @@ uint64_t Signature::getCaptureSize() const
 	return count;
 }
 
+/**
+ * Returns the bytes of the signature.
+ *
+ * @return Signature bytes.
+ */
+const std::vector<Signature::Byte>& Signature::getBytes() const
+{
+	return _buffer;
+}
+
 /**
  * Matches the signature against the file using the specified settings. Matching is being done on section or segment which contains entry point.
  *
@@ -0,0 +1,253 @@
+/**
+ * @file src/unpacker/signature_matcher.cpp
+ * @brief Implementation of class for matching multiple signatures at once.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "retdec/unpacker/signature_matcher.h"
+
+using namespace retdec::utils;
+
+namespace retdec {
+namespace unpacker {
+
+namespace {
+
+/**
+ * Returns the sum of two numbers, or the maximum value if the sum overflows.
+ */
+uint64_t saturatingAdd(uint64_t a, uint64_t b)
+{
+	return b > std::numeric_limits<uint64_t>::max() - a ? std::numeric_limits<uint64_t>::max() : a + b;
+}
+
+/**
+ * Returns whether the signature byte matches only a single value.
+ */
+bool isExact(const Signature::Byte& byte)
+{
+	return byte.getWildcardMask() == 0;
+}
+
+/**
+ * Returns the key of the anchor made of the two given bytes.
+ */
+uint16_t getAnchorKey(uint8_t first, uint8_t second)
+{
+	return static_cast<uint16_t>(first << 8 | second);
+}
+
+} // anonymous namespace
+
+/**
+ * Adds the signature to the set of matched signatures. The signature is not copied, so it must outlive the matcher.
+ *
+ * @param signature Signature to add.
+ * @param searchDistance Maximum searching distance for the signature, see Signature::MatchSettings. If it is
+ *   std::numeric_limits<uint64_t>::max(), the signature is searched in all the remaining data.
+ *
+ * @return ID of the added signature.
+ */
+std::size_t SignatureMatcher::addSignature(const Signature* signature, uint64_t searchDistance /*= 0*/)
+{
+	Entry entry = { signature, searchDistance, 0, false };
+
+	const auto& bytes = signature->getBytes();
+	for (uint64_t i = 0; i + 1 < bytes.size(); ++i)
+	{
+		if (isExact(bytes[i]) && isExact(bytes[i + 1]))
+		{
+			entry.anchorOffset = i;
+			entry.hasAnchor = true;
+			break;
+		}
+	}
+
+	std::size_t id = _entries.size();
+	if (entry.hasAnchor)
+	{
+		const auto key = getAnchorKey(bytes[entry.anchorOffset].getExpectedValue(), bytes[entry.anchorOffset + 1].getExpectedValue());
+		_anchors[key].push_back({ id, entry.anchorOffset });
+	}
+	else
+		_unanchored.push_back(id);
+
+	_scanLength = std::max(_scanLength, saturatingAdd(entry.anchorOffset, getNumberOfStarts(entry)));
+	_maxMatchLength = std::max(_maxMatchLength, saturatingAdd(signature->getSize(), searchDistance));
+	_entries.push_back(entry);
+	return id;
+}
+
+/**
+ * Returns the number of added signatures.
+ *
+ * @return Number of signatures.
+ */
+std::size_t SignatureMatcher::getNumberOfSignatures() const
+{
+	return _entries.size();
+}
+
+/**
+ * Matches all signatures against the file at the specified offset in the section or segment which contains entry point.
+ *
+ * @param offset Offset in the entry point section or segment where to start matching.
+ * @param file Input file.
+ * @param id ID of the first matched signature.
+ * @param capturedData Buffer where to capture the capture bytes of the matched signature.
+ * @param filter Filter of signatures to match. All signatures are matched if it is empty.
+ *
+ * @return True if any signature matched successfuly, otherwise false.
+ */
+bool SignatureMatcher::match(uint64_t offset, retdec::loader::Image* file, std::size_t& id, DynamicBuffer& capturedData,
+		const Filter& filter /*= Filter()*/) const
+{
+	const retdec::loader::Segment* seg = file->getEpSegment();
+	if (seg == nullptr || offset >= seg->getSize())
+		return false;
+
+	// All the signatures are matched in the same data, so they are read only once.
+	std::vector<uint8_t> bytesToMatch;
+	seg->getBytes(bytesToMatch, offset, std::min(_maxMatchLength, seg->getSize() - offset));
+	return match(0, bytesToMatch, id, capturedData, filter);
+}
+
+/**
+ * Matches all signatures against the data buffer at the specified offset.
+ *
+ * @param offset Offset in the data buffer where to start matching.
+ * @param data Input data buffer.
+ * @param id ID of the first matched signature.
+ * @param capturedData Buffer where to capture the capture bytes of the matched signature.
+ * @param filter Filter of signatures to match. All signatures are matched if it is empty.
+ *
+ * @return True if any signature matched successfuly, otherwise false.
+ */
+bool SignatureMatcher::match(uint64_t offset, const DynamicBuffer& data, std::size_t& id, DynamicBuffer& capturedData,
+		const Filter& filter /*= Filter()*/) const
+{
+	return match(offset, data.getBuffer(), id, capturedData, filter);
+}
+
+/**
+ * Matches all signatures against the bytes at the specified offset.
+ *
+ * @param offset Offset in the bytes where to start matching.
+ * @param data Input bytes.
+ * @param id ID of the first matched signature.
+ * @param capturedData Buffer where to capture the capture bytes of the matched signature.
+ * @param filter Filter of signatures to match. All signatures are matched if it is empty.
+ *
+ * @return True if any signature matched successfuly, otherwise false.
+ */
+bool SignatureMatcher::match(uint64_t offset, const std::vector<uint8_t>& data, std::size_t& id, DynamicBuffer& capturedData,
+		const Filter& filter /*= Filter()*/) const
+{
+	std::size_t bestId = _entries.size();
+	uint64_t bestStart = 0;
+
+	// Single scan over the positions of anchors of all signatures. Anchors of each key are ordered by IDs,
+	// so the first match for a key is also the best one at the position.
+	for (uint64_t pos = offset; pos < data.size() && data.size() - pos >= 2 && pos - offset < _scanLength && bestId != 0; ++pos)
+	{
+		auto itr = _anchors.find(getAnchorKey(data[pos], data[pos + 1]));
+		if (itr == _anchors.end())
+			continue;
+
+		for (const auto& anchor : itr->second)
+		{
+			if (anchor.id >= bestId)
+				break;
+
+			const auto& entry = _entries[anchor.id];
+			if (pos - offset < anchor.offset || pos - offset - anchor.offset >= getNumberOfStarts(entry))
+				continue;
+
+			if (filter && !filter(anchor.id))
+				continue;
+
+			uint64_t start = pos - anchor.offset;
+			if (matchAt(entry, data, start))
+			{
+				bestId = anchor.id;
+				bestStart = start;
+				break;
+			}
+		}
+	}
+
+	for (auto unanchoredId : _unanchored)
+	{
+		if (unanchoredId >= bestId)
+			break;
+
+		if (filter && !filter(unanchoredId))
+			continue;
+
+		const auto& entry = _entries[unanchoredId];
+		for (uint64_t start = offset; start < data.size() && start - offset < getNumberOfStarts(entry); ++start)
+		{
+			if (matchAt(entry, data, start))
+			{
+				bestId = unanchoredId;
+				bestStart = start;
+				break;
+			}
+		}
+	}
+
+	if (bestId == _entries.size())
+		return false;
+
+	id = bestId;
+	capture(_entries[bestId], data, bestStart, capturedData);
+	return true;
+}
+
+/**
+ * Returns the number of positions where the signature can start.
+ */
+uint64_t SignatureMatcher::getNumberOfStarts(const Entry& entry)
+{
+	return entry.searchDistance > 0 ? entry.searchDistance : 1;
+}
+
+/**
+ * Returns whether the whole signature matches the data at the specified position.
+ */
+bool SignatureMatcher::matchAt(const Entry& entry, const std::vector<uint8_t>& data, uint64_t start)
+{
+	const auto& bytes = entry.signature->getBytes();
+	if (start > data.size() || data.size() - start < bytes.size())
+		return false;
+
+	for (uint64_t i = 0; i < bytes.size(); ++i)
+	{
+		if (bytes[i] != data[start + i])
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * Puts the bytes matched by the capture bytes of the signature into the capture buffer.
+ */
+void SignatureMatcher::capture(const Entry& entry, const std::vector<uint8_t>& data, uint64_t start, DynamicBuffer& capturedData)
+{
+	capturedData.setCapacity(entry.signature->getCaptureSize());
+
+	const auto& bytes = entry.signature->getBytes();
+	uint64_t captureWritePos = 0;
+	for (uint64_t i = 0; i < bytes.size(); ++i)
+	{
+		if (bytes[i].getType() == Signature::Byte::Type::CAPTURE)
+			capturedData.write<uint8_t>(data[start + i], captureWritePos++);
+	}
+}
+
+} // namespace unpacker
+} // namespace retdec
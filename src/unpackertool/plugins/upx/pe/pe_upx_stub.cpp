@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 
 #include "retdec/pelib/PeLib.h"
 #include "retdec/utils/alignment.h"
@@ -143,6 +144,21 @@ std::vector<UnfilterSignatureData> unfilterSignatures =
 	{ &x64Unfilter49Signature,    FILTER_49 }
 };
 
+/**
+ * Returns the matcher of all unfilter signatures. They are searched in the whole rest of the unpacking stub and
+ * their IDs are their indexes in @ref unfilterSignatures.
+ */
+const SignatureMatcher& getUnfilterMatcher()
+{
+	static const SignatureMatcher matcher = []() {
+		SignatureMatcher result;
+		for (const auto& unfilterSignature : unfilterSignatures)
+			result.addSignature(unfilterSignature.signature, std::numeric_limits<std::uint64_t>::max());
+		return result;
+	}();
+	return matcher;
+}
+
 } // anonymous namespace
 
 /**
@@ -347,16 +363,12 @@ template <int bits> void PeUpxStub<bits>::detectUnfilter(const DynamicBuffer& un
 
 	std::string detectionBasedOn = "signature";
 	DynamicBuffer unfilterCapturedData(_file->getFileFormat()->getEndianness());
-	Signature::MatchSettings settings(matchStartOffset, unpackingStub.getRealDataSize());
-	for (const auto& unfilterSignature : unfilterSignatures)
+	std::size_t id;
+	if (getUnfilterMatcher().match(matchStartOffset, unpackingStub, id, unfilterCapturedData))
 	{
-		if (!unfilterSignature.signature->match(settings, unpackingStub, unfilterCapturedData))
-			continue;
-
-		_filterId = unfilterSignature.filterId;
+		_filterId = unfilterSignatures[id].filterId;
 		_filterCount = unfilterCapturedData.read<std::uint32_t>(0);
 		_filterParam = unfilterCapturedData.read<std::uint8_t>(4);
-		break;
 	}
 
 	// Detect filter based on metadata if we have one, but trust only if no signature was matched
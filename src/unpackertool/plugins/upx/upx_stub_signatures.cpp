@@ -1751,21 +1751,16 @@ const UpxStubData* UpxStubSignatures::matchSignatures(Image* file, DynamicBuffer
 	file->getFileFormat()->getEpAddress(ep);
 	ep -= epSeg->getAddress();
 
-	for (const UpxStubData& stubData : allStubs)
-	{
-		if (stubData.architecture != architecture || stubData.format != format)
-			continue;
-
-		Signature::MatchSettings settings(ep, stubData.searchDistance);
-		DynamicBuffer localCaptureData(file->getFileFormat()->getEndianness());
-		if (stubData.signature->match(settings, file, localCaptureData))
-		{
-			captureData = localCaptureData;
-			return &stubData;
-		}
-	}
-
-	return nullptr;
+	std::size_t id;
+	DynamicBuffer localCaptureData(file->getFileFormat()->getEndianness());
+	auto filter = [architecture, format](std::size_t stubId) {
+		return allStubs[stubId].architecture == architecture && allStubs[stubId].format == format;
+	};
+	if (!getMatcher().match(ep, file, id, localCaptureData, filter))
+		return nullptr;
+
+	captureData = localCaptureData;
+	return &allStubs[id];
 }
 
 /**
@@ -1783,22 +1778,34 @@ const UpxStubData* UpxStubSignatures::matchSignatures(Image* file, DynamicBuffer
 const UpxStubData* UpxStubSignatures::matchSignatures(const DynamicBuffer& data, DynamicBuffer& captureData,
 		retdec::fileformat::Architecture architecture /*= Architecture::UNKNOWN*/, retdec::fileformat::Format format /*= Format::UNKNOWN*/)
 {
-	for (const UpxStubData& stubData : allStubs)
-	{
-		if ((architecture != Architecture::UNKNOWN && stubData.architecture != architecture)
-				|| (format != Format::UNKNOWN && stubData.format != format))
-			continue;
-
-		Signature::MatchSettings settings(0, stubData.searchDistance);
-		DynamicBuffer localCaptureData(data.getEndianness());
-		if (stubData.signature->match(settings, data, localCaptureData))
-		{
-			captureData = localCaptureData;
-			return &stubData;
-		}
-	}
-
-	return nullptr;
+	std::size_t id;
+	DynamicBuffer localCaptureData(data.getEndianness());
+	auto filter = [architecture, format](std::size_t stubId) {
+		return (architecture == Architecture::UNKNOWN || allStubs[stubId].architecture == architecture)
+			&& (format == Format::UNKNOWN || allStubs[stubId].format == format);
+	};
+	if (!getMatcher().match(0, data, id, localCaptureData, filter))
+		return nullptr;
+
+	captureData = localCaptureData;
+	return &allStubs[id];
+}
+
+/**
+ * Returns the matcher of all supported signatures. The IDs of signatures in the matcher are their indexes
+ * in @ref allStubs, so the stubs are matched in the same order as they are listed.
+ *
+ * @return Matcher of all supported signatures.
+ */
+const SignatureMatcher& UpxStubSignatures::getMatcher()
+{
+	static const SignatureMatcher matcher = []() {
+		SignatureMatcher result;
+		for (const UpxStubData& stubData : allStubs)
+			result.addSignature(stubData.signature, stubData.searchDistance);
+		return result;
+	}();
+	return matcher;
 }
 
 } // namespace upx
@@ -11,6 +11,7 @@
 #include "retdec/loader/loader.h"
 #include "unpackertool/plugins/upx/upx_stub.h"
 #include "retdec/unpacker/signature.h"
+#include "retdec/unpacker/signature_matcher.h"
 
 using namespace retdec::utils;
 
@@ -62,6 +63,8 @@ public:
 private:
 	UpxStubSignatures& operator =(const UpxStubSignatures&);
 
+	static const retdec::unpacker::SignatureMatcher& getMatcher();
+
 	static std::vector<UpxStubData> allStubs; ///< All supported unpacking stubs.
 };
 
@@ -0,0 +1,192 @@
+/**
+* @file src/utils/memory_mapped_file.cpp
+* @brief Private memory mapping of a file.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/utils/memory_mapped_file.h"
+#include "retdec/utils/os.h"
+
+#ifdef OS_WINDOWS
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace retdec {
+namespace utils {
+
+namespace {
+
+#ifdef OS_WINDOWS
+
+/**
+* @brief Implementation of @c MemoryMappedFile::open() on Windows.
+*/
+bool mapFileOnWindows(const std::string &path, std::uint8_t *&data,
+		std::size_t &size) {
+	HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+		nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!::GetFileSizeEx(file, &fileSize)) {
+		::CloseHandle(file);
+		return false;
+	}
+
+	size = static_cast<std::size_t>(fileSize.QuadPart);
+	if (size == 0) {
+		::CloseHandle(file);
+		data = nullptr;
+		return true;
+	}
+
+	HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0,
+		nullptr);
+	::CloseHandle(file);
+	if (!mapping) {
+		return false;
+	}
+
+	// The view keeps the mapping alive after its handle is closed.
+	void *view = ::MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+	::CloseHandle(mapping);
+	if (!view) {
+		return false;
+	}
+
+	data = static_cast<std::uint8_t *>(view);
+	return true;
+}
+
+#else
+
+/**
+* @brief Implementation of @c MemoryMappedFile::open() on POSIX-compliant
+*        systems.
+*/
+bool mapFileOnPOSIX(const std::string &path, std::uint8_t *&data,
+		std::size_t &size) {
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	// Only regular files can be mapped, the caller has to read the others.
+	struct stat st;
+	if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+		::close(fd);
+		return false;
+	}
+
+	size = static_cast<std::size_t>(st.st_size);
+	if (size == 0) {
+		::close(fd);
+		data = nullptr;
+		return true;
+	}
+
+	// The mapping stays valid after the descriptor is closed.
+	void *addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+		fd, 0);
+	::close(fd);
+	if (addr == MAP_FAILED) {
+		return false;
+	}
+
+	data = static_cast<std::uint8_t *>(addr);
+	return true;
+}
+
+#endif
+
+} // anonymous namespace
+
+/**
+* @brief Maps the file at the given path.
+*
+* Use isOpen() to check whether the mapping succeeded.
+*/
+MemoryMappedFile::MemoryMappedFile(const std::string &path) {
+	open(path);
+}
+
+/**
+* @brief Unmaps the file.
+*/
+MemoryMappedFile::~MemoryMappedFile() {
+	close();
+}
+
+/**
+* @brief Maps the file at the given path, unmapping the previous one.
+*
+* @return @c true if the file was mapped, @c false otherwise (e.g. when the
+*         file does not exist or it is not a regular file).
+*/
+bool MemoryMappedFile::open(const std::string &path) {
+	close();
+
+	std::uint8_t *newData = nullptr;
+	std::size_t newSize = 0;
+	#ifdef OS_WINDOWS
+		opened = mapFileOnWindows(path, newData, newSize);
+	#else
+		opened = mapFileOnPOSIX(path, newData, newSize);
+	#endif
+
+	if (opened) {
+		data = newData;
+		size = newSize;
+	}
+	return opened;
+}
+
+/**
+* @brief Unmaps the file. Pointers to its data are no longer valid.
+*/
+void MemoryMappedFile::close() {
+	if (data) {
+		#ifdef OS_WINDOWS
+			::UnmapViewOfFile(data);
+		#else
+			::munmap(data, size);
+		#endif
+	}
+
+	data = nullptr;
+	size = 0;
+	opened = false;
+}
+
+/**
+* @brief Returns @c true if a file is mapped, @c false otherwise.
+*/
+bool MemoryMappedFile::isOpen() const {
+	return opened;
+}
+
+/**
+* @brief Returns the mapped content of the file.
+*
+* Returns @c nullptr if no file is mapped or the file is empty.
+*/
+std::uint8_t *MemoryMappedFile::getData() const {
+	return data;
+}
+
+/**
+* @brief Returns the size of the mapped file.
+*/
+std::size_t MemoryMappedFile::getSize() const {
+	return size;
+}
+
+} // namespace utils
+} // namespace retdec
@@ -0,0 +1,97 @@
+/**
+* @file src/utils/thread_pool.cpp
+* @brief Implementation of the pool of worker threads.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/utils/thread_pool.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Creates a pool with the given number of worker threads.
+*
+* @param[in] numOfThreads Number of worker threads. If it is zero, the result
+*                         of getDefaultNumOfThreads() is used.
+*/
+ThreadPool::ThreadPool(std::size_t numOfThreads) {
+	if (numOfThreads == 0) {
+		numOfThreads = getDefaultNumOfThreads();
+	}
+
+	workers.reserve(numOfThreads);
+	for (std::size_t i = 0; i < numOfThreads; ++i) {
+		workers.emplace_back(&ThreadPool::runWorker, this);
+	}
+}
+
+/**
+* @brief Finishes all the submitted tasks and destroys the pool.
+*/
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(tasksMutex);
+		stopping = true;
+	}
+	tasksCondition.notify_all();
+
+	for (auto &worker : workers) {
+		worker.join();
+	}
+}
+
+/**
+* @brief Returns the number of worker threads in the pool.
+*/
+std::size_t ThreadPool::getNumOfThreads() const {
+	return workers.size();
+}
+
+/**
+* @brief Returns the number of threads the hardware can run concurrently.
+*
+* If the number cannot be determined, 1 is returned.
+*/
+std::size_t ThreadPool::getDefaultNumOfThreads() {
+	auto n = std::thread::hardware_concurrency();
+	return n > 0 ? n : 1;
+}
+
+/**
+* @brief Adds the given task into the queue and wakes up a worker.
+*/
+void ThreadPool::enqueue(std::function<void ()> task) {
+	{
+		std::lock_guard<std::mutex> lock(tasksMutex);
+		tasks.push(std::move(task));
+	}
+	tasksCondition.notify_one();
+}
+
+/**
+* @brief Main loop of a worker thread.
+*/
+void ThreadPool::runWorker() {
+	while (true) {
+		std::function<void ()> task;
+		{
+			std::unique_lock<std::mutex> lock(tasksMutex);
+			tasksCondition.wait(lock, [this]() {
+				return stopping || !tasks.empty();
+			});
+			if (tasks.empty()) {
+				// The pool is stopping and there is nothing left to do.
+				return;
+			}
+			task = std::move(tasks.front());
+			tasks.pop();
+		}
+		// Exceptions are stored in the future of the task by
+		// std::packaged_task, so the task never throws.
+		task();
+	}
+}
+
+} // namespace utils
+} // namespace retdec
@@ -20,6 +20,15 @@ const std::string &YaraRule::getName() const
 	return name;
 }
 
+/**
+ * Get namespace of this rule
+ * @return Namespace of rule
+ */
+const std::string &YaraRule::getNamespace() const
+{
+	return nameSpace;
+}
+
 /**
  * Get selected meta related to this rule
  * @param id Name of selected meta
@@ -131,6 +140,15 @@ void YaraRule::setName(const std::string &ruleName)
 	name = ruleName;
 }
 
+/**
+ * Set namespace of rule
+ * @param ruleNamespace Namespace of rule
+ */
+void YaraRule::setNamespace(const std::string &ruleNamespace)
+{
+	nameSpace = ruleNamespace;
+}
+
 /**
  * Add meta
  * @param meta Meta related to this rule
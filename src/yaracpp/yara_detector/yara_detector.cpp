@@ -4,6 +4,13 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <random>
+
 #include <yara.h>
 
 #include "retdec/yaracpp/yara_detector/yara_detector.h"
@@ -45,6 +52,18 @@ struct Scanner<std::vector<std::uint8_t>>
 	}
 };
 
+/**
+ * Specialization for scanning memory buffers owned by someone else.
+ */
+template <>
+struct Scanner<std::pair<const std::uint8_t*, std::size_t>>
+{
+	static bool scan(YR_RULES* rules, YR_CALLBACK_FUNC callback, YaraDetector::CallbackSettings& settings, const std::pair<const std::uint8_t*, std::size_t>& buffer)
+	{
+		return yr_rules_scan_mem(rules, const_cast<uint8_t*>(buffer.first), buffer.second, 0, callback, &settings, 0) == ERROR_SUCCESS;
+	}
+};
+
 /**
  * Interface for Scanner. Provides template type deduction and
  * always passes correct type into Scanner template.
@@ -55,13 +74,190 @@ bool scan(YR_RULES* rules, YR_CALLBACK_FUNC callback, YaraDetector::CallbackSett
 	return Scanner<std::decay_t<T>>::scan(rules, callback, settings, std::forward<T>(value));
 }
 
+/**
+ * Compiled rules shared by all detectors in the process.
+ *
+ * Scanning does not modify the rules, so one compiled rule set can be used
+ * by any number of detectors, even from different threads (up to the limit of
+ * concurrent scans of libyara). Rule sets are kept until the end of the
+ * process, so libyara stays initialized for them.
+ */
+class SharedRulesCache
+{
+	public:
+		SharedRulesCache()
+		{
+			yr_initialize();
+		}
+
+		YR_RULES* get(std::uint64_t key)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			auto it = rules.find(key);
+			return it != rules.end() ? it->second : nullptr;
+		}
+
+		/**
+		 * Add rules under the given key. If another thread has added rules
+		 * with the same key meanwhile, @p newRules are destroyed and the
+		 * already added rules are returned.
+		 */
+		YR_RULES* add(std::uint64_t key, YR_RULES* newRules)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			auto result = rules.emplace(key, newRules);
+			if (!result.second)
+			{
+				yr_rules_destroy(newRules);
+			}
+			return result.first->second;
+		}
+
+	private:
+		std::mutex mutex;
+		std::unordered_map<std::uint64_t, YR_RULES*> rules;
+};
+
+/**
+ * Get the process-wide cache of compiled rules.
+ */
+SharedRulesCache& getSharedRulesCache()
+{
+	// Intentionally never destroyed, detectors may outlive static objects.
+	static auto* cache = new SharedRulesCache();
+	return *cache;
+}
+
+/**
+ * FNV-1a hash, which is stable across platforms and runs.
+ */
+class RulesHash
+{
+	public:
+		RulesHash()
+		{
+			add(YR_VERSION, sizeof(YR_VERSION));
+		}
+
+		void add(const char* data, std::size_t size)
+		{
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				hash ^= static_cast<unsigned char>(data[i]);
+				hash *= 0x100000001b3;
+			}
+		}
+
+		void add(const std::string& str)
+		{
+			// Include the terminating null character, so that consecutive
+			// strings cannot be confused.
+			add(str.c_str(), str.size() + 1);
+		}
+
+		std::uint64_t get() const
+		{
+			return hash;
+		}
+
+	private:
+		std::uint64_t hash = 0xcbf29ce484222325;
+};
+
+/**
+ * Read the whole content of the given file.
+ */
+bool readContent(const std::string& pathToFile, std::string& content)
+{
+	std::ifstream file(pathToFile, std::ios::in | std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+
+	content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return !file.bad();
+}
+
+/**
+ * Check whether the given file content are rules precompiled by libyara.
+ */
+bool isPrecompiled(const std::string& content)
+{
+	return content.compare(0, 4, "YARA") == 0;
+}
+
+/**
+ * Compile the given text rule files by a fresh compiler into a single rule set.
+ * @return Compiled rules or @c nullptr if any of the files cannot be compiled.
+ */
+template <typename It>
+YR_RULES* compileRuleFiles(It first, It last)
+{
+	YR_COMPILER* compiler = nullptr;
+	if (yr_compiler_create(&compiler) != ERROR_SUCCESS)
+	{
+		return nullptr;
+	}
+
+	auto compiled = true;
+	for (auto it = first; compiled && it != last; ++it)
+	{
+		const auto& ruleFile = **it;
+		auto file = fopen(ruleFile.first.c_str(), "r");
+		const char* ns = ruleFile.second.empty() ? nullptr : ruleFile.second.c_str();
+		compiled = file && yr_compiler_add_file(compiler, file, ns, nullptr) == 0;
+		if (file)
+			fclose(file);
+	}
+
+	YR_RULES* rules = nullptr;
+	if (compiled && yr_compiler_get_rules(compiler, &rules) != ERROR_SUCCESS)
+	{
+		rules = nullptr;
+	}
+	yr_compiler_destroy(compiler);
+	return rules;
+}
+
+/**
+ * Get path to the cached compiled rules with the given key.
+ */
+std::string getCachePath(const std::string& cacheDirectory, std::uint64_t key)
+{
+	char name[32];
+	std::snprintf(name, sizeof(name), "yara-%016llx.yarac", static_cast<unsigned long long>(key));
+
+	auto path = cacheDirectory;
+	if (!path.empty() && path.back() != '/' && path.back() != '\\')
+	{
+		path += '/';
+	}
+	return path + name;
+}
+
+/**
+ * Save compiled rules into the cache. Rules are written into a temporary
+ * file which is then renamed, so concurrent processes never load a partially
+ * written file.
+ */
+void saveToCache(YR_RULES* rules, const std::string& cachePath)
+{
+	auto tmpPath = cachePath + ".tmp" + std::to_string(std::random_device()());
+	if (yr_rules_save(rules, tmpPath.c_str()) != ERROR_SUCCESS
+			|| std::rename(tmpPath.c_str(), cachePath.c_str()) != 0)
+	{
+		std::remove(tmpPath.c_str());
+	}
+}
+
 }
 
 /**
  * Constructor
  */
 YaraDetector::YaraDetector() : compiler(nullptr), files(), detectedRules(), undetectedRules(), textFilesRules(nullptr),
-	precompiledRules(), stateIsValid(true), needsRecompilation(true)
+	precompiledRules(), sharedRules(), stateIsValid(true), needsRecompilation(true), hasTextRules(false)
 {
 	stateIsValid = ((yr_initialize() == ERROR_SUCCESS) && (yr_compiler_create(&compiler) == ERROR_SUCCESS));
 	std::uint32_t max_match_data = 65536;
@@ -190,6 +386,10 @@ int YaraDetector::yaraCallback(int message, void *messageData, void *userData)
 
 	YaraRule actual;
 	actual.setName(actRule->identifier);
+	if(actRule->ns && actRule->ns->name)
+	{
+		actual.setNamespace(actRule->ns->name);
+	}
 	YR_META *meta;
 	yr_rule_metas_foreach(actRule, meta)
 	{
@@ -249,6 +449,7 @@ bool YaraDetector::addRules(const char *string)
 {
 	const auto result = yr_compiler_add_string(compiler, string, nullptr);
 
+	hasTextRules = true;
 	needsRecompilation = (result == 0);
 	return needsRecompilation;
 }
@@ -284,12 +485,172 @@ bool YaraDetector::addRuleFile(const std::string &pathToFile, const std::string
 		}
 
 		files.push_back(file);
+		hasTextRules = true;
 		needsRecompilation = true;
 	}
 
 	return true;
 }
 
+/**
+ * Add external file with precompiled rules
+ * @param pathToFile Path to rule file
+ * @return @c true if file was loaded, @c false if it does not exist or it does
+ *    not contain rules precompiled by the used version of YARA
+ */
+bool YaraDetector::addPrecompiledRuleFile(const std::string &pathToFile)
+{
+	YR_RULES* rules = nullptr;
+	if (yr_rules_load(pathToFile.c_str(), &rules) != ERROR_SUCCESS)
+	{
+		return false;
+	}
+
+	precompiledRules.push_back(rules);
+	return true;
+}
+
+/**
+ * Check whether the given file contains rules precompiled by libyara
+ * @param pathToFile Path to rule file
+ * @return @c true if file contains precompiled rules, @c false if it contains
+ *    text rules or it cannot be read
+ */
+bool YaraDetector::isPrecompiledRuleFile(const std::string &pathToFile)
+{
+	std::ifstream file(pathToFile, std::ios::in | std::ios::binary);
+	std::string magic(4, '\0');
+	return file.read(&magic[0], magic.size()) && isPrecompiled(magic);
+}
+
+/**
+ * Add multiple files with rules, using rules already compiled either by this
+ *    process or by previous runs
+ * @param ruleFiles Paths to rule files together with namespaces to use for
+ *    them (see addRuleFile())
+ * @param cacheDirectory Existing directory where compiled rules are cached
+ *    between runs. If it is empty, rules are cached only in memory.
+ * @return @c true if all the files were added, @c false otherwise
+ *
+ * All text rule files are compiled together into a single rule set. Compiled
+ * rule sets (and rules from precompiled files) are shared by all detectors in
+ * the process, so the same files are compiled or loaded only once. Cached
+ * rule sets are identified by the version of libyara and by the contents and
+ * namespaces of the rule files, so any change of them leads to recompilation.
+ *
+ * If the text rule files cannot be compiled together, each of them is
+ * compiled separately and the ones that cannot be compiled are skipped.
+ */
+bool YaraDetector::addRuleFiles(
+	const std::vector<std::pair<std::string, std::string>> &ruleFiles,
+	const std::string &cacheDirectory)
+{
+	auto& cache = getSharedRulesCache();
+	auto result = true;
+
+	RulesHash textKey;
+	std::vector<const std::pair<std::string, std::string>*> textFiles;
+	for (const auto& ruleFile : ruleFiles)
+	{
+		std::string content;
+		if (!readContent(ruleFile.first, content))
+		{
+			result = false;
+			continue;
+		}
+
+		if (isPrecompiled(content))
+		{
+			RulesHash key;
+			key.add(content.data(), content.size());
+			auto* rules = cache.get(key.get());
+			if (!rules && yr_rules_load(ruleFile.first.c_str(), &rules) == ERROR_SUCCESS)
+			{
+				rules = cache.add(key.get(), rules);
+			}
+
+			if (rules)
+			{
+				sharedRules.push_back(rules);
+				continue;
+			}
+		}
+
+		textKey.add(ruleFile.second);
+		textKey.add(std::to_string(content.size()));
+		textKey.add(content.data(), content.size());
+		textFiles.push_back(&ruleFile);
+	}
+
+	if (textFiles.empty())
+	{
+		return result;
+	}
+
+	if (auto* rules = cache.get(textKey.get()))
+	{
+		sharedRules.push_back(rules);
+		return result;
+	}
+
+	const auto cachePath = cacheDirectory.empty()
+		? std::string()
+		: getCachePath(cacheDirectory, textKey.get());
+	YR_RULES* rules = nullptr;
+	if (!cachePath.empty() && yr_rules_load(cachePath.c_str(), &rules) == ERROR_SUCCESS)
+	{
+		sharedRules.push_back(cache.add(textKey.get(), rules));
+		return result;
+	}
+
+	rules = compileRuleFiles(textFiles.begin(), textFiles.end());
+	if (!rules)
+	{
+		// A compiler cannot be used any more once it has failed, so every
+		// file is compiled by its own fresh compiler and the files that
+		// cannot be compiled do not spoil the other ones.
+		for (auto it = textFiles.begin(); it != textFiles.end(); ++it)
+		{
+			if (auto* fileRules = compileRuleFiles(it, it + 1))
+			{
+				precompiledRules.push_back(fileRules);
+			}
+			else
+			{
+				result = false;
+			}
+		}
+		return result;
+	}
+
+	if (!cachePath.empty())
+	{
+		saveToCache(rules, cachePath);
+	}
+	sharedRules.push_back(cache.add(textKey.get(), rules));
+	return result;
+}
+
+/**
+ * Compile all added text rules and save them into file which can be later
+ *    loaded by addPrecompiledRuleFile() or addRuleFile()
+ * @param pathToFile Path to output file
+ * @return @c true if rules were saved, @c false otherwise
+ *
+ * Rules from precompiled files and rules added by addRuleFiles() are not
+ * saved, so this fails if there are any.
+ */
+bool YaraDetector::saveCompiledRules(const std::string &pathToFile)
+{
+	if (!precompiledRules.empty() || !sharedRules.empty())
+	{
+		return false;
+	}
+
+	auto rules = getCompiledRules();
+	return rules && yr_rules_save(rules, pathToFile.c_str()) == ERROR_SUCCESS;
+}
+
 /**
  * Getter for state of instance
  * @return @c true if all is OK, @c false otherwise
@@ -321,6 +682,18 @@ bool YaraDetector::analyze(std::vector<std::uint8_t> &bytes, bool storeAllRules)
 	return analyzeWithScan(bytes, storeAllRules);
 }
 
+/**
+ * Analyze input bytes without copying them
+ * @param bytes Input bytes
+ * @param size Number of input bytes
+ * @param storeAllRules If this parameter is set to @c true, store all rules (not only detected)
+ * @return @c true if analysis completed without any error, otherwise @c false.
+ */
+bool YaraDetector::analyze(const std::uint8_t *bytes, std::size_t size, bool storeAllRules)
+{
+	return analyzeWithScan(std::make_pair(bytes, size), storeAllRules);
+}
+
 /**
  * Get detected rules
  * @return Detected rules
@@ -350,12 +723,17 @@ bool YaraDetector::analyzeWithScan(T&& value, bool storeAllRules)
 {
 	auto settings = CallbackSettings(storeAllRules, detectedRules, undetectedRules);
 
-	auto rules = getCompiledRules();
-	if (!(rules))
-		return false;
+	// Do not scan the input with an empty rule set when only shared or
+	// precompiled rules were added.
+	if (hasTextRules || (precompiledRules.empty() && sharedRules.empty()))
+	{
+		auto rules = getCompiledRules();
+		if (!(rules))
+			return false;
 
-	if (!scan(rules, yaraCallback, settings, std::forward<T>(value)))
-		return false;
+		if (!scan(rules, yaraCallback, settings, std::forward<T>(value)))
+			return false;
+	}
 
 	for (auto* rules : precompiledRules)
 	{
@@ -363,6 +741,12 @@ bool YaraDetector::analyzeWithScan(T&& value, bool storeAllRules)
 			return false;
 	}
 
+	for (auto* rules : sharedRules)
+	{
+		if (!scan(rules, yaraCallback, settings, std::forward<T>(value)))
+			return false;
+	}
+
 	return true;
 }
 
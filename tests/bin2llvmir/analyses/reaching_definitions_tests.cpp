@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <set>
+
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "bin2llvmir/utils/llvmir_tests.h"
 
@@ -23,6 +25,17 @@ namespace tests {
  */
 class ReachingDefinitionsTests: public LlvmIrTests
 {
+	protected:
+		std::set<llvm::Instruction*> defsFromUse(const std::string& use)
+		{
+			std::set<llvm::Instruction*> ret;
+			for (auto* d : RDA.defsFromUse(getInstructionByName(use)))
+			{
+				ret.insert(d->def);
+			}
+			return ret;
+		}
+
 	protected:
 		ReachingDefinitionsAnalysis RDA;
 };
@@ -44,6 +57,151 @@ DummyTest)
 	EXPECT_EQ( nullptr, module->getGlobalVariable("glob1") );
 }
 
+TEST_F(ReachingDefinitionsTests,
+definitionsFromBothBranchesReachJoin)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1(i1 %c) {
+		entry:
+			store i32 1, i32* @glob0
+			br i1 %c, label %left, label %right
+		left:
+			store i32 2, i32* @glob0
+			store i32 3, i32* @glob0
+			br label %join
+		right:
+			%r = load i32, i32* @glob0
+			br label %join
+		join:
+			%j = load i32, i32* @glob0
+			ret void
+		}
+	)");
+	auto* s1 = getNthInstruction<StoreInst>();
+	auto* s3 = getNthInstruction<StoreInst>(2);
+
+	RDA.runOnModule(*module);
+
+	std::set<Instruction*> exR = {s1};
+	std::set<Instruction*> exJ = {s1, s3};
+	EXPECT_EQ(exR, defsFromUse("r"));
+	EXPECT_EQ(exJ, defsFromUse("j"));
+	EXPECT_EQ(2, RDA.usesFromDef(s1).size());
+	EXPECT_TRUE(RDA.usesFromDef(getNthInstruction<StoreInst>(1)).empty());
+}
+
+TEST_F(ReachingDefinitionsTests,
+definitionsAreKilledInLoop)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1(i1 %c) {
+		entry:
+			%a = alloca i32
+			store i32 1, i32* @glob0
+			br label %loop
+		loop:
+			%l1 = load i32, i32* @glob0
+			%l2 = load i32, i32* %a
+			store i32 2, i32* @glob0
+			%l3 = load i32, i32* @glob0
+			br i1 %c, label %loop, label %exit
+		exit:
+			%e = load i32, i32* @glob0
+			ret void
+		}
+	)");
+	auto* a = getInstructionByName("a");
+	auto* s1 = getNthInstruction<StoreInst>();
+	auto* s2 = getNthInstruction<StoreInst>(1);
+
+	RDA.runOnModule(*module);
+
+	std::set<Instruction*> exL1 = {s1, s2};
+	std::set<Instruction*> exL2 = {a};
+	std::set<Instruction*> exL3 = {s2};
+	std::set<Instruction*> exE = {s2};
+	EXPECT_EQ(exL1, defsFromUse("l1"));
+	EXPECT_EQ(exL2, defsFromUse("l2"));
+	EXPECT_EQ(exL3, defsFromUse("l3"));
+	EXPECT_EQ(exE, defsFromUse("e"));
+	EXPECT_TRUE(RDA.getUse(getInstructionByName("l2"))->isUndef());
+}
+
+TEST_F(ReachingDefinitionsTests,
+updateOnModuleRecomputesOnlyInvalidatedFunctions)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1() {
+			store i32 1, i32* @glob0
+			store i32 2, i32* @glob0
+			%x = load i32, i32* @glob0
+			ret void
+		}
+		define void @func2() {
+			store i32 3, i32* @glob0
+			%y = load i32, i32* @glob0
+			ret void
+		}
+	)");
+	auto* s1 = getNthInstruction<StoreInst>();
+	auto* s2 = getNthInstruction<StoreInst>(1);
+	auto* s3 = getNthInstruction<StoreInst>(2);
+
+	RDA.runOnModule(*module);
+	auto* useY = RDA.getUse(getInstructionByName("y"));
+
+	RDA.invalidate(getFunctionByName("func1"));
+	s2->eraseFromParent();
+	RDA.updateOnModule(*module);
+
+	std::set<Instruction*> exX = {s1};
+	std::set<Instruction*> exY = {s3};
+	EXPECT_EQ(exX, defsFromUse("x"));
+	EXPECT_EQ(exY, defsFromUse("y"));
+	EXPECT_EQ(useY, RDA.getUse(getInstructionByName("y")));
+}
+
+TEST_F(ReachingDefinitionsTests,
+declarationsAreSkipped)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		declare void @import()
+		define void @func1() {
+			store i32 1, i32* @glob0
+			call void @import()
+			%x = load i32, i32* @glob0
+			ret void
+		}
+	)");
+	auto* s1 = getNthInstruction<StoreInst>();
+
+	RDA.runOnModule(*module);
+
+	std::set<Instruction*> exX = {s1};
+	EXPECT_EQ(exX, defsFromUse("x"));
+
+	RDA.invalidate(getFunctionByName("func1"));
+	RDA.updateOnModule(*module);
+
+	EXPECT_EQ(exX, defsFromUse("x"));
+}
+
+TEST_F(ReachingDefinitionsTests,
+runOnFunctionHandlesDeclaration)
+{
+	parseInput(R"(
+		declare void @import()
+	)");
+
+	RDA.runOnFunction(*getFunctionByName("import"));
+
+	EXPECT_TRUE(RDA.wasRun());
+}
+
 } // namespace tests
 } // namespace bin2llvmir
 } // namespace retdec
@@ -0,0 +1,184 @@
+/**
+* @file tests/bin2llvmir/optimizations/decoder/disassembly_cache_tests.cpp
+* @brief Tests for the @c DisassemblyCache.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c DisassemblyCache.
+ */
+class DisassemblyCacheTests: public LlvmIrTests
+{
+	protected:
+		virtual void TearDown() override
+		{
+			if (handle)
+			{
+				cs_close(&handle);
+			}
+			LlvmIrTests::TearDown();
+		}
+
+		/**
+		 * Disassemble the instruction at @a addr without the cache, the same
+		 * way as the decoder does when the cache has nothing.
+		 */
+		cs_insn* disassembleUncached(
+				const std::uint8_t* bytes,
+				std::size_t size,
+				std::uint64_t addr)
+		{
+			if (handle == 0)
+			{
+				cs_open(CS_ARCH_X86, CS_MODE_32, &handle);
+				cs_option(handle, CS_OPT_DETAIL, CS_OPT_ON);
+			}
+			cs_insn* insn = cs_malloc(handle);
+			if (!cs_disasm_iter(handle, &bytes, &size, &addr, insn))
+			{
+				cs_free(insn, 1);
+				return nullptr;
+			}
+			return insn;
+		}
+
+		void expectSameInsns(cs_insn* expected, cs_insn* actual)
+		{
+			ASSERT_NE(nullptr, expected);
+			ASSERT_NE(nullptr, actual);
+			EXPECT_EQ(expected->id, actual->id);
+			EXPECT_EQ(expected->address, actual->address);
+			EXPECT_EQ(expected->size, actual->size);
+			EXPECT_EQ(0, std::memcmp(expected->bytes, actual->bytes, expected->size));
+			EXPECT_EQ(std::string(expected->mnemonic), std::string(actual->mnemonic));
+			EXPECT_EQ(std::string(expected->op_str), std::string(actual->op_str));
+			ASSERT_NE(nullptr, actual->detail);
+			EXPECT_EQ(expected->detail->x86.op_count, actual->detail->x86.op_count);
+		}
+
+		csh handle = 0;
+};
+
+TEST_F(DisassemblyCacheTests, cachedInstructionsAreSameAsUncachedOnes)
+{
+	// Code longer than two chunks, so the decoder also walks over chunk
+	// boundaries, which are not aligned to instructions.
+	//
+	const std::vector<std::uint8_t> pattern = {
+		0x55,                               // push ebp
+		0x89, 0xe5,                         // mov ebp, esp
+		0x8b, 0x45, 0x08,                   // mov eax, [ebp+8]
+		0x05, 0x78, 0x56, 0x34, 0x12,       // add eax, 0x12345678
+		0xc7, 0x04, 0x24, 0x01, 0, 0, 0,    // mov dword ptr [esp], 1
+		0x90,                               // nop
+		0x5d,                               // pop ebp
+	};
+	auto format = createFormat();
+	std::vector<std::uint8_t> code;
+	std::uint64_t start = 0;
+	while (code.size() < 0x2400)
+	{
+		for (auto b : pattern)
+		{
+			auto pos = format->appendData(b);
+			if (code.empty())
+			{
+				start = pos;
+			}
+			code.push_back(b);
+		}
+	}
+
+	auto c = Config::empty(module.get());
+	FileImage image(module.get(), format, &c);
+	DisassemblyCache cache(&image, CS_ARCH_X86, CS_MODE_LITTLE_ENDIAN, 2);
+
+	// The first instruction is not disassembled yet, wait for its chunk.
+	//
+	cache.prefetch(start, CS_MODE_32);
+	cs_insn* first = nullptr;
+	while ((first = cache.take(start, CS_MODE_32, code.size())) == nullptr)
+	{
+		std::this_thread::yield();
+	}
+
+	std::size_t cached = 0;
+	std::uint64_t offset = 0;
+	cs_insn* actual = first;
+	while (offset < code.size())
+	{
+		auto addr = start + offset;
+		if (actual == nullptr)
+		{
+			actual = cache.take(addr, CS_MODE_32, code.size() - offset);
+			cached += actual != nullptr;
+		}
+		else
+		{
+			++cached;
+		}
+		cs_insn* expected = disassembleUncached(
+				code.data() + offset,
+				code.size() - offset,
+				addr);
+		if (actual == nullptr)
+		{
+			// Not ready, the decoder would disassemble it on its own.
+			//
+			actual = disassembleUncached(
+					code.data() + offset,
+					code.size() - offset,
+					addr);
+		}
+
+		expectSameInsns(expected, actual);
+		offset += expected ? expected->size : code.size();
+		cs_free(expected, 1);
+		cs_free(actual, 1);
+		actual = nullptr;
+	}
+
+	EXPECT_LT(0, cached);
+}
+
+TEST_F(DisassemblyCacheTests, missDoesNotWaitAndReturnsNothing)
+{
+	auto format = createFormat();
+	auto start = format->appendData(std::uint8_t(0x90)); // nop
+
+	auto c = Config::empty(module.get());
+	FileImage image(module.get(), format, &c);
+	DisassemblyCache cache(&image, CS_ARCH_X86, CS_MODE_LITTLE_ENDIAN, 1);
+
+	// Nothing is prepared, the caller has to disassemble the instruction.
+	// Afterwards, the instruction becomes available from the cache.
+	//
+	cs_insn* insn = cache.take(start, CS_MODE_32, 1);
+	while (insn == nullptr)
+	{
+		std::this_thread::yield();
+		insn = cache.take(start, CS_MODE_32, 1);
+	}
+	EXPECT_EQ(start, insn->address);
+	EXPECT_EQ(1, insn->size);
+	cs_free(insn, 1);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
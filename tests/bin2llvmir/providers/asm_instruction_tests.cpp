@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/fileimage.h"
 #include "bin2llvmir/utils/llvmir_tests.h"
 
 using namespace ::testing;
@@ -296,6 +297,98 @@ TEST_F(AsmInstructionTests, AsmInstructionCtorInstructionConstructsValidIfInDiff
 	EXPECT_EQ(ref, a.getLlvmToAsmInstruction());
 }
 
+TEST_F(AsmInstructionTests, AsmInstructionCtorInstructionCachesOwner)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			%a = add i32 1, 2
+			%b = mul i32 %a, 3
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto* ref = getNthInstruction<StoreInst>();
+	auto* mul = getNthInstruction<BinaryOperator>(1);
+	auto* ret = getNthInstruction<ReturnInst>();
+	cs_insn insn = {};
+	insn.address = 1234;
+	auto& insns = AsmInstruction::getLlvmToCapstoneInsnMap(module.get());
+	insns.emplace(ref, &insn, CS_MODE_32);
+	auto a = AsmInstruction(ret);
+
+	EXPECT_EQ(ref, a.getLlvmToAsmInstruction());
+	EXPECT_EQ(ref, insns.getOwner(ret));
+	EXPECT_EQ(ref, insns.getOwner(mul));
+	EXPECT_EQ(ref, AsmInstruction(mul).getLlvmToAsmInstruction());
+}
+
+TEST_F(AsmInstructionTests, AsmInstructionCtorInstructionDoesNotUseOwnerCachedBeforeNewMapping)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			%a = add i32 1, 2
+			%b = mul i32 %a, 3
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto* ref1 = getNthInstruction<StoreInst>();
+	auto* mul = getNthInstruction<BinaryOperator>(1);
+	cs_insn insn = {};
+	insn.address = 1234;
+	auto& insns = AsmInstruction::getLlvmToCapstoneInsnMap(module.get());
+	insns.emplace(ref1, &insn, CS_MODE_32);
+	EXPECT_EQ(ref1, AsmInstruction(mul).getLlvmToAsmInstruction());
+
+	auto* ref2 = new StoreInst(
+			ConstantInt::get(Type::getInt64Ty(context), 1238),
+			mapGv,
+			true,
+			mul);
+	insn.address = 1238;
+	insns.emplace(ref2, &insn, CS_MODE_32);
+
+	EXPECT_EQ(nullptr, insns.getOwner(mul));
+	EXPECT_EQ(ref2, AsmInstruction(mul).getLlvmToAsmInstruction());
+}
+
+TEST_F(AsmInstructionTests, AsmInstructionCtorInstructionDoesNotUseErasedCachedOwner)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			%a = add i32 1, 2
+			store volatile i64 1238, i64* @llvm2asm
+			%b = mul i32 %a, 3
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto* ref1 = getNthInstruction<StoreInst>();
+	auto* ref2 = getNthInstruction<StoreInst>(1);
+	auto* ret = getNthInstruction<ReturnInst>();
+	cs_insn insn = {};
+	auto& insns = AsmInstruction::getLlvmToCapstoneInsnMap(module.get());
+	insn.address = 1234;
+	insns.emplace(ref1, &insn, CS_MODE_32);
+	insn.address = 1238;
+	insns.emplace(ref2, &insn, CS_MODE_32);
+	EXPECT_EQ(ref2, AsmInstruction(ret).getLlvmToAsmInstruction());
+
+	ref2->eraseFromParent();
+
+	EXPECT_EQ(nullptr, insns.getOwner(ret));
+	EXPECT_EQ(ref1, AsmInstruction(ret).getLlvmToAsmInstruction());
+}
+
 //
 // AsmInstruction(llvm::Module*, retdec::common::Address)
 //
@@ -357,6 +450,104 @@ TEST_F(AsmInstructionTests, AsmInstructionCtorAddressConstructsValidForGoodAddre
 	EXPECT_EQ(ref, a.getLlvmToAsmInstruction());
 }
 
+TEST_F(AsmInstructionTests, AsmInstructionCtorAddressUsesIndexedInstruction)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			store volatile i64 1234, i64* @llvm2asm
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto* ref = getNthInstruction<StoreInst>(1);
+	cs_insn insn = {};
+	insn.address = 1234;
+	insn.size = 2;
+	insn.id = X86_INS_NOP;
+	AsmInstruction::getLlvmToCapstoneInsnMap(module.get()).emplace(
+			ref,
+			&insn,
+			CS_MODE_32);
+	auto a = AsmInstruction(module.get(), 1234);
+
+	EXPECT_TRUE(a.isValid());
+	EXPECT_EQ(ref, a.getLlvmToAsmInstruction());
+	EXPECT_EQ(2, a.getByteSize());
+}
+
+TEST_F(AsmInstructionTests, AsmInstructionCtorAddressDoesNotUseErasedIndexedInstruction)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto* s = getNthInstruction<StoreInst>();
+	cs_insn insn = {};
+	insn.address = 1234;
+	AsmInstruction::getLlvmToCapstoneInsnMap(module.get()).emplace(
+			s,
+			&insn,
+			CS_MODE_32);
+	s->eraseFromParent();
+	auto a = AsmInstruction(module.get(), 1234);
+
+	EXPECT_TRUE(a.isInvalid());
+}
+
+TEST_F(AsmInstructionTests, getCapstoneInsnDisassemblesInstructionOnDemand)
+{
+	auto format = createFormat();
+	auto addr = format->appendData(std::uint8_t(0x89)); // mov ebp, esp
+	format->appendData(std::uint8_t(0xe5));
+	format->appendData(std::uint8_t(0x90));             // nop
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 )" + std::to_string(addr) + R"(, i64* @llvm2asm
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto c = Config::empty(module.get());
+	FileImage image(module.get(), format, &c);
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto* s = getNthInstruction<StoreInst>();
+	auto& insns = AsmInstruction::getLlvmToCapstoneInsnMap(module.get());
+	ASSERT_TRUE(insns.setDisassembler(
+			CS_ARCH_X86,
+			CS_MODE_LITTLE_ENDIAN,
+			image.getImage()));
+	cs_insn insn = {};
+	insn.address = addr;
+	insn.size = 2;
+	insn.id = X86_INS_MOV;
+	insns.emplace(s, &insn, CS_MODE_32);
+	AsmInstruction a(s);
+
+	auto* ci = a.getCapstoneInsn();
+	ASSERT_NE(nullptr, ci);
+	EXPECT_EQ(X86_INS_MOV, ci->id);
+	EXPECT_EQ(addr, ci->address);
+	EXPECT_EQ(2, ci->size);
+	EXPECT_EQ("mov", std::string(ci->mnemonic));
+	ASSERT_NE(nullptr, ci->detail);
+	EXPECT_EQ(2, ci->detail->x86.op_count);
+	EXPECT_EQ(ci, a.getCapstoneInsn());
+
+	insns.releaseCapstoneInsn(s);
+	ci = a.getCapstoneInsn();
+	ASSERT_NE(nullptr, ci);
+	EXPECT_EQ(X86_INS_MOV, ci->id);
+}
+
 //
 // AsmInstruction(llvm::Function*)
 //
@@ -0,0 +1,97 @@
+/**
+* @file tests/cpdetect/search_tests.cpp
+* @brief Tests for the @c search module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/cpdetect/compiler_detector/search/search.h"
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace cpdetect {
+namespace tests {
+
+/**
+ * Tests for the @c search module.
+ */
+class SearchTests : public Test
+{
+	protected:
+		const std::vector<std::uint8_t> bytes = {0x55, 0x8B, 0xEC, 0x55, 0x8B, 0xEC, 0x90, 0xC3};
+		std::unique_ptr<RawDataFormat> parser;
+		std::unique_ptr<Search> search;
+
+	public:
+		SearchTests()
+		{
+			parser = std::make_unique<RawDataFormat>(bytes.data(), bytes.size());
+			parser->setEndianness(Endianness::LITTLE);
+			parser->setBytesPerWord(4);
+			search = std::make_unique<Search>(*parser);
+		}
+};
+
+TEST_F(SearchTests, OverlappingPatternsAreAllFoundInOnePass)
+{
+	const auto result = search->findUnslashedSignatures(
+			{"558BEC", "8BEC55", "EC558B", "8BEC", "8BEC"}, 0, bytes.size());
+
+	EXPECT_EQ(std::vector<unsigned long long>({6, 6, 6, 4, 4}), result);
+}
+
+TEST_F(SearchTests, PatternsAreFoundAtBeginningAndEndOfArea)
+{
+	EXPECT_EQ(4, search->findUnslashedSignature("558B", 0, bytes.size()));
+	EXPECT_EQ(4, search->findUnslashedSignature("90C3", 0, bytes.size()));
+	EXPECT_EQ(2, search->findUnslashedSignature("C3", bytes.size() - 1, bytes.size()));
+	EXPECT_EQ(6, search->findUnslashedSignature("8BEC55", 1, 4));
+}
+
+TEST_F(SearchTests, PatternsCrossingBoundariesOfAreaAreNotFound)
+{
+	// area starts after the first occurrence and ends in the high nibble of its
+	// last byte
+	EXPECT_EQ(0, search->findUnslashedSignature("558BEC55", 1, bytes.size()));
+	EXPECT_EQ(0, search->findUnslashedSignature("90C3", 0, bytes.size() - 1));
+	EXPECT_EQ(2, search->findUnslashedSignature("0C", 0, bytes.size() - 1));
+	EXPECT_EQ(0, search->findUnslashedSignature("8BEC55", 1, 3));
+}
+
+TEST_F(SearchTests, WildcardsMatchAnyNibble)
+{
+	const auto result = search->findUnslashedSignatures(
+			{"55--EC", "5?8B", "-5-B", "EC;;8B", "--------------C3"}, 0, bytes.size());
+
+	EXPECT_EQ(std::vector<unsigned long long>({4, 3, 2, 4, 2}), result);
+}
+
+TEST_F(SearchTests, PatternsAreFoundOnOddNibbleOffsets)
+{
+	const auto result = search->findUnslashedSignatures({"58BEC5", "-C558", "0C3"}, 0, bytes.size());
+
+	EXPECT_EQ(std::vector<unsigned long long>({6, 4, 3}), result);
+}
+
+TEST_F(SearchTests, MissingPatternsAreNotFound)
+{
+	const auto result = search->findUnslashedSignatures(
+			{"DEAD", "558BEC558BEC90C3FF", "8bec", "", "ECEC", "--------------------"}, 0, bytes.size());
+
+	EXPECT_EQ(std::vector<unsigned long long>({0, 0, 0, 0, 0, 0}), result);
+	EXPECT_EQ(0, search->findUnslashedSignature("558B", 4, 2));
+	EXPECT_EQ(0, search->findUnslashedSignature("C3", bytes.size(), bytes.size() + 8));
+}
+
+} // namespace tests
+} // namespace cpdetect
+} // namespace retdec
@@ -0,0 +1,86 @@
+/**
+* @file tests/crypto/multi_hash_context_tests.cpp
+* @brief Tests for the @c multi_hash_context module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/crypto/crypto.h"
+#include "retdec/crypto/multi_hash_context.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace crypto {
+namespace tests {
+
+/**
+ * Tests for the @c multi_hash_context module.
+ */
+class MultiHashContextTests : public Test
+{
+	protected:
+		static std::vector<std::uint8_t> createData(std::size_t size)
+		{
+			std::vector<std::uint8_t> data(size);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				data[i] = static_cast<std::uint8_t>(i * 31 + i / 251);
+			}
+			return data;
+		}
+
+		static void expectSameHashesAsCryptoFunctions(
+				const std::vector<std::uint8_t>& data,
+				std::size_t chunkSize)
+		{
+			MultiHashContext ctx;
+			for (std::size_t i = 0; i < data.size(); i += chunkSize)
+			{
+				ctx.addData(data.data() + i, std::min(chunkSize, data.size() - i));
+			}
+
+			EXPECT_EQ(getCrc32(data.data(), data.size()), ctx.getCrc32());
+			EXPECT_EQ(getMd5(data.data(), data.size()), ctx.getMd5());
+			EXPECT_EQ(getSha256(data.data(), data.size()), ctx.getSha256());
+		}
+};
+
+TEST_F(MultiHashContextTests, EmptyInputGivesHashesOfEmptyData)
+{
+	MultiHashContext ctx;
+	ctx.addData(nullptr, 0);
+
+	EXPECT_EQ(getCrc32(nullptr, 0), ctx.getCrc32());
+	EXPECT_EQ("d41d8cd98f00b204e9800998ecf8427e", ctx.getMd5());
+	EXPECT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", ctx.getSha256());
+}
+
+TEST_F(MultiHashContextTests, InputShorterThanOneBlockGivesSameHashes)
+{
+	expectSameHashesAsCryptoFunctions(createData(100), 100);
+}
+
+TEST_F(MultiHashContextTests, InputOfExactlyOneBlockGivesSameHashes)
+{
+	expectSameHashesAsCryptoFunctions(createData(16 * 1024), 16 * 1024);
+}
+
+TEST_F(MultiHashContextTests, InputLongerThanOneBlockGivesSameHashes)
+{
+	expectSameHashesAsCryptoFunctions(createData(3 * 16 * 1024 + 123), 3 * 16 * 1024 + 123);
+}
+
+TEST_F(MultiHashContextTests, InputAddedInChunksCrossingBlocksGivesSameHashes)
+{
+	expectSameHashesAsCryptoFunctions(createData(3 * 16 * 1024 + 123), 10007);
+}
+
+} // namespace tests
+} // namespace crypto
+} // namespace retdec
@@ -1952,6 +1952,111 @@ ParsingCircularTypedefsBreaksLoopAndSetsTypedefToUnknownType)
 	EXPECT_EQ(retdec::ctypes::UnknownType::create(), type3->getAliasedType());
 }
 
+TEST_F(JSONCTypesParserTests,
+IndexedFunctionIsParsedOnDemand)
+{
+	std::string json(R"(
+		{
+			"functions": {
+				"ff": {
+					"decl": "int ff(int a);",
+					"header": "CHeader.h",
+					"name": "ff",
+					"params": [
+						{
+							"name": "a",
+							"type": "46f8ab7c0cff9df7cd124852e26022a6bf89e315"
+						}
+					],
+					"ret_type": "46f8ab7c0cff9df7cd124852e26022a6bf89e315"
+				},
+				"gg": {
+					"decl": "void gg();",
+					"header": "CHeader.h",
+					"name": "gg",
+					"params": [],
+					"ret_type": "missing type is not needed until gg is used"
+				}
+			},
+			"types": {
+				"46f8ab7c0cff9df7cd124852e26022a6bf89e315": {
+					"name": "int",
+					"type": "integral_type"
+				}
+			}
+		}
+	)");
+	auto context = std::make_shared<retdec::ctypes::Context>();
+
+	parser.index(json.data(), json.size(), context);
+
+	EXPECT_TRUE(parser.hasIndexedFunction("ff"));
+	EXPECT_TRUE(parser.hasIndexedFunction("gg"));
+	EXPECT_FALSE(parser.hasIndexedFunction("hh"));
+	EXPECT_FALSE(context->hasFunctionWithName("ff"));
+
+	auto func = parser.getIndexedFunction("ff");
+	ASSERT_TRUE(func);
+	EXPECT_EQ("ff", func->getName());
+	EXPECT_EQ(1, func->getParameterCount());
+	EXPECT_TRUE(func->getReturnType()->isIntegral());
+	EXPECT_EQ(func, context->getFunctionWithName("ff"));
+	EXPECT_EQ(func, parser.getIndexedFunction("ff"));
+	EXPECT_EQ(nullptr, parser.getIndexedFunction("hh"));
+}
+
+TEST_F(JSONCTypesParserTests,
+IndexingBadInputThrowsException)
+{
+	std::string json(R"(
+		{
+			"functions": {},
+			"types": {}
+	)");
+
+	ASSERT_THROW(
+		parser.index(json.data(), json.size(), std::make_shared<retdec::ctypes::Context>()),
+		CTypesParseError
+	);
+}
+
+TEST_F(JSONCTypesParserTests,
+IndexingJSONWithoutTypesItemThrowsException)
+{
+	std::string json(R"(
+		{
+			"functions": {}
+		}
+	)");
+
+	ASSERT_THROW(
+		parser.index(json.data(), json.size(), std::make_shared<retdec::ctypes::Context>()),
+		CTypesParseError
+	);
+}
+
+TEST_F(JSONCTypesParserTests,
+GettingIndexedFunctionWithUnknownTypeThrowsException)
+{
+	std::string json(R"(
+		{
+			"functions": {
+				"ff": {
+					"decl": "void ff();",
+					"header": "CHeader.h",
+					"name": "ff",
+					"params": [],
+					"ret_type": "unknown"
+				}
+			},
+			"types": {}
+		}
+	)");
+	parser.index(json.data(), json.size(), std::make_shared<retdec::ctypes::Context>());
+
+	ASSERT_THROW(parser.getIndexedFunction("ff"), CTypesParseError);
+}
+
 } // namespace tests
 } // namespace ctypesparser
 } // namespace retdec
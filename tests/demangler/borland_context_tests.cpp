@@ -164,6 +164,22 @@ TEST_F(BorlandContextTests, RReferenceTests)
 	EXPECT_NE(r1, r3);
 }
 
+TEST_F(BorlandContextTests, ClearRemovesAllNodes)
+{
+	EXPECT_EQ(0, context.size());
+
+	auto i1 = IntegralTypeNode::create(context, "int", false, {false, false});
+	auto p1 = PointerTypeNode::create(context, i1, {false, false});
+
+	EXPECT_EQ(2, context.size());
+
+	context.clear();
+
+	EXPECT_EQ(0, context.size());
+	auto p2 = PointerTypeNode::create(context, i1, {false, false});
+	EXPECT_NE(p1, p2);
+}
+
 } // tests
 } // borland
 } // demangler
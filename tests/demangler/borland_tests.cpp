@@ -336,6 +336,18 @@ TEST_F(BorlandDemanglerTests, NonClassTemplates)
 //	DEM_EQ("@%Strange$X$badrM6Person3Dog$g@Person@dog$E%@foo$qv", "Strange<&Person::dog>::foo(void)");
 }
 
+TEST_F(BorlandDemanglerTests, DemanglingWorksAfterContextIsCleared)
+{
+	BorlandDemangler dem;
+	EXPECT_EQ("foo(int *)", dem.demangleToString("@foo$qpi"));
+	EXPECT_LT(0, dem.getContextSize());
+
+	dem.clearContext();
+
+	EXPECT_EQ(0, dem.getContextSize());
+	EXPECT_EQ("foo(int *)", dem.demangleToString("@foo$qpi"));
+}
+
 // NOT SUPPORTING __restrict keyword and User defined literal (operator "")
 
 } // namespace tests
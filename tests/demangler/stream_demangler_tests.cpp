@@ -0,0 +1,113 @@
+/**
+ * @file tests/demangler/stream_demangler_tests.cpp
+ * @brief Tests for demangling of streams of names.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/demangler/stream_demangler.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace demangler {
+namespace tests {
+
+class StreamDemanglerTests : public Test
+{
+	protected:
+		std::string demangle(const std::string &input, std::size_t numOfThreads)
+		{
+			std::istringstream in(input);
+			std::ostringstream out;
+			demangleStream(in, out, numOfThreads);
+			return out.str();
+		}
+};
+
+TEST_F(StreamDemanglerTests, DemangleByScheme)
+{
+	EXPECT_EQ("foo<1>::foo()", demangleByScheme("_ZN3fooILi1EEC5Ev"));
+	EXPECT_EQ("A::B::myFunc(int, int)", demangleByScheme("__ZN1A1B6myFuncEii"));
+	EXPECT_EQ("int x", demangleByScheme("?x@@3HA"));
+	EXPECT_EQ("bar::foo(int)", demangleByScheme("@bar@foo$qi"));
+	EXPECT_EQ("main", demangleByScheme("main"));
+	EXPECT_EQ("@foo$q010ns@Bar@Baz", demangleByScheme("@foo$q010ns@Bar@Baz"));
+}
+
+TEST_F(StreamDemanglerTests, EmptyInputGivesEmptyOutput)
+{
+	EXPECT_EQ("", demangle("", 2));
+}
+
+TEST_F(StreamDemanglerTests, NamesArePrintedOnePerLineInInputOrder)
+{
+	EXPECT_EQ(
+		"foo<1>::foo()\n"
+		"main\n"
+		"int x\n"
+		"\n"
+		"bar::foo(int)\n"
+		"foo<1>::foo()\n",
+		demangle(
+			"_ZN3fooILi1EEC5Ev\n"
+			"main\r\n"
+			"?x@@3HA\n"
+			"\n"
+			"@bar@foo$qi\n"
+			"_ZN3fooILi1EEC5Ev",
+			2));
+}
+
+TEST_F(StreamDemanglerTests, ManyBatchesArePrintedInInputOrder)
+{
+	// Several batches per thread, with repeated names inside each batch and
+	// names that differ between batches.
+	std::vector<std::string> names = {"_ZN3fooILi1EEC5Ev", "?x@@3HA", "@bar@foo$qi"};
+	std::string input;
+	std::string expected;
+	for (std::size_t i = 0; i < 20000; ++i) {
+		if (i % 4 == 3) {
+			auto name = "name" + std::to_string(i);
+			input += name + "\n";
+			expected += name + "\n";
+		} else if (i % 4 == 0) {
+			input += names[0] + "\n";
+			expected += "foo<1>::foo()\n";
+		} else if (i % 4 == 1) {
+			input += names[1] + "\n";
+			expected += "int x\n";
+		} else {
+			input += names[2] + "\n";
+			expected += "bar::foo(int)\n";
+		}
+	}
+
+	EXPECT_EQ(expected, demangle(input, 1));
+	EXPECT_EQ(expected, demangle(input, 4));
+}
+
+TEST_F(StreamDemanglerTests, ManyDistinctBorlandNamesAreDemangled)
+{
+	// Enough distinct names to make the per-thread Borland context and the
+	// shared cache reach their capacity.
+	std::string input;
+	std::string expected;
+	for (std::size_t i = 0; i < 100000; ++i) {
+		auto name = "foo" + std::to_string(i);
+		input += "@" + name + "$qi\n";
+		expected += name + "(int)\n";
+	}
+
+	EXPECT_EQ(expected, demangle(input, 2));
+	EXPECT_EQ("bar::foo(int)", demangleByScheme("@bar@foo$qi"));
+}
+
+} // namespace tests
+} // namespace demangler
+} // namespace retdec
@@ -0,0 +1,67 @@
+/**
+* @file tests/fileformat/export_table_tests.cpp
+* @brief Tests for the @c export_table module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/types/export_table/export_table.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+/**
+ * Tests for the @c export_table module.
+ */
+class ExportTableTests : public Test
+{
+	protected:
+		ExportTable table;
+
+		void addExport(const std::string &name, unsigned long long address)
+		{
+			Export newExport;
+			newExport.setName(name);
+			newExport.setAddress(address);
+			table.addExport(newExport);
+		}
+};
+
+TEST_F(ExportTableTests, LookupsReturnFirstMatchingExport)
+{
+	addExport("a", 0x2000);
+	addExport("b", 0x1000);
+	addExport("a", 0x1000);
+
+	EXPECT_EQ(table.getExport(0), table.getExport("a"));
+	EXPECT_EQ(table.getExport(1), table.getExportOnAddress(0x1000));
+	EXPECT_EQ(nullptr, table.getExport("c"));
+	EXPECT_EQ(nullptr, table.getExportOnAddress(0x3000));
+}
+
+TEST_F(ExportTableTests, LookupsSeeExportsAddedAfterPreviousLookup)
+{
+	addExport("a", 0x1000);
+	EXPECT_FALSE(table.hasExport("b"));
+	EXPECT_FALSE(table.hasExport(0x2000ULL));
+
+	addExport("b", 0x2000);
+	EXPECT_TRUE(table.hasExport("b"));
+	EXPECT_TRUE(table.hasExport(0x2000ULL));
+	EXPECT_EQ(table.getExport(1), table.getExport("b"));
+
+	table.clear();
+	EXPECT_FALSE(table.hasExport("a"));
+	EXPECT_FALSE(table.hasExport(0x1000ULL));
+	EXPECT_EQ(nullptr, table.getExport("b"));
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
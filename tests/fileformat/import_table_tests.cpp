@@ -0,0 +1,66 @@
+/**
+* @file tests/fileformat/import_table_tests.cpp
+* @brief Tests for the @c import_table module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/types/import_table/import_table.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+/**
+ * Tests for the @c import_table module.
+ */
+class ImportTableTests : public Test
+{
+	protected:
+		ImportTable table;
+
+		void addImport(const std::string &name, unsigned long long address)
+		{
+			auto import = std::make_unique<Import>();
+			import->setName(name);
+			import->setAddress(address);
+			table.addImport(std::move(import));
+		}
+};
+
+TEST_F(ImportTableTests, LookupsReturnFirstMatchingImport)
+{
+	addImport("a", 0x2000);
+	addImport("b", 0x1000);
+	addImport("a", 0x1000);
+
+	EXPECT_EQ(table.getImport(0), table.getImport("a"));
+	EXPECT_EQ(table.getImport(1), table.getImportOnAddress(0x1000));
+	EXPECT_EQ(nullptr, table.getImport("c"));
+	EXPECT_EQ(nullptr, table.getImportOnAddress(0x3000));
+}
+
+TEST_F(ImportTableTests, LookupsSeeImportsAddedAfterPreviousLookup)
+{
+	addImport("a", 0x1000);
+	EXPECT_FALSE(table.hasImport("b"));
+	EXPECT_FALSE(table.hasImport(0x2000ULL));
+
+	addImport("b", 0x2000);
+	EXPECT_TRUE(table.hasImport("b"));
+	EXPECT_TRUE(table.hasImport(0x2000ULL));
+
+	table.clear();
+	EXPECT_FALSE(table.hasImport("a"));
+	EXPECT_FALSE(table.hasImport(0x1000ULL));
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
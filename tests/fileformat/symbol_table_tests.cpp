@@ -0,0 +1,111 @@
+/**
+* @file tests/fileformat/symbol_table_tests.cpp
+* @brief Tests for the @c symbol_table module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/types/symbol_table/symbol_table.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+/**
+ * Tests for the @c symbol_table module.
+ */
+class SymbolTableTests : public Test
+{
+	protected:
+		SymbolTable table;
+
+		void addSymbol(const std::string &name, unsigned long long address, unsigned long long index)
+		{
+			auto symbol = std::make_shared<Symbol>();
+			symbol->setName(name);
+			symbol->setAddress(address);
+			symbol->setIndex(index);
+			table.addSymbol(std::move(symbol));
+		}
+};
+
+TEST_F(SymbolTableTests, LookupsReturnFirstMatchingSymbol)
+{
+	addSymbol("a", 0x2000, 7);
+	addSymbol("b", 0x1000, 3);
+	addSymbol("a", 0x1000, 3);
+
+	const auto &constTable = table;
+	EXPECT_EQ(constTable.getSymbol(0), constTable.getSymbol("a"));
+	EXPECT_EQ(constTable.getSymbol(1), constTable.getSymbolOnAddress(0x1000));
+	EXPECT_EQ(constTable.getSymbol(1), constTable.getSymbolWithIndex(3));
+	EXPECT_EQ(nullptr, constTable.getSymbol("c"));
+	EXPECT_EQ(nullptr, constTable.getSymbolOnAddress(0x3000));
+	EXPECT_EQ(nullptr, constTable.getSymbolWithIndex(5));
+}
+
+TEST_F(SymbolTableTests, NonConstLookupsReturnSameSymbolsAsConstOnes)
+{
+	addSymbol("a", 0x2000, 7);
+	addSymbol("b", 0x1000, 3);
+	addSymbol("a", 0x1000, 3);
+
+	const auto &constTable = table;
+	EXPECT_EQ(constTable.getSymbol("a"), table.getSymbol("a"));
+	EXPECT_EQ(constTable.getSymbolOnAddress(0x1000), table.getSymbolOnAddress(0x1000));
+	EXPECT_EQ(constTable.getSymbolWithIndex(3), table.getSymbolWithIndex(3));
+	EXPECT_EQ(table.getSymbol(1), table.getSymbolWithIndex(3));
+	EXPECT_EQ(nullptr, table.getSymbol("c"));
+	EXPECT_EQ(nullptr, table.getSymbolOnAddress(0x3000));
+	EXPECT_EQ(nullptr, table.getSymbolWithIndex(5));
+}
+
+TEST_F(SymbolTableTests, SymbolsWithoutAddressAreNotFoundByAddress)
+{
+	auto symbol = std::make_shared<Symbol>();
+	symbol->setName("a");
+	symbol->invalidateAddress();
+	table.addSymbol(std::move(symbol));
+
+	EXPECT_FALSE(table.hasSymbol(0ULL));
+	EXPECT_TRUE(table.hasSymbol("a"));
+}
+
+TEST_F(SymbolTableTests, LookupsSeeSymbolsAddedAfterPreviousLookup)
+{
+	addSymbol("a", 0x1000, 0);
+	EXPECT_FALSE(table.hasSymbol("b"));
+	EXPECT_FALSE(table.hasSymbol(0x2000ULL));
+
+	addSymbol("b", 0x2000, 1);
+	EXPECT_TRUE(table.hasSymbol("b"));
+	EXPECT_TRUE(table.hasSymbol(0x2000ULL));
+
+	table.clear();
+	EXPECT_FALSE(table.hasSymbol("a"));
+	EXPECT_FALSE(table.hasSymbol(0x1000ULL));
+}
+
+TEST_F(SymbolTableTests, LookupsSeeSymbolsChangedThroughIterators)
+{
+	addSymbol("a", 0x1000, 0);
+	EXPECT_TRUE(table.hasSymbol(0x1000ULL));
+
+	for(auto &symbol : table)
+	{
+		symbol->setAddress(0x5000);
+	}
+
+	EXPECT_FALSE(table.hasSymbol(0x1000ULL));
+	EXPECT_TRUE(table.hasSymbol(0x5000ULL));
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 
+#include "retdec/config/config.h"
 #include "retdec/llvmir2hll/config/configs/json_config.h"
 #include "retdec/llvmir2hll/support/types.h"
 
@@ -41,6 +42,21 @@ ConfigFromStringRaisesJSONParsingErrorWhenJSONIsInvalid) {
 	ASSERT_THROW(JSONConfig::fromString("%"), JSONConfigParsingError);
 }
 
+TEST_F(JSONConfigTests,
+ConfigFromConfigUsesCopyOfGivenConfig) {
+	retdec::config::Config origConfig;
+	retdec::common::Function f("f");
+	f.setRealName("my_f");
+	origConfig.functions.insert(f);
+
+	auto config = JSONConfig::fromConfig(origConfig);
+	config->markFuncAsStaticallyLinked("f");
+
+	ASSERT_EQ("my_f", config->getRealNameForFunc("f"));
+	ASSERT_TRUE(config->isStaticallyLinkedFunc("f"));
+	ASSERT_FALSE(origConfig.functions.getFunctionByName("f")->isStaticallyLinked());
+}
+
 //
 // isGlobalVarStoringWideString()
 //
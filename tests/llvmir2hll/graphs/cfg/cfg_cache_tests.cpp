@@ -0,0 +1,71 @@
+/**
+* @file tests/llvmir2hll/graphs/cfg/cfg_cache_tests.cpp
+* @brief Tests for the @c cfg_cache module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/graphs/cfg/cfg.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c cfg_cache module.
+*/
+class CFGCacheTests: public TestsWithModule {
+protected:
+	CFGCacheTests():
+		cache(CFGCache::create(NonRecursiveCFGBuilder::create())) {}
+
+protected:
+	ShPtr<CFGCache> cache;
+};
+
+TEST_F(CFGCacheTests,
+CFGIsBuiltOnFirstRequest) {
+	ASSERT_FALSE(cache->hasCFG(testFunc));
+
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+
+	ASSERT_TRUE(cfg);
+	ASSERT_EQ(testFunc, cfg->getCorrespondingFunction());
+	ASSERT_TRUE(cache->hasCFG(testFunc));
+}
+
+TEST_F(CFGCacheTests,
+SameCFGIsReturnedUntilItIsInvalidated) {
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+
+	ASSERT_EQ(cfg, cache->getCFG(testFunc));
+}
+
+TEST_F(CFGCacheTests,
+NewCFGIsBuiltAfterInvalidation) {
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+
+	cache->invalidate(testFunc);
+
+	ASSERT_FALSE(cache->hasCFG(testFunc));
+	ASSERT_NE(cfg, cache->getCFG(testFunc));
+}
+
+TEST_F(CFGCacheTests,
+InvalidateAllRemovesAllCFGs) {
+	cache->getCFG(testFunc);
+
+	cache->invalidateAll();
+
+	ASSERT_FALSE(cache->hasCFG(testFunc));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -2546,6 +2546,55 @@ GoToJumpToEmptyBodyIsConvertedCorrectly) {
 	ASSERT_TRUE(isCallOfFuncTest(getFirstNonEmptySuccOf(whileStmt), 4));
 }
 
+TEST_F(StructureConverterTests,
+FunctionExceedingWorkLimitIsStructuredByGotos) {
+	optionMaxStructuringWork = 1;
+	auto module = convertLLVMIR2BIR(R"(
+		declare void @test(i32)
+
+		define void @function(i32 %val) {
+		entry:
+			%cond = icmp eq i32 %val, 1
+			br i1 %cond, label %iftrue, label %iffalse
+		iftrue:
+			call void @test(i32 1)
+			%cond2 = icmp eq i32 %val, 2
+			br i1 %cond2, label %inner, label %after
+		inner:
+			call void @test(i32 4)
+			br label %after
+		iffalse:
+			call void @test(i32 2)
+			br label %after
+		after:
+			call void @test(i32 3)
+			call void @test(i32 5)
+			call void @test(i32 6)
+			ret void
+		}
+	)");
+
+	//
+	// // entry
+	// if (val == 1) {
+	//     // body not tested
+	// } else {
+	//     // iffalse
+	//     test(2);
+	//     goto lab_after;
+	// }
+	// // the rest not tested
+	//
+	auto f = module->getFuncByName("function");
+	ASSERT_TRUE(f);
+	auto ifStmt = cast<IfStmt>(skipEmptyStmts(f->getBody()));
+	ASSERT_TRUE(ifStmt);
+	ASSERT_TRUE(isComparison<EqOpExpr>(ifStmt->getFirstIfCond(), f->getParam(1), 1));
+	auto falseBody = skipEmptyStmts(ifStmt->getElseClause());
+	ASSERT_TRUE(isCallOfFuncTest(falseBody, 2));
+	ASSERT_TRUE(isa<GotoStmt>(getFirstNonEmptySuccOf(falseBody)));
+}
+
 TEST_F(StructureConverterTests,
 DoWhileLoopWithNestedDoWhileLoopWithContinueToParentLoopIsConvertedCorrectly) {
 	auto module = convertLLVMIR2BIR(R"(
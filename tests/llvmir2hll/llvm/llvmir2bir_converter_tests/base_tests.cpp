@@ -95,7 +95,7 @@ ShPtr<Module> LLVMIR2BIRConverterBaseTests::ConversionPass::getConvertedModule()
 
 LLVMIR2BIRConverterBaseTests::LLVMIR2BIRConverterBaseTests():
 	configMock(std::make_shared<NiceMock<ConfigMock>>()),
-	optionStrictFPUSemantics(false) {}
+	optionStrictFPUSemantics(false), optionMaxStructuringWork(0) {}
 
 /**
 * @brief Converts the given LLVM IR code into a BIR module.
@@ -122,6 +122,7 @@ ShPtr<Module> LLVMIR2BIRConverterBaseTests::convertLLVMIR2BIR(const std::string
 	// Peform the conversion.
 	auto converter = LLVMIR2BIRConverter::create(conversionPass);
 	converter->setOptionStrictFPUSemantics(optionStrictFPUSemantics);
+	converter->setOptionMaxStructuringWork(optionMaxStructuringWork);
 	conversionPass->setUsedConverter(converter);
 	llvmModule = parseLLVMIR(code);
 	passManager.run(*llvmModule);
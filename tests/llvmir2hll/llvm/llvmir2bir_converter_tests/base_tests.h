@@ -110,6 +110,9 @@ protected:
 	/// Use strict FPU semantics?
 	bool optionStrictFPUSemantics;
 
+	/// Maximal work spent on structuring of a single function.
+	unsigned long long optionMaxStructuringWork;
+
 	/// Context for the LLVM module.
 	// Implementation note: Do NOT use llvm::getGlobalContext() because that
 	//                      would make the context same for all tests (we want
@@ -0,0 +1,106 @@
+/**
+* @file tests/llvmir2hll/optimizer/optimizer_manager_tests.cpp
+* @brief Tests for the @c optimizer_manager module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "llvmir2hll/analysis/tests_with_value_analysis.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluators/strict_arithm_expr_evaluator.h"
+#include "retdec/llvmir2hll/hll/hll_writers/c_hll_writer.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/obtainer/call_info_obtainers/optim_call_info_obtainer.h"
+#include "retdec/llvmir2hll/optimizer/optimizer_manager.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c optimizer_manager module.
+*/
+class OptimizerManagerTests: public TestsWithModule {};
+
+TEST_F(OptimizerManagerTests,
+FunctionOptimizationRunInParallelGivesSameResultAsSequentialRun) {
+	// Add many functions that use the same global variable, so their
+	// expressions observe a shared value from several threads:
+	//
+	// int g;
+	//
+	// void fN() {
+	//   g = g
+	//   aN = g
+	//   g = g
+	//   return
+	// }
+	//
+	const std::size_t NUM_OF_FUNCS = 200;
+	ShPtr<Variable> varG(Variable::create("g", IntType::create(32)));
+	module->addGlobalVar(varG);
+	std::vector<ShPtr<Function>> funcs;
+	std::vector<ShPtr<AssignStmt>> kept;
+	std::vector<ShPtr<ReturnStmt>> returns;
+	for (std::size_t i = 0; i < NUM_OF_FUNCS; ++i) {
+		ShPtr<Function> func(addFuncDef("f" + std::to_string(i)));
+		ShPtr<Variable> varA(Variable::create(
+			"a" + std::to_string(i), IntType::create(32)));
+		func->addLocalVar(varA);
+		ShPtr<ReturnStmt> returnStmt(ReturnStmt::create());
+		ShPtr<AssignStmt> selfAssign2(AssignStmt::create(varG, varG, returnStmt));
+		ShPtr<AssignStmt> assignA(AssignStmt::create(varA, varG, selfAssign2));
+		ShPtr<AssignStmt> selfAssign1(AssignStmt::create(varG, varG, assignA));
+		func->setBody(selfAssign1);
+		funcs.push_back(func);
+		kept.push_back(assignA);
+		returns.push_back(returnStmt);
+	}
+
+	// Run only SelfAssignOptimizer, in several threads.
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	OptimizerManager optimizerManager(
+		{"SelfAssignOptimizer"},
+		{},
+		CHLLWriter::create(llvm::nulls()),
+		va,
+		OptimCallInfoObtainer::create(),
+		StrictArithmExprEvaluator::create(),
+		false,
+		false,
+		4
+	);
+	optimizerManager.optimize(module);
+
+	// Every function has to end up exactly as after the sequential run:
+	//
+	// void fN() {
+	//   aN = g
+	//   return
+	// }
+	//
+	for (std::size_t i = 0; i < NUM_OF_FUNCS; ++i) {
+		EXPECT_EQ(kept[i], funcs[i]->getBody()) <<
+			"expected `" << kept[i] << "`, got `" << funcs[i]->getBody() << "`";
+		EXPECT_EQ(returns[i], kept[i]->getSuccessor()) <<
+			"expected `" << returns[i] << "`, got `" << kept[i]->getSuccessor() << "`";
+		EXPECT_FALSE(returns[i]->hasSuccessor());
+		EXPECT_FALSE(kept[i]->hasPredecessors());
+	}
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
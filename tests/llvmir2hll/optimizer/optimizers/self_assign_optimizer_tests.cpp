@@ -150,6 +150,39 @@ SelfAssignIsRemovedWhenItHasSuccessor) {
 		"expected no successor, got " << outFuncBody->getSuccessor();
 }
 
+TEST_F(SelfAssignOptimizerTests,
+OnlySelectedFunctionsAreOptimizedWhenFuncsToOptimizeAreSet) {
+	// Add a body to the testing function and to another function:
+	//
+	// void test() {
+	//   a = a
+	//   return
+	// }
+	//
+	// void other() {
+	//   b = b
+	//   return
+	// }
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(16)));
+	testFunc->setBody(AssignStmt::create(varA, varA, ReturnStmt::create()));
+	ShPtr<Function> otherFunc(addFuncDef("other"));
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(16)));
+	ShPtr<AssignStmt> otherAssignStmt(
+		AssignStmt::create(varB, varB, ReturnStmt::create()));
+	otherFunc->setBody(otherAssignStmt);
+
+	// Optimize only the testing function.
+	ShPtr<SelfAssignOptimizer> optimizer(new SelfAssignOptimizer(module));
+	optimizer->setFuncsToOptimize({testFunc});
+	optimizer->optimize();
+
+	// Check that the output is correct.
+	EXPECT_TRUE(isa<ReturnStmt>(testFunc->getBody())) <<
+		"expected ReturnStmt, got " << testFunc->getBody();
+	EXPECT_EQ(otherAssignStmt, otherFunc->getBody());
+}
+
 TEST_F(SelfAssignOptimizerTests,
 SelfAssignIsRemovedWhenItHasPredecessor) {
 	// Add a body to the testing function:
@@ -0,0 +1,87 @@
+/**
+* @file tests/llvmir2hll/support/node_pool_tests.cpp
+* @brief Tests for the @c node_pool module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/support/node_pool.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c node_pool module.
+*/
+class NodePoolTests: public Test {};
+
+TEST_F(NodePoolTests,
+AllocatedBlocksAreAlignedAndDistinct) {
+	std::vector<void *> blocks;
+	std::set<void *> uniqueBlocks;
+	for (std::size_t size = 1; size <= 1024; size += 7) {
+		void *block = NodePool::allocate(size);
+		ASSERT_EQ(0, reinterpret_cast<std::uintptr_t>(block)
+			% alignof(std::max_align_t));
+		std::memset(block, 0xAB, size);
+		blocks.push_back(block);
+		uniqueBlocks.insert(block);
+	}
+
+	ASSERT_EQ(blocks.size(), uniqueBlocks.size());
+
+	std::size_t size = 1;
+	for (void *block : blocks) {
+		NodePool::deallocate(block, size);
+		size += 7;
+	}
+}
+
+TEST_F(NodePoolTests,
+DeallocatedBlockIsReusedForSameSize) {
+	void *block = NodePool::allocate(48);
+	NodePool::deallocate(block, 48);
+
+	void *newBlock = NodePool::allocate(48);
+
+	ASSERT_EQ(block, newBlock);
+	NodePool::deallocate(newBlock, 48);
+}
+
+TEST_F(NodePoolTests,
+DeallocationOfNullPointerDoesNothing) {
+	NodePool::deallocate(nullptr, 48);
+}
+
+TEST_F(NodePoolTests,
+BlocksCanBeDeallocatedInDifferentThreadThanAllocated) {
+	std::vector<void *> blocks;
+	std::thread allocator([&blocks]() {
+		for (std::size_t i = 0; i < 1000; ++i) {
+			blocks.push_back(NodePool::allocate(64));
+		}
+	});
+	allocator.join();
+
+	for (void *block : blocks) {
+		NodePool::deallocate(block, 64);
+	}
+
+	void *block = NodePool::allocate(64);
+	ASSERT_NE(nullptr, block);
+	NodePool::deallocate(block, 64);
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -0,0 +1,176 @@
+/**
+ * @file tests/loader/pointer_scanner_tests.cpp
+ * @brief Tests for the @c pointer_scanner module.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <deque>
+#include <memory>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+#include "retdec/loader/loader/image.h"
+#include "retdec/loader/utils/pointer_scanner.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace loader {
+namespace tests {
+
+class TestImage : public Image
+{
+public:
+	TestImage(const std::shared_ptr<FileFormat>& fileFormat) : Image(fileFormat) {}
+
+	virtual bool load() override
+	{
+		return true;
+	}
+
+	void addSegment(const SecSeg* secSeg, std::uint64_t address, std::uint64_t size, const std::vector<std::uint8_t>& data)
+	{
+		llvm::StringRef dataRef = llvm::StringRef(reinterpret_cast<const char*>(data.data()), data.size());
+		insertSegment(std::make_unique<Segment>(secSeg, address, size, std::make_unique<SegmentDataSource>(dataRef)));
+	}
+};
+
+class PointerScannerTests : public Test
+{
+public:
+	PointerScannerTests()
+	{
+		format = std::make_shared<RawDataFormat>(emptyStream);
+		format->setBytesPerWord(4);
+		format->setEndianness(Endianness::LITTLE);
+		image = std::make_unique<TestImage>(format);
+	}
+
+	void addSegment(SecSeg::Type type, std::uint64_t address, std::uint64_t size, const std::vector<std::uint8_t>& data)
+	{
+		auto section = std::make_unique<Section>();
+		section->setType(type);
+		datas.push_back(data);
+		image->addSegment(section.get(), address, size, datas.back());
+		sections.push_back(std::move(section));
+	}
+
+	/**
+	 * Checks that words of all segments are classified in the same way as
+	 * Image::getWord() and Image::isPointer() see them.
+	 */
+	void expectSameAsImage()
+	{
+		PointerScanner scanner(image.get());
+		std::vector<std::uint8_t> kinds;
+		for (const auto& seg : image->getSegments())
+		{
+			scanner.classify(seg.get(), kinds);
+			std::size_t i = 0;
+			for (auto a = seg->getAddress(); a < seg->getEndAddress(); a += scanner.getWordSize(), ++i)
+			{
+				std::uint64_t val = 0;
+				bool readable = image->getWord(a, val);
+				ASSERT_LT(i, kinds.size());
+				EXPECT_EQ(readable, (kinds[i] & PointerScanner::READABLE) != 0) << a;
+				EXPECT_EQ(readable && val == 0, (kinds[i] & PointerScanner::ZERO) != 0) << a;
+				EXPECT_EQ(image->isPointer(a), (kinds[i] & PointerScanner::POINTER) != 0) << a;
+			}
+			EXPECT_EQ(i, kinds.size());
+		}
+	}
+
+	std::stringstream emptyStream;
+	std::shared_ptr<RawDataFormat> format;
+	std::unique_ptr<TestImage> image;
+	std::deque<std::unique_ptr<Section>> sections;
+	std::deque<std::vector<std::uint8_t>> datas;
+};
+
+TEST_F(PointerScannerTests,
+PointersIntoCodeAndDataAreFound) {
+	addSegment(SecSeg::Type::DATA, 0x1000, 0x18, {
+		0x00, 0x10, 0x00, 0x00, // 0x1000 -> data
+		0x04, 0x30, 0x00, 0x00, // 0x3004 -> code
+		0x00, 0x50, 0x00, 0x00, // 0x5000 -> nowhere
+		0x00, 0x60, 0x00, 0x00, // 0x6000 -> debug
+		0x00, 0x00, 0x00, 0x00, // 0
+		0x17, 0x10, 0x00, 0x00  // 0x1017 -> data
+	});
+	addSegment(SecSeg::Type::CODE, 0x3000, 0x10, {});
+	addSegment(SecSeg::Type::DEBUG, 0x6000, 0x10, {});
+
+	PointerScanner scanner(image.get());
+	std::vector<std::uint64_t> expected = { 0x1000, 0x1004, 0x1014 };
+	EXPECT_EQ(expected, scanner.findPointers(image->getSegment(0)));
+	expectSameAsImage();
+}
+
+TEST_F(PointerScannerTests,
+BigEndianWordsAreRead) {
+	format->setEndianness(Endianness::BIG);
+	addSegment(SecSeg::Type::DATA, 0x1000, 0x8, {
+		0x00, 0x00, 0x10, 0x04,
+		0x04, 0x10, 0x00, 0x00
+	});
+
+	PointerScanner scanner(image.get());
+	std::vector<std::uint64_t> expected = { 0x1000 };
+	EXPECT_EQ(expected, scanner.findPointers(image->getSegment(0)));
+	expectSameAsImage();
+}
+
+TEST_F(PointerScannerTests,
+WordsBehindRawDataAreZeroesAndLastPartialWordIsNotReadable) {
+	addSegment(SecSeg::Type::DATA, 0x1000, 0xe, {
+		0x00, 0x10, 0x00, 0x00,
+		0x04, 0x10
+	});
+	addSegment(SecSeg::Type::BSS, 0x2000, 0x10, {});
+
+	PointerScanner scanner(image.get());
+	std::vector<std::uint8_t> kinds;
+	scanner.classify(image->getSegment(0), kinds);
+	ASSERT_EQ(4, kinds.size());
+	EXPECT_EQ(PointerScanner::READABLE | PointerScanner::POINTER, kinds[0]);
+	EXPECT_EQ(PointerScanner::READABLE | PointerScanner::POINTER, kinds[1]);
+	EXPECT_EQ(PointerScanner::READABLE | PointerScanner::ZERO, kinds[2]);
+	EXPECT_EQ(0, kinds[3]);
+	expectSameAsImage();
+}
+
+TEST_F(PointerScannerTests,
+WordCrossingEndOfSegmentIsReadFromLongerDataSource) {
+	addSegment(SecSeg::Type::DATA, 0x1000, 0x6, {
+		0x00, 0x00, 0x00, 0x00,
+		0x00, 0x10, 0x00, 0x00
+	});
+
+	PointerScanner scanner(image.get());
+	std::vector<std::uint64_t> expected = { 0x1004 };
+	EXPECT_EQ(expected, scanner.findPointers(image->getSegment(0)));
+	expectSameAsImage();
+}
+
+TEST_F(PointerScannerTests,
+OverlappingSegmentsAreClassifiedAsByImage) {
+	addSegment(SecSeg::Type::DEBUG, 0x1000, 0x10, {
+		0x08, 0x10, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00,
+		0x00, 0x20, 0x00, 0x00
+	});
+	addSegment(SecSeg::Type::DATA, 0x1008, 0x10, {
+		0x0c, 0x10, 0x00, 0x00,
+		0x00, 0x10, 0x00, 0x00
+	});
+
+	expectSameAsImage();
+}
+
+} // namespace tests
+} // namespace loader
+} // namespace retdec
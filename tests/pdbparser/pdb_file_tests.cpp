@@ -0,0 +1,196 @@
+/**
+ * @file tests/pdbparser/pdb_file_tests.cpp
+ * @brief Tests for the @c pdb_file module.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/pdbparser/pdb_file.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace pdbparser {
+namespace tests {
+
+/**
+ * Tests for the @c pdb_file module on hand-made MSF 7.00 files.
+ *
+ * Page 0 contains the header, page 1 the index of the root directory page and
+ * page 2 the root directory. The other pages belong to streams.
+ */
+class PdbFileTests : public Test
+{
+	protected:
+		static const PDB_DWORD pageSize = 0x400;
+		const std::string path = "pdb_file_tests.pdb";
+		std::vector<char> content;
+		PDBFile pdb;
+
+		virtual void TearDown() override
+		{
+			std::remove(path.c_str());
+		}
+
+		void setDword(std::size_t offset, PDB_DWORD value)
+		{
+			std::memcpy(&content[offset], &value, sizeof(value));
+		}
+
+		void setHeaderDword(std::size_t field, PDB_DWORD value)
+		{
+			setDword(PDB_SIGNATURE_700_SIZE + field * sizeof(PDB_DWORD), value);
+		}
+
+		/**
+		 * Create file with @a numPages pages and streams with the given
+		 * sizes and pages.
+		 */
+		void createPdb(
+				std::size_t numPages,
+				const std::vector<std::pair<int, std::vector<PDB_DWORD>>>& streams)
+		{
+			content.assign(numPages * pageSize, 0);
+			std::memcpy(content.data(), PDB_SIGNATURE_700, PDB_SIGNATURE_700_SIZE);
+
+			std::vector<PDB_DWORD> root = {PDB_DWORD(streams.size())};
+			for (const auto& s : streams)
+			{
+				root.push_back(s.first);
+			}
+			for (const auto& s : streams)
+			{
+				root.insert(root.end(), s.second.begin(), s.second.end());
+			}
+
+			setHeaderDword(0, pageSize);
+			setHeaderDword(2, numPages);
+			setHeaderDword(3, root.size() * sizeof(PDB_DWORD));
+			setHeaderDword(5, 1);
+			setDword(pageSize, 2);
+			for (std::size_t i = 0; i < root.size(); ++i)
+			{
+				setDword(2 * pageSize + i * sizeof(PDB_DWORD), root[i]);
+			}
+		}
+
+		void fillPage(std::size_t page, char value)
+		{
+			std::memset(&content[page * pageSize], value, pageSize);
+		}
+
+		PDBFileState load()
+		{
+			std::ofstream file(path, std::ios::binary);
+			file.write(content.data(), content.size());
+			file.close();
+			return pdb.load_pdb_file(path.c_str());
+		}
+};
+
+TEST_F(PdbFileTests, StreamsAreExtractedFromTheirPages)
+{
+	createPdb(6, {{0, {}}, {0x20, {3}}, {pageSize + 0x100, {5, 4}}});
+	fillPage(3, 0x11);
+	fillPage(4, 0x33);
+	fillPage(5, 0x22);
+
+	ASSERT_EQ(PDB_STATE_OK, load());
+
+	EXPECT_TRUE(pdb.get_stream(0)->unused);
+
+	auto* linear = pdb.get_stream(1);
+	ASSERT_NE(nullptr, linear->data);
+	EXPECT_EQ(0x20, linear->size);
+	EXPECT_EQ(std::string(0x20, 0x11), std::string(linear->data, linear->size));
+
+	auto* scattered = pdb.get_stream(2);
+	ASSERT_NE(nullptr, scattered->data);
+	EXPECT_EQ(
+			std::string(pageSize, 0x22) + std::string(0x100, 0x33),
+			std::string(scattered->data, scattered->size));
+
+	EXPECT_EQ(nullptr, pdb.get_stream(3));
+}
+
+TEST_F(PdbFileTests, StreamPageOutsideOfFileIsRejected)
+{
+	createPdb(4, {{0, {}}, {0x20, {3}}, {0x20, {4}}});
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load());
+}
+
+TEST_F(PdbFileTests, RootDirectoryPageOutsideOfFileIsRejected)
+{
+	createPdb(4, {{0, {}}, {0x20, {3}}});
+	setDword(pageSize, 4);
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load());
+}
+
+TEST_F(PdbFileTests, RootIndexesPageOutsideOfFileIsRejected)
+{
+	createPdb(4, {{0, {}}, {0x20, {3}}});
+	setHeaderDword(5, 0x10000);
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load());
+}
+
+TEST_F(PdbFileTests, RootDirectoryTooSmallForStreamSizesIsRejected)
+{
+	createPdb(4, {{0, {}}, {0x20, {3}}});
+	setHeaderDword(3, 2 * sizeof(PDB_DWORD));
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load());
+}
+
+TEST_F(PdbFileTests, RootDirectoryTooSmallForStreamPagesIsRejected)
+{
+	createPdb(4, {{0, {}}, {0x20, {3}}});
+	setHeaderDword(3, 3 * sizeof(PDB_DWORD));
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load());
+}
+
+TEST_F(PdbFileTests, RootDirectoryLargerThanItsIndexesPageIsRejected)
+{
+	createPdb(4, {{0, {}}, {0x20, {3}}});
+	setHeaderDword(3, (pageSize / sizeof(PDB_DWORD) + 1) * pageSize);
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load());
+}
+
+TEST_F(PdbFileTests, EmptyRootDirectoryIsRejected)
+{
+	createPdb(4, {{0, {}}, {0x20, {3}}});
+	setHeaderDword(3, 0);
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load());
+}
+
+TEST_F(PdbFileTests, FileSizeDifferentFromNumberOfPagesIsRejected)
+{
+	createPdb(4, {{0, {}}, {0x20, {3}}});
+	setHeaderDword(2, 5);
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load());
+}
+
+TEST_F(PdbFileTests, UnsupportedPageSizeIsRejected)
+{
+	createPdb(4, {{0, {}}, {0x20, {3}}});
+	setHeaderDword(0, 0x300);
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load());
+}
+
+} // namespace tests
+} // namespace pdbparser
+} // namespace retdec
@@ -0,0 +1,209 @@
+/**
+ * @file tests/retdec/retdec_tests.cpp
+ * @brief Tests for the @c retdec module.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/config/config.h"
+#include "retdec/retdec/retdec.h"
+#include "retdec/retdec/server.h"
+#include "retdec/utils/os.h"
+
+#ifdef OS_POSIX
+	#include <csignal>
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#include <sys/wait.h>
+	#include <unistd.h>
+#endif
+
+using namespace ::testing;
+
+namespace retdec {
+namespace tests {
+
+class RetdecTests : public Test
+{
+	protected:
+		virtual void TearDown() override
+		{
+			for (auto& p : paths)
+			{
+				std::remove(p.c_str());
+			}
+		}
+
+		/**
+		 * Create a raw 32-bit x86 input with the given code and return
+		 * a config for its decompilation.
+		 */
+		config::Config createRawInput(
+				const std::string& path,
+				const std::vector<unsigned char>& code)
+		{
+			std::ofstream file(path, std::ios::binary);
+			file.write(reinterpret_cast<const char*>(code.data()), code.size());
+			paths.push_back(path);
+
+			config::Config c;
+			c.setInputFile(path);
+			c.setEntryPoint(0x1000);
+			c.setSectionVMA(0x1000);
+			c.fileFormat.setIsRaw32();
+			c.architecture.setIsX86();
+			c.architecture.setIsEndianLittle();
+			c.architecture.setBitSize(32);
+			return c;
+		}
+
+		std::string decompileToString(config::Config c)
+		{
+			llvmir2hll::LlvmIr2HllParams params;
+			params.noTimeVaryingInfo = true;
+
+			std::string out;
+			EXPECT_TRUE(decompile(c, params, &out));
+			return out;
+		}
+
+		std::string readFile(const std::string& path)
+		{
+			std::ifstream file(path);
+			std::stringstream ss;
+			ss << file.rdbuf();
+			return ss.str();
+		}
+
+		std::vector<std::string> paths;
+};
+
+TEST_F(RetdecTests,
+DecompilingSameInputTwiceInOneProcessGivesSameOutput)
+{
+	// mov eax, 42; ret
+	auto c = createRawInput("retdec-tests-input-1.bin",
+			{0xb8, 0x2a, 0x00, 0x00, 0x00, 0xc3});
+
+	auto first = decompileToString(c);
+	auto second = decompileToString(c);
+
+	EXPECT_NE(std::string::npos, first.find("42"));
+	EXPECT_EQ(first, second);
+}
+
+TEST_F(RetdecTests,
+FailedDecompilationDoesNotLeakDataIntoNextOne)
+{
+	// Creation of the file image throws after the config was already
+	// registered for the module.
+	auto missing = createRawInput("retdec-tests-missing.bin", {});
+	std::remove("retdec-tests-missing.bin");
+	EXPECT_THROW(decompileToString(missing), std::runtime_error);
+
+	// mov eax, 7; ret
+	auto c = createRawInput("retdec-tests-input-2.bin",
+			{0xb8, 0x07, 0x00, 0x00, 0x00, 0xc3});
+	auto out = decompileToString(c);
+
+	EXPECT_NE(std::string::npos, out.find("return 7"));
+	EXPECT_EQ(std::string::npos, out.find("retdec-tests-missing"));
+}
+
+TEST_F(RetdecTests,
+DecompilationWithPreloadedStaticDataGivesSameOutput)
+{
+	// mov eax, 42; ret
+	auto c = createRawInput("retdec-tests-input-3.bin",
+			{0xb8, 0x2a, 0x00, 0x00, 0x00, 0xc3});
+	auto expected = decompileToString(c);
+
+	std::ofstream("retdec-tests-dlls.txt") << "kernel32.dll\n";
+	paths.push_back("retdec-tests-dlls.txt");
+	EXPECT_TRUE(preloadStaticData(c, "retdec-tests-dlls.txt"));
+
+	EXPECT_EQ(expected, decompileToString(c));
+}
+
+TEST_F(RetdecTests,
+PreloadingStaticDataFailsForMissingDllList)
+{
+	config::Config c;
+
+	EXPECT_FALSE(preloadStaticData(c, "retdec-tests-missing-dlls.txt"));
+}
+
+#ifdef OS_POSIX
+
+TEST_F(RetdecTests,
+ServerWritesDecompiledCodeIntoOutputFile)
+{
+	// mov eax, 42; ret
+	auto c = createRawInput("retdec-tests-input-4.bin",
+			{0xb8, 0x2a, 0x00, 0x00, 0x00, 0xc3});
+
+	const std::string outPath = "retdec-tests-server-output.c";
+	const std::string configPath = "retdec-tests-server-config.json";
+	const std::string socketPath = "retdec-tests-server.sock";
+	paths.insert(paths.end(), {outPath, configPath, socketPath});
+	c.parameters.setOutputFile(outPath);
+	c.generateJsonFile(configPath);
+	std::ofstream(outPath) << "stale output\n";
+
+	auto server = fork();
+	ASSERT_LE(0, server);
+	if (server == 0)
+	{
+		_exit(runServer(socketPath, config::Config()));
+	}
+
+	// Wait until the server listens.
+	sockaddr_un addr = {};
+	addr.sun_family = AF_UNIX;
+	socketPath.copy(addr.sun_path, socketPath.size());
+	int fd = -1;
+	for (int i = 0; i < 600 && fd < 0; ++i)
+	{
+		fd = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+		{
+			close(fd);
+			fd = -1;
+			usleep(100000);
+		}
+	}
+	ASSERT_LE(0, fd);
+
+	std::string request = configPath + "\n";
+	EXPECT_EQ(ssize_t(request.size()), write(fd, request.data(), request.size()));
+	std::string response;
+	char buffer[256];
+	ssize_t n = 0;
+	while ((n = read(fd, buffer, sizeof(buffer))) > 0)
+	{
+		response.append(buffer, n);
+	}
+	close(fd);
+	kill(server, SIGTERM);
+	waitpid(server, nullptr, 0);
+
+	EXPECT_EQ("OK\n", response);
+	auto out = readFile(outPath);
+	auto ret = out.find("return 42");
+	ASSERT_NE(std::string::npos, ret);
+	EXPECT_EQ(std::string::npos, out.find("return 42", ret + 1));
+	EXPECT_EQ(std::string::npos, out.find("stale output"));
+}
+
+#endif
+
+} // namespace tests
+} // namespace retdec
@@ -0,0 +1,168 @@
+/**
+* @file tests/unpacker/signature_matcher_tests.cpp
+* @brief Tests for the @c signature_matcher module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/dynamic_buffer.h"
+#include "retdec/unpacker/signature_matcher.h"
+
+using namespace ::testing;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace unpacker {
+namespace tests {
+
+class SignatureMatcherTests : public Test {};
+
+TEST_F(SignatureMatcherTests,
+AddSignatureReturnsConsecutiveIds) {
+	Signature sig1 = { 0x01, 0x02 };
+	Signature sig2 = { ANY, ANY };
+	SignatureMatcher matcher;
+
+	EXPECT_EQ(0, matcher.addSignature(&sig1));
+	EXPECT_EQ(1, matcher.addSignature(&sig2));
+	EXPECT_EQ(2, matcher.getNumberOfSignatures());
+}
+
+TEST_F(SignatureMatcherTests,
+ExactMatchAtOffsetWorks) {
+	Signature sig = { 0x40, 0x41, 0x42, 0x43 };
+	DynamicBuffer matchedBuffer({ 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44 });
+	SignatureMatcher matcher;
+	matcher.addSignature(&sig);
+
+	std::size_t id = 100;
+	DynamicBuffer capturedData;
+	EXPECT_TRUE(matcher.match(2, matchedBuffer, id, capturedData));
+	EXPECT_EQ(0, id);
+	EXPECT_FALSE(matcher.match(1, matchedBuffer, id, capturedData));
+}
+
+TEST_F(SignatureMatcherTests,
+FirstMatchedSignatureIsReturned) {
+	Signature sig1 = { 0x50, 0x51, 0x52 };
+	Signature sig2 = { 0x40, ANY, 0x42 };
+	Signature sig3 = { 0x40, 0x41 };
+	DynamicBuffer matchedBuffer({ 0x40, 0x41, 0x42, 0x43 });
+	SignatureMatcher matcher;
+	matcher.addSignature(&sig1);
+	matcher.addSignature(&sig2);
+	matcher.addSignature(&sig3);
+
+	std::size_t id = 100;
+	DynamicBuffer capturedData;
+	EXPECT_TRUE(matcher.match(0, matchedBuffer, id, capturedData));
+	EXPECT_EQ(1, id);
+}
+
+TEST_F(SignatureMatcherTests,
+EarlierSignatureFoundLaterInDataIsPreferred) {
+	Signature sig1 = { 0x62, 0x63 };
+	Signature sig2 = { 0x60, 0x61 };
+	DynamicBuffer matchedBuffer({ 0x60, 0x61, 0x62, 0x63, 0x64 });
+	SignatureMatcher matcher;
+	matcher.addSignature(&sig1, 5);
+	matcher.addSignature(&sig2, 5);
+
+	std::size_t id = 100;
+	DynamicBuffer capturedData;
+	EXPECT_TRUE(matcher.match(0, matchedBuffer, id, capturedData));
+	EXPECT_EQ(0, id);
+}
+
+TEST_F(SignatureMatcherTests,
+SearchIsLimitedBySearchDistance) {
+	Signature sig = { 0x62, 0x63 };
+	DynamicBuffer matchedBuffer({ 0x60, 0x61, 0x62, 0x63, 0x64 });
+	SignatureMatcher shortMatcher, longMatcher;
+	shortMatcher.addSignature(&sig, 2);
+	longMatcher.addSignature(&sig, 3);
+
+	std::size_t id = 100;
+	DynamicBuffer capturedData;
+	EXPECT_FALSE(shortMatcher.match(0, matchedBuffer, id, capturedData));
+	EXPECT_TRUE(longMatcher.match(0, matchedBuffer, id, capturedData));
+}
+
+TEST_F(SignatureMatcherTests,
+UnlimitedSearchDistanceWorks) {
+	Signature sig = { 0x63, 0x64 };
+	DynamicBuffer matchedBuffer({ 0x60, 0x61, 0x62, 0x63, 0x64 });
+	SignatureMatcher matcher;
+	matcher.addSignature(&sig, std::numeric_limits<uint64_t>::max());
+
+	std::size_t id = 100;
+	DynamicBuffer capturedData;
+	EXPECT_TRUE(matcher.match(1, matchedBuffer, id, capturedData));
+	EXPECT_FALSE(matcher.match(4, matchedBuffer, id, capturedData));
+}
+
+TEST_F(SignatureMatcherTests,
+BitWildcardsAndCapturesWork) {
+	Signature sig = { 0x40, 0x41, CAP, ANYB(0x05, 0xF0), CAP };
+	DynamicBuffer matchedBuffer({ 0x00, 0x40, 0x41, 0xCC, 0x35, 0xDD });
+	DynamicBuffer unmatchedBuffer({ 0x00, 0x40, 0x41, 0xCC, 0x36, 0xDD });
+	SignatureMatcher matcher;
+	matcher.addSignature(&sig, 2);
+
+	std::size_t id = 100;
+	DynamicBuffer capturedData;
+	EXPECT_TRUE(matcher.match(0, matchedBuffer, id, capturedData));
+	EXPECT_EQ(0xDDCC, capturedData.read<uint16_t>(0));
+	EXPECT_FALSE(matcher.match(0, unmatchedBuffer, id, capturedData));
+}
+
+TEST_F(SignatureMatcherTests,
+SignatureWithoutAnchorWorks) {
+	Signature sig = { 0x62, ANY, 0x64 };
+	DynamicBuffer matchedBuffer({ 0x60, 0x61, 0x62, 0x63, 0x64 });
+	SignatureMatcher matcher;
+	matcher.addSignature(&sig, 3);
+
+	std::size_t id = 100;
+	DynamicBuffer capturedData;
+	EXPECT_TRUE(matcher.match(0, matchedBuffer, id, capturedData));
+	EXPECT_EQ(0, id);
+}
+
+TEST_F(SignatureMatcherTests,
+FilterWorks) {
+	Signature sig1 = { 0x40, 0x41 };
+	Signature sig2 = { 0x40, ANY };
+	DynamicBuffer matchedBuffer({ 0x40, 0x41 });
+	SignatureMatcher matcher;
+	matcher.addSignature(&sig1);
+	matcher.addSignature(&sig2);
+
+	std::size_t id = 100;
+	DynamicBuffer capturedData;
+	EXPECT_TRUE(matcher.match(0, matchedBuffer, id, capturedData,
+			[](std::size_t sigId) { return sigId != 0; }));
+	EXPECT_EQ(1, id);
+	EXPECT_FALSE(matcher.match(0, matchedBuffer, id, capturedData,
+			[](std::size_t) { return false; }));
+}
+
+TEST_F(SignatureMatcherTests,
+SignatureLongerThanDataDoesNotMatch) {
+	Signature sig = { 0x40, 0x41, 0x42 };
+	DynamicBuffer matchedBuffer({ 0x40, 0x41 });
+	SignatureMatcher matcher;
+	matcher.addSignature(&sig, 10);
+
+	std::size_t id = 100;
+	DynamicBuffer capturedData;
+	EXPECT_FALSE(matcher.match(0, matchedBuffer, id, capturedData));
+	EXPECT_FALSE(matcher.match(5, matchedBuffer, id, capturedData));
+}
+
+} // namespace tests
+} // namespace unpacker
+} // namespace retdec
@@ -0,0 +1,156 @@
+/**
+* @file tests/utils/interval_index_tests.cpp
+* @brief Tests for the @c interval_index module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/interval_index.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c interval_index module.
+*/
+class IntervalIndexTests: public Test {};
+
+TEST_F(IntervalIndexTests,
+EmptyIndexFindsNothing) {
+	IntervalIndex<int> index;
+	index.build();
+
+	ASSERT_TRUE(index.empty());
+	ASSERT_EQ(0, index.find(0));
+	ASSERT_EQ(0, index.find(100));
+}
+
+TEST_F(IntervalIndexTests,
+FindReturnsValueOfIntervalContainingPoint) {
+	IntervalIndex<int> index;
+	index.add(10, 20, 1);
+	index.add(30, 40, 2);
+	index.build();
+
+	ASSERT_EQ(0, index.find(9));
+	ASSERT_EQ(1, index.find(10));
+	ASSERT_EQ(1, index.find(19));
+	ASSERT_EQ(0, index.find(20));
+	ASSERT_EQ(2, index.find(30));
+	ASSERT_EQ(2, index.find(39));
+	ASSERT_EQ(0, index.find(40));
+}
+
+TEST_F(IntervalIndexTests,
+FirstAddedIntervalWinsWhenIntervalsOverlap) {
+	IntervalIndex<int> index;
+	index.add(15, 18, 1);
+	index.add(10, 30, 2);
+	index.add(12, 25, 3);
+	index.build();
+
+	ASSERT_EQ(2, index.find(10));
+	ASSERT_EQ(2, index.find(12));
+	ASSERT_EQ(1, index.find(15));
+	ASSERT_EQ(1, index.find(17));
+	ASSERT_EQ(2, index.find(18));
+	ASSERT_EQ(2, index.find(29));
+	ASSERT_EQ(0, index.find(30));
+}
+
+TEST_F(IntervalIndexTests,
+EmptyIntervalsAreIgnored) {
+	IntervalIndex<int> index;
+	index.add(10, 10, 1);
+	index.addSized(20, 0, 2);
+	index.build();
+
+	ASSERT_TRUE(index.empty());
+	ASSERT_EQ(0, index.find(10));
+	ASSERT_EQ(0, index.find(20));
+}
+
+TEST_F(IntervalIndexTests,
+AddSizedClampsEndOfIntervalOnOverflow) {
+	const auto max = std::numeric_limits<std::uint64_t>::max();
+	IntervalIndex<int> index;
+	index.addSized(max - 10, 100, 1);
+	index.build();
+
+	ASSERT_EQ(1, index.find(max - 10));
+	ASSERT_EQ(1, index.find(max - 1));
+}
+
+TEST_F(IntervalIndexTests,
+RepeatedQueriesInSameRangeReturnSameValue) {
+	IntervalIndex<int> index;
+	index.add(0, 100, 1);
+	index.add(200, 300, 2);
+	index.build();
+
+	ASSERT_EQ(2, index.find(250));
+	ASSERT_EQ(2, index.find(260));
+	ASSERT_EQ(1, index.find(50));
+	ASSERT_EQ(0, index.find(150));
+	ASSERT_EQ(2, index.find(299));
+}
+
+TEST_F(IntervalIndexTests,
+ConcurrentQueriesOnBuiltIndexReturnCorrectValues) {
+	IntervalIndex<int> index;
+	for (int i = 0; i < 64; ++i)
+	{
+		index.add(i * 100, i * 100 + 50, i + 1);
+	}
+	index.build();
+
+	std::vector<int> mismatches(4, 0);
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t < mismatches.size(); ++t)
+	{
+		threads.emplace_back([&index, &mismatches, t]() {
+			for (int round = 0; round < 1000; ++round)
+			{
+				int i = (round * 7 + static_cast<int>(t) * 13) % 64;
+				if (index.find(i * 100 + 25) != i + 1
+						|| index.find(i * 100 + 75) != 0)
+				{
+					++mismatches[t];
+				}
+			}
+		});
+	}
+	for (auto &thread : threads)
+	{
+		thread.join();
+	}
+
+	for (auto m : mismatches)
+	{
+		ASSERT_EQ(0, m);
+	}
+}
+
+TEST_F(IntervalIndexTests,
+ClearRemovesAllIntervals) {
+	IntervalIndex<int> index;
+	index.add(0, 100, 1);
+	index.build();
+	index.clear();
+	index.build();
+
+	ASSERT_TRUE(index.empty());
+	ASSERT_EQ(0, index.find(50));
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
@@ -0,0 +1,98 @@
+/**
+* @file tests/utils/memory_mapped_file_tests.cpp
+* @brief Tests for the @c memory_mapped_file module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/memory_mapped_file.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c memory_mapped_file module.
+*/
+class MemoryMappedFileTests: public Test {
+protected:
+	virtual void TearDown() override {
+		std::remove(path.c_str());
+	}
+
+	void createFile(const std::string &content) {
+		std::ofstream file(path, std::ios::binary);
+		file << content;
+	}
+
+	const std::string path = "retdec-memory-mapped-file-test.bin";
+};
+
+TEST_F(MemoryMappedFileTests,
+ContentOfMappedFileIsAvailable) {
+	createFile("hello");
+
+	MemoryMappedFile file(path);
+
+	ASSERT_TRUE(file.isOpen());
+	ASSERT_EQ(5, file.getSize());
+	ASSERT_EQ("hello", std::string(
+		reinterpret_cast<const char *>(file.getData()), file.getSize()));
+}
+
+TEST_F(MemoryMappedFileTests,
+WritesToMappedDataDoNotModifyFile) {
+	createFile("hello");
+
+	{
+		MemoryMappedFile file(path);
+		ASSERT_TRUE(file.isOpen());
+		file.getData()[0] = 'j';
+		ASSERT_EQ('j', file.getData()[0]);
+	}
+
+	MemoryMappedFile file(path);
+	ASSERT_EQ('h', file.getData()[0]);
+}
+
+TEST_F(MemoryMappedFileTests,
+EmptyFileIsMappedWithoutData) {
+	createFile("");
+
+	MemoryMappedFile file(path);
+
+	ASSERT_TRUE(file.isOpen());
+	ASSERT_EQ(nullptr, file.getData());
+	ASSERT_EQ(0, file.getSize());
+}
+
+TEST_F(MemoryMappedFileTests,
+NonexistentFileIsNotMapped) {
+	MemoryMappedFile file("retdec-nonexistent-file.bin");
+
+	ASSERT_FALSE(file.isOpen());
+	ASSERT_EQ(nullptr, file.getData());
+	ASSERT_EQ(0, file.getSize());
+}
+
+TEST_F(MemoryMappedFileTests,
+CloseUnmapsFile) {
+	createFile("hello");
+	MemoryMappedFile file(path);
+
+	file.close();
+
+	ASSERT_FALSE(file.isOpen());
+	ASSERT_EQ(nullptr, file.getData());
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
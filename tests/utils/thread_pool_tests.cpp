@@ -0,0 +1,72 @@
+/**
+* @file tests/utils/thread_pool_tests.cpp
+* @brief Tests for the @c thread_pool module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <atomic>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/thread_pool.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c thread_pool module.
+*/
+class ThreadPoolTests: public Test {};
+
+TEST_F(ThreadPoolTests,
+PoolHasRequestedNumberOfThreads) {
+	ThreadPool pool(3);
+
+	ASSERT_EQ(3, pool.getNumOfThreads());
+}
+
+TEST_F(ThreadPoolTests,
+PoolCreatedWithZeroThreadsHasDefaultNumberOfThreads) {
+	ThreadPool pool(0);
+
+	ASSERT_EQ(ThreadPool::getDefaultNumOfThreads(), pool.getNumOfThreads());
+}
+
+TEST_F(ThreadPoolTests,
+SubmitReturnsFutureWithResultOfTask) {
+	ThreadPool pool(2);
+
+	auto result = pool.submit([]() { return 42; });
+
+	ASSERT_EQ(42, result.get());
+}
+
+TEST_F(ThreadPoolTests,
+ExceptionThrownByTaskIsPropagatedThroughFuture) {
+	ThreadPool pool(2);
+
+	auto result = pool.submit([]() { throw std::runtime_error("error"); });
+
+	ASSERT_THROW(result.get(), std::runtime_error);
+}
+
+TEST_F(ThreadPoolTests,
+AllTasksAreFinishedWhenPoolIsDestroyed) {
+	std::atomic<int> counter(0);
+	{
+		ThreadPool pool(4);
+		for (int i = 0; i < 100; ++i) {
+			pool.submit([&counter]() { ++counter; });
+		}
+	}
+
+	ASSERT_EQ(100, counter);
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec